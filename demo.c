@@ -185,7 +185,9 @@ main (void){
   DYSPOISSOMETER_UINT kernel_size;
   DYSPOISSOMETER_NUMBER kernel_skew;
   DYSPOISSOMETER_NUMBER logfreedom;
+  DYSPOISSOMETER_NUMBER logfreedom_median;
   DYSPOISSOMETER_UINT *mask_list_base;
+  u64 random_seed;
   u16 *random_u16_list_base;
   u32 *random_u32_list_base;
   u64 random_u64_list_base[7];
@@ -226,9 +228,11 @@ We don't need these memset()s, except to prove that the randomness ain't coming
     enranda_entropy_u8_list_get(enranda_base, 0, 16-1, random_u8_list_base);
     DEBUG_LIST("random_u8_list_base", 16, random_u8_list_base, U8_SIZE_LOG2);
     DEBUG_PRINT("\nBy the way, we actually generated (2^19) bits of entropy behind the scenes,\nwhich is Enranda's private granularity. As explained on the webpage, Enranda\noutputs less entropy than it inputs, so there is no pseudorandomness involved,\napart from trapdooring big entropy into small entropy. But is the result\nreally convincingly random? With only 16 bytes, who knows...\n\n");
-    DEBUG_PRINT("To help answer this question, we can create (2^16) samples, each of which 16\nbits in size. If it's truly random, the logfreedom of the result should be\nequally likely to be less than or equal to the median logfreedom, as greater\nthan or equal to it. dyspoissometer_logfreedom_median_get() will provide us\nwith the median logfreedom. Unfortunately, it takes too long for demo purposes,\nbut if you run it yourself, you'll find that the median is close to\n7.267915800940217E+05; the exact median is combinatorially hard to find, but\npolynomially easy to approximate (and more accurately so than we require).\n\n");
+    DEBUG_PRINT("To help answer this question, we can create (2^16) samples, each of which 16\nbits in size. If it's truly random, the logfreedom of the result should be\nequally likely to be less than or equal to the median logfreedom, as greater\nthan or equal to it. dyspoissometer_logfreedom_median_get() will provide us\nwith the median logfreedom. Unfortunately, it takes too long for demo purposes,\nbut medians for common sizes such as this one are precomputed, so\ndyspoissometer_logfreedom_median_cached_get() can just look it up. The exact\nmedian is combinatorially hard to find, but polynomially easy to approximate\n(and more accurately so than we require).\n\n");
     DEBUG_PRINT("By the way, logfreedom is most useful as a randomness test when the mask count\n(2^16, in this case) equals the mask span (which it does). So let's get 10 such\nrandom mask sets, and measure the logfreedom of each:\n\n");
-    DEBUG_PRINT("logfreedom_median=7.267915800940217E+05\n");
+    random_seed=1;
+    logfreedom_median=dyspoissometer_logfreedom_median_cached_get(NULL, DYSPOISSOMETER_BASELINE_MEDIAN_ITERATION_MAX, U16_MAX, U16_MAX, &random_seed);
+    DEBUG_NUMBER("logfreedom_median", logfreedom_median);
     status=0;
     i=0;
     do{
@@ -29,9 +29,16 @@ Dyspoissonism Functions
 #ifdef DYSPOISSOMETER_NUMBER_QUAD
   #include <quadmath.h>
 #endif
+#include <pthread.h>
 #include <stdint.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#ifdef WINDOWS
+  #include <windows.h>
+#else
+  #include <unistd.h>
+#endif
 #include "constant.h"
 #include "debug.h"
 #include "debug_xtrn.h"
@@ -342,49 +349,472 @@ Copy the object list back to what is, from the caller's perspective, uint_list0_
   return;
 }
 
-DYSPOISSOMETER_NUMBER
-dyspoissometer_logfreedom_sparse_get(DYSPOISSOMETER_UINT *freq_list0_base, DYSPOISSOMETER_UINT *freq_list1_base, DYSPOISSOMETER_UINT mask_max){
+dyspoissometer_dd_t
+dyspoissometer_dd_add(dyspoissometer_dd_t dd0, dyspoissometer_dd_t dd1){
 /*
-Compute logfreedom directly from a frequency list (as opposed to a population list).
+Add 2 double-doubles.
 
 In:
 
-  *freq_list0_base contains (mask_max+1) items, each giving the frequency of the corresponding zero-based mask. The sum of all frequencies must be on [1, DYSPOISSOMETER_UINT_MAX].
+  dd0 is the augend.
 
-  *freq_list1_base is undefined but writable for the same size as *freq_list0_base.
+  dd1 is the addend.
 
-  mask_mask is the number of items at freq_list0_base, less one.
+Out:
+
+  Returns (dd0+dd1), normalized, with relative error on the order of 2^(-104).
+*/
+  double error0;
+  double error1;
+  double sum_hi;
+  double sum_lo;
+  dyspoissometer_dd_t sum;
+  double term;
+
+/*
+Compute the sums of the high and low parts using Knuth's error-free transformation, then renormalize twice using Dekker's fast transformation, which is exact because the first operand dominates in each case.
+*/
+  sum_hi=dd0.hi+dd1.hi;
+  term=sum_hi-dd0.hi;
+  error0=(dd0.hi-(sum_hi-term))+(dd1.hi-term);
+  sum_lo=dd0.lo+dd1.lo;
+  term=sum_lo-dd0.lo;
+  error1=(dd0.lo-(sum_lo-term))+(dd1.lo-term);
+  error0+=sum_lo;
+  term=sum_hi+error0;
+  error0-=term-sum_hi;
+  error0+=error1;
+  sum.hi=term+error0;
+  sum.lo=error0-(sum.hi-term);
+  return sum;
+}
+
+dyspoissometer_dd_t
+dyspoissometer_dd_sub(dyspoissometer_dd_t dd0, dyspoissometer_dd_t dd1){
+/*
+Subtract one double-double from another.
+
+In:
+
+  dd0 is the minuend.
+
+  dd1 is the subtrahend.
 
 Out:
 
-  Returns the logfreedom of the population list implied by *freq_list0_base, guaranteed to be nonnegative.
+  Returns (dd0-dd1) as defined in dyspoissometer_dd_add():Out.
+*/
+  dd1.hi=-dd1.hi;
+  dd1.lo=-dd1.lo;
+  return dyspoissometer_dd_add(dd0, dd1);
+}
 
-  *freq_list0_base is undefined.
+dyspoissometer_dd_t
+dyspoissometer_dd_mul(dyspoissometer_dd_t dd0, dyspoissometer_dd_t dd1){
+/*
+Multiply 2 double-doubles.
+
+In:
+
+  dd0 is the multiplicand.
+
+  dd1 is the multiplier.
+
+Out:
+
+  Returns (dd0*dd1), normalized, with relative error on the order of 2^(-104).
+*/
+  double error;
+  double product_hi;
+  dyspoissometer_dd_t product;
+
+/*
+fma() gives us the exact error of the high product, which is fast when the compiler can emit a fused multiply-add instruction, and correct (if slower) otherwise. The (lo*lo) term is below the precision of the result, so ignore it.
+*/
+  product_hi=dd0.hi*dd1.hi;
+  error=fma(dd0.hi, dd1.hi, -product_hi);
+  error+=(dd0.hi*dd1.lo)+(dd0.lo*dd1.hi);
+  product.hi=product_hi+error;
+  product.lo=error-(product.hi-product_hi);
+  return product;
+}
+
+dyspoissometer_dd_t
+dyspoissometer_dd_div(dyspoissometer_dd_t dd0, dyspoissometer_dd_t dd1){
+/*
+Divide one double-double by another.
+
+In:
+
+  dd0 is the dividend.
+
+  dd1 is the divisor, which must be nonzero.
+
+Out:
+
+  Returns (dd0/dd1), normalized, with relative error on the order of 2^(-104).
+*/
+  dyspoissometer_dd_t quotient;
+  double quotient0;
+  double quotient1;
+  double quotient2;
+  dyspoissometer_dd_t remainder;
+  dyspoissometer_dd_t term;
+
+/*
+Perform long division, one double at a time, to 3 digits.
+*/
+  quotient0=dd0.hi/dd1.hi;
+  term.hi=quotient0;
+  term.lo=0.0f;
+  remainder=dyspoissometer_dd_sub(dd0, dyspoissometer_dd_mul(dd1, term));
+  quotient1=remainder.hi/dd1.hi;
+  term.hi=quotient1;
+  remainder=dyspoissometer_dd_sub(remainder, dyspoissometer_dd_mul(dd1, term));
+  quotient2=remainder.hi/dd1.hi;
+  quotient.hi=quotient0+quotient1;
+  quotient.lo=quotient1-(quotient.hi-quotient0);
+  term.hi=quotient2;
+  quotient=dyspoissometer_dd_add(quotient, term);
+  return quotient;
+}
+
+dyspoissometer_dd_t
+dyspoissometer_dd_from_u64(u64 u){
+/*
+Convert a u64 to a double-double.
+
+In:
+
+  u is the u64 to convert.
+
+Out:
+
+  Returns u as an exact double-double.
+*/
+  dyspoissometer_dd_t dd;
+  double u_hi;
+  double u_lo;
+
+/*
+The high 53 bits and low 11 bits of u are each exactly representable as a double. If u_hi is nonzero, then it exceeds u_lo, so Dekker's fast transformation is exact.
+*/
+  u_hi=(double)(u&~(u64)(0x7FF));
+  u_lo=(double)(u&0x7FF);
+  dd.hi=u_hi+u_lo;
+  dd.lo=u_lo-(dd.hi-u_hi);
+  return dd;
+}
+
+dyspoissometer_dd_t
+dyspoissometer_dd_exp(dyspoissometer_dd_t dd){
+/*
+Compute the natural exponential of a double-double.
+
+In:
+
+  dd is the exponent, such that the result is a normal double.
+
+Out:
+
+  Returns (e^dd) with relative error on the order of 2^(-100).
+*/
+  double exponent;
+  u8 i;
+  dyspoissometer_dd_t log_2;
+  dyspoissometer_dd_t one;
+  dyspoissometer_dd_t sum;
+  dyspoissometer_dd_t term;
+
+/*
+Reduce dd to ((k*ln(2))+(r*512)), where k is an integer and (|r|<=((ln 2)/1024)). Then e^dd is (2^k)*((e^r)^512).
+*/
+  exponent=round(dd.hi/DYSPOISSOMETER_DD_LOG_2_HI);
+  log_2.hi=DYSPOISSOMETER_DD_LOG_2_HI;
+  log_2.lo=DYSPOISSOMETER_DD_LOG_2_LO;
+  term.hi=exponent;
+  term.lo=0.0f;
+  term=dyspoissometer_dd_sub(dd, dyspoissometer_dd_mul(log_2, term));
+  term.hi=ldexp(term.hi, -9);
+  term.lo=ldexp(term.lo, -9);
+/*
+Set sum to ((e^r)-1) using Horner's method on the Taylor series, which converges to full precision after 9 terms because r is so small. Then square (sum+1) 9 times, using the identity (((s+1)^2)-1)=(s*(s+2)) in order to avoid cancellation.
+*/
+  one.hi=1.0f;
+  one.lo=0.0f;
+  sum=one;
+  i=9;
+  do{
+    sum=dyspoissometer_dd_mul(sum, term);
+    sum=dyspoissometer_dd_div(sum, dyspoissometer_dd_from_u64(i));
+    sum=dyspoissometer_dd_add(sum, one);
+  }while((--i)!=1);
+  sum=dyspoissometer_dd_mul(sum, term);
+  i=9;
+  do{
+    sum=dyspoissometer_dd_add(dyspoissometer_dd_add(sum, sum), dyspoissometer_dd_mul(sum, sum));
+  }while(--i);
+  sum=dyspoissometer_dd_add(sum, one);
+  sum.hi=ldexp(sum.hi, (int)(exponent));
+  sum.lo=ldexp(sum.lo, (int)(exponent));
+  return sum;
+}
+
+dyspoissometer_dd_t
+dyspoissometer_dd_log(dyspoissometer_dd_t dd){
+/*
+Compute the natural log of a double-double.
+
+In:
+
+  dd is the argument, which must be positive and normal.
+
+Out:
+
+  Returns ln(dd) with absolute error on the order of 2^(-100).
+*/
+  dyspoissometer_dd_t logarithm;
+  dyspoissometer_dd_t one;
+  dyspoissometer_dd_t term;
+
+/*
+Start with the double precision log, y, then perform one Newton iteration on (f(y)=(e^y)-dd), which doubles the number of correct bits: (y'=(y+(dd*(e^(-y)))-1)).
+*/
+  logarithm.hi=log(dd.hi);
+  logarithm.lo=0.0f;
+  one.hi=1.0f;
+  one.lo=0.0f;
+  term.hi=-logarithm.hi;
+  term.lo=0.0f;
+  term=dyspoissometer_dd_mul(dd, dyspoissometer_dd_exp(term));
+  logarithm=dyspoissometer_dd_add(logarithm, dyspoissometer_dd_sub(term, one));
+  return logarithm;
+}
+
+dyspoissometer_dd_t
+dyspoissometer_dd_sqrt(dyspoissometer_dd_t dd){
+/*
+Compute the square root of a double-double.
+
+In:
+
+  dd is the radicand, which must be nonnegative.
+
+Out:
+
+  Returns the square root of dd with relative error on the order of 2^(-104).
+*/
+  dyspoissometer_dd_t root;
+  dyspoissometer_dd_t term;
+
+  root=dd;
+  if(dd.hi!=0.0f){
+/*
+Start with the double precision root, y, then perform one Newton iteration on (f(y)=(y^2)-dd), which doubles the number of correct bits: (y'=(y+((dd-(y^2))/(2y)))). (y^2) is exact by virtue of dyspoissometer_dd_mul(), and the correction is so small relative to y that computing its quotient in double precision suffices.
+*/
+    root.hi=sqrt(dd.hi);
+    root.lo=0.0f;
+    term=dyspoissometer_dd_sub(dd, dyspoissometer_dd_mul(root, root));
+    term.hi/=root.hi+root.hi;
+    term.lo=0.0f;
+    root=dyspoissometer_dd_add(root, term);
+  }
+  return root;
+}
+
+dyspoissometer_dd_t
+dyspoissometer_dd_log_sum_get(u64 u){
+/*
+Compute the log of the factorial of a u64, which is the sum of the logs of all whole numbers up to it, hence the name, consistent with LOG_SUM().
+
+In:
+
+  u is the u64 whose factorial's log to compute.
+
+Out:
+
+  Returns ln(u!) with relative error on the order of 2^(-100).
+*/
+  u32 coeff_denominator_list[7]={12, 360, 1260, 1680, 1188, 360360, 156};
+  u8 coeff_idx;
+  u16 coeff_numerator_list[7]={1, 1, 1, 1, 1, 691, 1};
+  dyspoissometer_dd_t log_sum;
+  dyspoissometer_dd_t reciprocal;
+  dyspoissometer_dd_t reciprocal_squared;
+  dyspoissometer_dd_t sum;
+  dyspoissometer_dd_t term;
+  dyspoissometer_dd_t u_dd;
+  u64 v;
+
+  log_sum.hi=0.0f;
+  log_sum.lo=0.0f;
+  if(u<DYSPOISSOMETER_DD_LOG_SUM_STIRLING_MIN){
+    if(1<u){
+/*
+u! fits in a double-double without overflow, so compute it directly, which is exact for small u and accurate to the precision of a double-double thereafter.
+*/
+      sum=dyspoissometer_dd_from_u64(u);
+      v=u;
+      while((--v)!=1){
+        sum=dyspoissometer_dd_mul(sum, dyspoissometer_dd_from_u64(v));
+      }
+      log_sum=dyspoissometer_dd_log(sum);
+    }
+  }else{
+/*
+Use Stirling's series: (ln(u!)=((u+(1/2))*ln(u))-u+(ln(2*pi)/2)+(1/(12u))-(1/(360(u^3)))+...). With (DYSPOISSOMETER_DD_LOG_SUM_STIRLING_MIN<=u), the 7 terms of the tail given by coeff_numerator_list and coeff_denominator_list, with alternating signs, suffice for the precision of a double-double. Evaluate the tail by Horner's method in (1/(u^2)).
+*/
+    u_dd=dyspoissometer_dd_from_u64(u);
+    term.hi=1.0f;
+    term.lo=0.0f;
+    reciprocal=dyspoissometer_dd_div(term, u_dd);
+    reciprocal_squared=dyspoissometer_dd_mul(reciprocal, reciprocal);
+    sum.hi=0.0f;
+    sum.lo=0.0f;
+    coeff_idx=7;
+    do{
+      coeff_idx--;
+      term=dyspoissometer_dd_from_u64(coeff_numerator_list[coeff_idx]);
+      term=dyspoissometer_dd_div(term, dyspoissometer_dd_from_u64(coeff_denominator_list[coeff_idx]));
+      if(coeff_idx&1){
+        sum=dyspoissometer_dd_sub(sum, term);
+      }else{
+        sum=dyspoissometer_dd_add(sum, term);
+      }
+      if(coeff_idx){
+        sum=dyspoissometer_dd_mul(sum, reciprocal_squared);
+      }
+    }while(coeff_idx);
+    sum=dyspoissometer_dd_mul(sum, reciprocal);
+    term.hi=0.5f;
+    term.lo=0.0f;
+    log_sum=dyspoissometer_dd_mul(dyspoissometer_dd_add(u_dd, term), dyspoissometer_dd_log(u_dd));
+    log_sum=dyspoissometer_dd_sub(log_sum, u_dd);
+    term.hi=DYSPOISSOMETER_DD_HALF_LOG_2PI_HI;
+    term.lo=DYSPOISSOMETER_DD_HALF_LOG_2PI_LO;
+    log_sum=dyspoissometer_dd_add(log_sum, term);
+    log_sum=dyspoissometer_dd_add(log_sum, sum);
+  }
+  return log_sum;
+}
+
+dyspoissometer_dd_t
+dyspoissometer_logfreedom_nonzero_dd_get(DYSPOISSOMETER_UINT freq_idx_max, DYSPOISSOMETER_UINT *freq_list0_base, DYSPOISSOMETER_UINT *freq_list1_base, DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_max){
+/*
+Compute logfreedom from a list of nonzero frequencies using double-double arithmetic, regardless of DYSPOISSOMETER_NUMBER. This is what dyspoissometer_logfreedom_nonzero_get() does when DYSPOISSOMETER_NUMBER_DD is defined.
+
+In:
+
+  freq_idx_max is as defined in dyspoissometer_logfreedom_nonzero_get():In.
+
+  *freq_list0_base is as defined in dyspoissometer_logfreedom_nonzero_get():In.
+
+  *freq_list1_base is as defined in dyspoissometer_logfreedom_nonzero_get():In.
+
+  mask_idx_max is as defined in dyspoissometer_logfreedom_nonzero_get():In.
+
+  mask_max is as defined in dyspoissometer_logfreedom_nonzero_get():In.
+
+Out:
+
+  Returns the logfreedom of the population list implied by *freq_list0_base as a double-double, guaranteed to be nonnegative.
+
+  *freq_list0_base is sorted ascending.
 
   *freq_list1_base is undefined.
 */
   DYSPOISSOMETER_UINT freq0;
   DYSPOISSOMETER_UINT freq1;
-  DYSPOISSOMETER_UINT freq_idx_max;
   DYSPOISSOMETER_UINT freq_idx_min;
   DYSPOISSOMETER_UINT freq_idx0;
   DYSPOISSOMETER_UINT freq_idx1;
   DYSPOISSOMETER_UINT freq_idx2;
   DYSPOISSOMETER_UINT h0;
-  DYSPOISSOMETER_NUMBER logfreedom;
+  dyspoissometer_dd_t logfreedom;
+  DYSPOISSOMETER_UINT pop;
+  dyspoissometer_dd_t term;
+
+  logfreedom.hi=0.0f;
+  logfreedom.lo=0.0f;
+  if(mask_max){
+/*
+Set logfreedom to (LOG_SUM(Q)+LOG_SUM(Z)-LOG_SUM(h0)), as in dyspoissometer_logfreedom_nonzero_get(). (Z=(mask_max+1)) might wrap a u64, so compute LOG_SUM(Z) as (LOG_SUM(mask_max)+ln(Z)) instead.
+*/
+    logfreedom=dyspoissometer_dd_log_sum_get((u64)(mask_idx_max)+1);
+    logfreedom=dyspoissometer_dd_add(logfreedom, dyspoissometer_dd_log_sum_get(mask_max));
+    term.hi=1.0f;
+    term.lo=0.0f;
+    term=dyspoissometer_dd_add(dyspoissometer_dd_from_u64(mask_max), term);
+    logfreedom=dyspoissometer_dd_add(logfreedom, dyspoissometer_dd_log(term));
+    h0=(DYSPOISSOMETER_UINT)(mask_max-freq_idx_max);
+    logfreedom=dyspoissometer_dd_sub(logfreedom, dyspoissometer_dd_log_sum_get(h0));
+    dyspoissometer_uint_list_sort(freq_idx_max, freq_list0_base, freq_list1_base);
+    freq_idx_min=0;
+    do{
+      freq0=freq_list0_base[freq_idx_min];
+      freq_idx0=freq_idx_min;
+      freq_idx2=freq_idx_max;
+      while(freq_idx0!=freq_idx2){
+        freq_idx1=(DYSPOISSOMETER_UINT)(freq_idx2-((freq_idx2-freq_idx0)>>1));
+        freq1=freq_list0_base[freq_idx1];
+        if(freq0!=freq1){
+          freq_idx2=(DYSPOISSOMETER_UINT)(freq_idx1-1);
+        }else{
+          freq_idx0=freq_idx1;
+        }
+      }
+      freq_idx0++;
+      pop=(DYSPOISSOMETER_UINT)(freq_idx0-freq_idx_min);
+      freq_idx_min=freq_idx0;
+      term=dyspoissometer_dd_mul(dyspoissometer_dd_from_u64(pop), dyspoissometer_dd_log_sum_get(freq0));
+      term=dyspoissometer_dd_add(term, dyspoissometer_dd_log_sum_get(pop));
+      logfreedom=dyspoissometer_dd_sub(logfreedom, term);
+    }while(freq_idx_min<=freq_idx_max);
+    if(logfreedom.hi<=0.0f){
+/*
+logfreedom might be negative (or negative zero) due to numerical error, so flush it to zero.
+*/
+      logfreedom.hi=0.0f;
+      logfreedom.lo=0.0f;
+    }
+  }
+  return logfreedom;
+}
+
+dyspoissometer_dd_t
+dyspoissometer_logfreedom_sparse_dd_get(DYSPOISSOMETER_UINT *freq_list0_base, DYSPOISSOMETER_UINT *freq_list1_base, DYSPOISSOMETER_UINT mask_max){
+/*
+Compute logfreedom directly from a frequency list using double-double arithmetic, regardless of DYSPOISSOMETER_NUMBER. This is what dyspoissometer_logfreedom_sparse_get() does when DYSPOISSOMETER_NUMBER_DD is defined.
+
+In:
+
+  *freq_list0_base is as defined in dyspoissometer_logfreedom_sparse_get():In.
+
+  *freq_list1_base is as defined in dyspoissometer_logfreedom_sparse_get():In.
+
+  mask_max is as defined in dyspoissometer_logfreedom_sparse_get():In.
+
+Out:
+
+  Returns the logfreedom of the population list implied by *freq_list0_base as a double-double, guaranteed to be nonnegative.
+
+  *freq_list0_base is undefined.
+
+  *freq_list1_base is undefined.
+*/
+  DYSPOISSOMETER_UINT freq0;
+  DYSPOISSOMETER_UINT freq_idx_max;
+  dyspoissometer_dd_t logfreedom;
   DYSPOISSOMETER_UINT mask;
   DYSPOISSOMETER_UINT mask_idx_max;
-  DYSPOISSOMETER_UINT pop;
 
-  logfreedom=0.0f;
+  logfreedom.hi=0.0f;
+  logfreedom.lo=0.0f;
   if(mask_max){
     freq_idx_max=0;
     mask_idx_max=0;
     mask=0;
     do{
-/*
-Determine the number of nonzero frequencies at freq_list0_base.
-*/
       freq0=freq_list0_base[mask];
       if(freq0){
         freq_list1_base[freq_idx_max]=freq0;
@@ -394,6 +824,54 @@ Determine the number of nonzero frequencies at freq_list0_base.
     }while((mask++)!=mask_max);
     freq_idx_max--;
     mask_idx_max--;
+    logfreedom=dyspoissometer_logfreedom_nonzero_dd_get(freq_idx_max, freq_list1_base, freq_list0_base, mask_idx_max, mask_max);
+  }
+  return logfreedom;
+}
+
+DYSPOISSOMETER_NUMBER
+dyspoissometer_logfreedom_nonzero_get(DYSPOISSOMETER_UINT freq_idx_max, DYSPOISSOMETER_UINT *freq_list0_base, DYSPOISSOMETER_UINT *freq_list1_base, DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_max){
+/*
+Compute logfreedom from a list of only the nonzero frequencies, in any order. Memory usage thus scales with the number of distinct masks which actually occur, as opposed to the number of possible masks.
+
+In:
+
+  freq_idx_max is the number of nonzero frequencies at freq_list0_base, less one. On [0, mask_max].
+
+  *freq_list0_base contains (freq_idx_max+1) nonzero frequencies, one for each distinct mask which occurs, in any order. Their sum must be (mask_idx_max+1).
+
+  *freq_list1_base is undefined but writable for the same size as *freq_list0_base.
+
+  mask_idx_max is the number of masks, less one. On [0, DYSPOISSOMETER_UINT_MAX-1].
+
+  mask_max is the number of possible masks, whether or not they actually occur, less one.
+
+Out:
+
+  Returns the logfreedom of the population list implied by *freq_list0_base, guaranteed to be nonnegative.
+
+  *freq_list0_base is sorted ascending.
+
+  *freq_list1_base is undefined.
+*/
+#ifdef DYSPOISSOMETER_NUMBER_DD
+  dyspoissometer_dd_t logfreedom;
+
+  logfreedom=dyspoissometer_logfreedom_nonzero_dd_get(freq_idx_max, freq_list0_base, freq_list1_base, mask_idx_max, mask_max);
+  return logfreedom.hi;
+#else
+  DYSPOISSOMETER_UINT freq0;
+  DYSPOISSOMETER_UINT freq1;
+  DYSPOISSOMETER_UINT freq_idx_min;
+  DYSPOISSOMETER_UINT freq_idx0;
+  DYSPOISSOMETER_UINT freq_idx1;
+  DYSPOISSOMETER_UINT freq_idx2;
+  DYSPOISSOMETER_UINT h0;
+  DYSPOISSOMETER_NUMBER logfreedom;
+  DYSPOISSOMETER_UINT pop;
+
+  logfreedom=0.0f;
+  if(mask_max){
 /*
 Set logfreedom to its first 2 terms, namely (LOG_SUM(Q)+LOG_SUM(Z)).
 */
@@ -403,21 +881,21 @@ Set logfreedom to its first 2 terms, namely (LOG_SUM(Q)+LOG_SUM(Z)).
 Account for h0, the number of masks which do not occur.
 */
     logfreedom-=LOG_SUM(h0);
-    dyspoissometer_uint_list_sort(freq_idx_max, freq_list1_base, freq_list0_base);
+    dyspoissometer_uint_list_sort(freq_idx_max, freq_list0_base, freq_list1_base);
 /*
-*freq_list1_base has been sorted ascending by frequency and contains only nonzero values.
+*freq_list0_base has been sorted ascending by frequency and contains only nonzero values.
 */
     freq_idx_min=0;
     do{
-      freq0=freq_list1_base[freq_idx_min];
+      freq0=freq_list0_base[freq_idx_min];
       freq_idx0=freq_idx_min;
       freq_idx2=freq_idx_max;
 /*
-Set [freq_idx_min, freq_idx0] to the interval of indexes into freq_list1_base at which frequency freq0 occurs. For example, if (freq0==9) and *freq_list1_base={1, 1, 3, 3, 4, 9, 9, 9, 10}, then [freq_idx_min, freq_idx0] would be set to [5, 7]. We do this by binary searching for the last index, freq_idx0, at which frequency freq0 occurs. Note that the index math was carefully crafted to avoid wrap and guarantee loop termination.
+Set [freq_idx_min, freq_idx0] to the interval of indexes into freq_list0_base at which frequency freq0 occurs. For example, if (freq0==9) and *freq_list0_base={1, 1, 3, 3, 4, 9, 9, 9, 10}, then [freq_idx_min, freq_idx0] would be set to [5, 7]. We do this by binary searching for the last index, freq_idx0, at which frequency freq0 occurs. Note that the index math was carefully crafted to avoid wrap and guarantee loop termination.
 */
       while(freq_idx0!=freq_idx2){
         freq_idx1=(DYSPOISSOMETER_UINT)(freq_idx2-((freq_idx2-freq_idx0)>>1));
-        freq1=freq_list1_base[freq_idx1];
+        freq1=freq_list0_base[freq_idx1];
         if(freq0!=freq1){
           freq_idx2=(DYSPOISSOMETER_UINT)(freq_idx1-1);
         }else{
@@ -425,7 +903,7 @@ Set [freq_idx_min, freq_idx0] to the interval of indexes into freq_list1_base at
         }
       }
 /*
-freq_idx0 is the index of the last occurrence of freq0 at freq_list1_base, so the next greater index is the first occurrence of some frequency greater than freq0 (or the post index of freq_list1_base). Set pop to the population (H[i] in the logfreedom formula) of frequencies freq0, which is guaranteed to be nonzero (and cannot wrap, given the constraints imposed by In).
+freq_idx0 is the index of the last occurrence of freq0 at freq_list0_base, so the next greater index is the first occurrence of some frequency greater than freq0 (or the post index of freq_list0_base). Set pop to the population (H[i] in the logfreedom formula) of frequencies freq0, which is guaranteed to be nonzero (and cannot wrap, given the constraints imposed by In).
 */
       freq_idx0++;
       pop=(DYSPOISSOMETER_UINT)(freq_idx0-freq_idx_min);
@@ -440,42 +918,93 @@ logfreedom might be negative (or negative zero) due to numerical error, so flush
     }
   }
   return logfreedom;
+#endif
 }
 
 DYSPOISSOMETER_NUMBER
-dyspoissometer_logfreedom_dense_get(DYSPOISSOMETER_UINT freq_max_minus_1, DYSPOISSOMETER_UINT freq_min, DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_max, DYSPOISSOMETER_UINT *pop_list_base){
+dyspoissometer_logfreedom_sparse_get(DYSPOISSOMETER_UINT *freq_list0_base, DYSPOISSOMETER_UINT *freq_list1_base, DYSPOISSOMETER_UINT mask_max){
 /*
-Compute the logfreedom of a population list.
+Compute logfreedom directly from a frequency list (as opposed to a population list).
 
 In:
 
-  freq_max_minus_1 is one less than the maximum frequency represented at pop_list_base, on [freq_min, DYSPOISSOMETER_UINT_MAX-1].
+  *freq_list0_base contains (mask_max+1) items, each giving the frequency of the corresponding zero-based mask. The sum of all frequencies must be on [1, DYSPOISSOMETER_UINT_MAX].
 
-  freq_min is the minimum frequency represented at pop_list_base. Conventionally, a population list always begins with the population of frequency one. However, in practice, real world distributions tend to be concentrated in a small range of frequencies, and not scattered over all possible frequencies. For this reason, freq_min is provided so as to eliminate the overhead of leading zeroes. The populations of all frequencies outside [freq_min, freq_max_minus_1+1] _except_ the population h0 of frequency zero will be assumed to be zero; h0 is implied by mask_max and the sum of the nonzero populations.
+  *freq_list1_base is undefined but writable for the same size as *freq_list0_base.
 
-  mask_idx_max is one less than the sum-of-products N*pop_list_base[N-freq_min] where N is on [freq_min, freq_max_minus_1+1]. mask_idx_max itself is on [0, DYSPOISSOMETER_UINT_MAX-1].
+  mask_mask is the number of items at freq_list0_base, less one.
 
-  mask_max is the sum of all populations at pop_list_base which correspond to nonzero frequencies, plus (h0-1) -- in other words, the number of _possible_ masks, less one. Otherwise, all values are legal.
+Out:
 
-  pop_list_base is the base of (freq_max_minus_1-freq_min+2) items giving the populations of frequencies on [freq_min, freq_max_minus_1+1]. The sum of the populations must be (mask_max+1). The sum of (each population times its frequency) must be (mask_idx_max+1). May be readonly.
+  Returns the logfreedom of the population list implied by *freq_list0_base, guaranteed to be nonnegative.
 
-Out:
+  *freq_list0_base is undefined.
 
-  Returns logfreedom, guaranteed to be nonnegative.
+  *freq_list1_base is undefined.
 */
-  DYSPOISSOMETER_UINT freq;
-  DYSPOISSOMETER_UINT h0;
-  DYSPOISSOMETER_NUMBER log_sum;
+  DYSPOISSOMETER_UINT freq0;
+  DYSPOISSOMETER_UINT freq_idx_max;
   DYSPOISSOMETER_NUMBER logfreedom;
-  DYSPOISSOMETER_UINT mask_count;
-  DYSPOISSOMETER_UINT pop;
-  DYSPOISSOMETER_UINT pop_idx;
-  DYSPOISSOMETER_UINT pop_idx_max;
+  DYSPOISSOMETER_UINT mask;
+  DYSPOISSOMETER_UINT mask_idx_max;
 
   logfreedom=0.0f;
   if(mask_max){
+    freq_idx_max=0;
+    mask_idx_max=0;
+    mask=0;
+    do{
 /*
-Set logfreedom to its first 2 terms, namely (LOG_SUM(Q)+LOG_SUM(Z)).
+Determine the number of nonzero frequencies at freq_list0_base.
+*/
+      freq0=freq_list0_base[mask];
+      if(freq0){
+        freq_list1_base[freq_idx_max]=freq0;
+        freq_idx_max++;
+        mask_idx_max=(DYSPOISSOMETER_UINT)(mask_idx_max+freq0);
+      }
+    }while((mask++)!=mask_max);
+    freq_idx_max--;
+    mask_idx_max--;
+    logfreedom=dyspoissometer_logfreedom_nonzero_get(freq_idx_max, freq_list1_base, freq_list0_base, mask_idx_max, mask_max);
+  }
+  return logfreedom;
+}
+
+DYSPOISSOMETER_NUMBER
+dyspoissometer_logfreedom_dense_get(DYSPOISSOMETER_UINT freq_max_minus_1, DYSPOISSOMETER_UINT freq_min, DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_max, DYSPOISSOMETER_UINT *pop_list_base){
+/*
+Compute the logfreedom of a population list.
+
+In:
+
+  freq_max_minus_1 is one less than the maximum frequency represented at pop_list_base, on [freq_min, DYSPOISSOMETER_UINT_MAX-1].
+
+  freq_min is the minimum frequency represented at pop_list_base. Conventionally, a population list always begins with the population of frequency one. However, in practice, real world distributions tend to be concentrated in a small range of frequencies, and not scattered over all possible frequencies. For this reason, freq_min is provided so as to eliminate the overhead of leading zeroes. The populations of all frequencies outside [freq_min, freq_max_minus_1+1] _except_ the population h0 of frequency zero will be assumed to be zero; h0 is implied by mask_max and the sum of the nonzero populations.
+
+  mask_idx_max is one less than the sum-of-products N*pop_list_base[N-freq_min] where N is on [freq_min, freq_max_minus_1+1]. mask_idx_max itself is on [0, DYSPOISSOMETER_UINT_MAX-1].
+
+  mask_max is the sum of all populations at pop_list_base which correspond to nonzero frequencies, plus (h0-1) -- in other words, the number of _possible_ masks, less one. Otherwise, all values are legal.
+
+  pop_list_base is the base of (freq_max_minus_1-freq_min+2) items giving the populations of frequencies on [freq_min, freq_max_minus_1+1]. The sum of the populations must be (mask_max+1). The sum of (each population times its frequency) must be (mask_idx_max+1). May be readonly.
+
+Out:
+
+  Returns logfreedom, guaranteed to be nonnegative.
+*/
+  DYSPOISSOMETER_UINT freq;
+  DYSPOISSOMETER_UINT h0;
+  DYSPOISSOMETER_NUMBER log_sum;
+  DYSPOISSOMETER_NUMBER logfreedom;
+  DYSPOISSOMETER_UINT mask_count;
+  DYSPOISSOMETER_UINT pop;
+  DYSPOISSOMETER_UINT pop_idx;
+  DYSPOISSOMETER_UINT pop_idx_max;
+
+  logfreedom=0.0f;
+  if(mask_max){
+/*
+Set logfreedom to its first 2 terms, namely (LOG_SUM(Q)+LOG_SUM(Z)).
 */
     mask_count=(DYSPOISSOMETER_UINT)(mask_idx_max+1);
     logfreedom=LOG_SUM(mask_count);
@@ -588,6 +1117,113 @@ Do some CYA for horrendous precision problems (and negative zero baloney) that s
   }
   return dyspoissonism;
 }
+DYSPOISSOMETER_NUMBER
+dyspoissometer_dyspoissonism_dd_get(dyspoissometer_dd_t logfreedom, DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_max){
+/*
+Given precomputed logfreedom as a double-double, compute dyspoissonism using double-double arithmetic, which avoids the loss of precision inherent in (1-(logfreedom/(Q log(Z)))) when dyspoissonism is small.
+
+In:
+
+  logfreedom is the return value of dyspoissometer_logfreedom_sparse_dd_get().
+
+  mask_idx_max is as defined in dyspoissometer_dyspoissonism_get():In.
+
+  mask_max is as defined in dyspoissometer_dyspoissonism_get():In.
+
+Out:
+
+  Returns as defined in dyspoissometer_dyspoissonism_get():Out.
+*/
+  dyspoissometer_dd_t dyspoissonism;
+  dyspoissometer_dd_t mask_count_x_log_mask_span;
+  dyspoissometer_dd_t one;
+
+  dyspoissonism.hi=0.0f;
+  if(mask_idx_max&&mask_max){
+    one.hi=1.0f;
+    one.lo=0.0f;
+    mask_count_x_log_mask_span=dyspoissometer_dd_log(dyspoissometer_dd_add(dyspoissometer_dd_from_u64(mask_max), one));
+    mask_count_x_log_mask_span=dyspoissometer_dd_mul(mask_count_x_log_mask_span, dyspoissometer_dd_from_u64((u64)(mask_idx_max)+1));
+    if(logfreedom.hi<mask_count_x_log_mask_span.hi){
+      dyspoissonism=dyspoissometer_dd_sub(mask_count_x_log_mask_span, logfreedom);
+      dyspoissonism=dyspoissometer_dd_div(dyspoissonism, mask_count_x_log_mask_span);
+      if(dyspoissonism.hi<=0.0f){
+        dyspoissonism.hi=0.0f;
+      }else if(1.0f<dyspoissonism.hi){
+        dyspoissonism.hi=1.0f;
+      }
+    }
+  }
+  return (DYSPOISSOMETER_NUMBER)(dyspoissonism.hi);
+}
+
+
+DYSPOISSOMETER_NUMBER
+dyspoissometer_u64_freq_list_logfreedom_get(DYSPOISSOMETER_NUMBER *dyspoissonism_base, u64 *freq_list_base, u64 mask_max){
+/*
+Compute logfreedom and dyspoissonism from a frequency list of (u64)s, regardless of the width of DYSPOISSOMETER_UINT. This allows callers which accumulate frequencies in fixed-width counters to use any precision, most notably via dyspoissometer_any_u64_freq_list_logfreedom_get().
+
+In:
+
+  *dyspoissonism_base is undefined.
+
+  *freq_list_base contains (mask_max+1) items, each giving the frequency of the corresponding zero-based mask.
+
+  mask_max is the number of items at freq_list_base, less one.
+
+Out:
+
+  Returns a rational but otherwise undefined negative value if we ran out of memory, mask_max exceeds DYSPOISSOMETER_UINT_MAX, or the sum of all frequencies is not on [1, DYSPOISSOMETER_UINT_MAX]; else the logfreedom of the population list implied by *freq_list_base, guaranteed to be nonnegative.
+
+  *dyspoissonism_base is the corresponding dyspoissonism if the return value is nonnegative, else zero.
+*/
+  u64 freq;
+  DYSPOISSOMETER_UINT *freq_list0_base;
+  DYSPOISSOMETER_UINT *freq_list1_base;
+  DYSPOISSOMETER_NUMBER dyspoissonism;
+  DYSPOISSOMETER_NUMBER logfreedom;
+#ifdef DYSPOISSOMETER_NUMBER_DD
+  dyspoissometer_dd_t logfreedom_dd;
+#endif
+  u64 mask;
+  u64 mask_count;
+  u8 overflow_status;
+
+  dyspoissonism=0.0f;
+  logfreedom=-1.0f;
+  if(mask_max<=DYSPOISSOMETER_UINT_MAX){
+    freq_list0_base=dyspoissometer_uint_list_malloc((DYSPOISSOMETER_UINT)(mask_max));
+    freq_list1_base=dyspoissometer_uint_list_malloc((DYSPOISSOMETER_UINT)(mask_max));
+    if(freq_list0_base&&freq_list1_base){
+/*
+Convert *freq_list_base to DYSPOISSOMETER_UINT while ensuring that the implied mask count fits.
+*/
+      mask=0;
+      mask_count=0;
+      overflow_status=0;
+      do{
+        freq=freq_list_base[mask];
+        mask_count+=freq;
+        overflow_status=(u8)(overflow_status|(mask_count<freq)|(DYSPOISSOMETER_UINT_MAX<mask_count));
+        freq_list0_base[mask]=(DYSPOISSOMETER_UINT)(freq);
+      }while((mask++)!=mask_max);
+      if(mask_count&&!overflow_status){
+#ifdef DYSPOISSOMETER_NUMBER_DD
+        logfreedom_dd=dyspoissometer_logfreedom_sparse_dd_get(freq_list0_base, freq_list1_base, (DYSPOISSOMETER_UINT)(mask_max));
+        logfreedom=logfreedom_dd.hi;
+        dyspoissonism=dyspoissometer_dyspoissonism_dd_get(logfreedom_dd, (DYSPOISSOMETER_UINT)(mask_count-1), (DYSPOISSOMETER_UINT)(mask_max));
+#else
+        logfreedom=dyspoissometer_logfreedom_sparse_get(freq_list0_base, freq_list1_base, (DYSPOISSOMETER_UINT)(mask_max));
+        dyspoissonism=dyspoissometer_dyspoissonism_get(logfreedom, (DYSPOISSOMETER_UINT)(mask_count-1), (DYSPOISSOMETER_UINT)(mask_max));
+#endif
+      }
+    }
+    dyspoissometer_free(freq_list1_base);
+    dyspoissometer_free(freq_list0_base);
+  }
+  *dyspoissonism_base=dyspoissonism;
+  return logfreedom;
+}
 
 DYSPOISSOMETER_NUMBER
 dyspoissometer_sparsity_get(DYSPOISSOMETER_NUMBER logfreedom, DYSPOISSOMETER_NUMBER logfreedom_max){
@@ -701,6 +1337,324 @@ Return mask_count_implied for use on the next call. It's on [1, DYSPOISSOMETER_U
   return autoscale_status;
 }
 
+DYSPOISSOMETER_UINT *
+dyspoissometer_freq_list_lane_malloc_zero(u8 burst_status, u8 *lane_idx_max_base, DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_max){
+/*
+Allocate and zero a frequency list suitable for dyspoissometer_freq_list_accrue(), consisting of multiple interleaved sub-histograms ("lanes"), but only if that would be profitable.
+
+Successive masks which are equal (as is common with bursty data such as timedeltas) cause a single-lane histogram to increment the same counter twice in a row, so the second increment must wait for the first to make its way through the store-to-load forwarding path. By rotating successive masks among multiple lanes, the increments become independent. The price is the cost of merging them with dyspoissometer_freq_list_merge() and, more importantly, the larger cache footprint, which makes lanes slower than a single list for large random mask lists.
+
+In:
+
+  burst_status is one if successive masks are expected to be equal more often than not, in which case lanes are used for mask_max up to DYSPOISSOMETER_FREQ_LANE_MASK_MAX. Otherwise zero, in which case lanes are used only if they fit in DYSPOISSOMETER_FREQ_LANE_SIZE_MAX bytes.
+
+  *lane_idx_max_base is undefined.
+
+  mask_idx_max is the number of masks which will be accrued, less one. Lanes are not used unless this exceeds mask_max.
+
+  mask_max is as defined in dyspoissometer_freq_list_get():In.
+
+Out:
+
+  Returns NULL if lanes would not be profitable or we ran out of memory, in which case the caller should accrue to a single-lane frequency list of its own. Otherwise, returns the base of a list of ((DYSPOISSOMETER_FREQ_LANE_IDX_MAX+1)*(mask_max+1)) zeroes, wherein lane N begins at (N*(mask_max+1)).
+
+  *lane_idx_max_base is DYSPOISSOMETER_FREQ_LANE_IDX_MAX, or zero if the return value is NULL.
+*/
+  DYSPOISSOMETER_UINT *freq_list_base;
+  u8 lane_idx_max;
+  DYSPOISSOMETER_UINT lane_mask_max;
+
+  freq_list_base=NULL;
+  lane_idx_max=0;
+  lane_mask_max=(DYSPOISSOMETER_UINT)((DYSPOISSOMETER_FREQ_LANE_SIZE_MAX>>(DYSPOISSOMETER_FREQ_LANE_COUNT_LOG2+DYSPOISSOMETER_UINT_SIZE_LOG2))-1);
+  if(burst_status){
+    lane_mask_max=DYSPOISSOMETER_FREQ_LANE_MASK_MAX;
+  }
+  if((mask_max<=lane_mask_max)&&(mask_max<mask_idx_max)){
+    freq_list_base=dyspoissometer_uint_list_malloc_zero((DYSPOISSOMETER_UINT)((DYSPOISSOMETER_UINT)(mask_max<<DYSPOISSOMETER_FREQ_LANE_COUNT_LOG2)+DYSPOISSOMETER_FREQ_LANE_IDX_MAX));
+    if(freq_list_base){
+      lane_idx_max=DYSPOISSOMETER_FREQ_LANE_IDX_MAX;
+    }
+  }
+  *lane_idx_max_base=lane_idx_max;
+  return freq_list_base;
+}
+
+void
+dyspoissometer_u24_list_unpack(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u8 *u24_list_base, u32 *u32_list_base){
+/*
+Unpack a block of packed u24 masks into a list of (u32)s, so that the kernels which consume them can run at u32 speed.
+
+In:
+
+  mask_idx_max is the index of the last mask to unpack. On [mask_idx_min, DYSPOISSOMETER_UINT_MAX-1].
+
+  mask_idx_min is the index of the first mask to unpack.
+
+  u24_list_base is the base of a list of (mask_idx_max+1) (u24)s. Note that their alignment is U8_SIZE, not U32_SIZE.
+
+  *u32_list_base is writable for (mask_idx_max-mask_idx_min+1) (u32)s.
+
+Out:
+
+  *u32_list_base contains (mask_idx_max-mask_idx_min+1) (u32)s, each on [0, U24_MAX], which are the masks at u24_list_base from index mask_idx_min through mask_idx_max, inclusive.
+*/
+  u8 *u8_list_base;
+  ULONG u32_idx;
+  ULONG u32_idx_max;
+  u32 word0;
+  u32 word1;
+  u32 word2;
+  ULONG word_triplet_count;
+
+  u8_list_base=&u24_list_base[(ULONG)(mask_idx_min)*3];
+  u32_idx=0;
+  u32_idx_max=(ULONG)((DYSPOISSOMETER_UINT)(mask_idx_max-mask_idx_min));
+  word_triplet_count=(u32_idx_max+1)>>2;
+/*
+Every 4 masks occupy 12 bytes, or 3 little endian (u32)s. Assemble those 3 words, which the compiler can usually reduce to 3 loads, then redistribute their bytes to 4 masks using only shifts and masks. Unpack the remaining masks one at a time.
+*/
+  while(word_triplet_count--){
+    word0=(u32)((u32)(u8_list_base[0])|((u32)(u8_list_base[1])<<U8_BITS)|((u32)(u8_list_base[2])<<U16_BITS)|((u32)(u8_list_base[3])<<U24_BITS));
+    word1=(u32)((u32)(u8_list_base[4])|((u32)(u8_list_base[5])<<U8_BITS)|((u32)(u8_list_base[6])<<U16_BITS)|((u32)(u8_list_base[7])<<U24_BITS));
+    word2=(u32)((u32)(u8_list_base[8])|((u32)(u8_list_base[9])<<U8_BITS)|((u32)(u8_list_base[10])<<U16_BITS)|((u32)(u8_list_base[11])<<U24_BITS));
+    u32_list_base[u32_idx]=word0&U24_MAX;
+    u32_list_base[u32_idx+1]=(word0>>U24_BITS)|((word1&U16_MAX)<<U8_BITS);
+    u32_list_base[u32_idx+2]=(word1>>U16_BITS)|((word2&U8_MAX)<<U16_BITS);
+    u32_list_base[u32_idx+3]=word2>>U8_BITS;
+    u32_idx+=4;
+    u8_list_base=&u8_list_base[12];
+  }
+  while(u32_idx<=u32_idx_max){
+    u32_list_base[u32_idx]=(u32)((u32)(u8_list_base[2])<<U16_BITS)+(u16)((u16)(u8_list_base[1])<<U8_BITS)+u8_list_base[0];
+    u32_idx++;
+    u8_list_base=&u8_list_base[3];
+  }
+  return;
+}
+
+void
+dyspoissometer_freq_list_accrue(DYSPOISSOMETER_UINT *freq_list_base, u8 lane_idx_max, DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, DYSPOISSOMETER_UINT mask_max, u16 *u16_list_base, u8 *u24_list_base, u32 *u32_list_base, u8 *u8_list_base, DYSPOISSOMETER_UINT *uint_list_base){
+/*
+Accrue a mask list onto a frequency list, which may consist of multiple lanes.
+
+In:
+
+  freq_list_base is the non(NULL) return value of dyspoissometer_freq_list_lane_malloc_zero(), or the base of a single-lane frequency list, which may contain preexisting frequencies. The sum of all preexisting frequencies plus (mask_idx_max-mask_idx_min+1) must not exceed DYSPOISSOMETER_UINT_MAX.
+
+  lane_idx_max is the number of lanes at freq_list_base, less one. This is the value which dyspoissometer_freq_list_lane_malloc_zero() returned in *lane_idx_max_base if freq_list_base came from there, else zero.
+
+  mask_idx_max is as defined in dyspoissometer_uint_list_logfreedom_get():In.
+
+  mask_idx_min is as defined in dyspoissometer_uint_list_logfreedom_get():In.
+
+  mask_max is as defined in dyspoissometer_freq_list_get():In.
+
+  Exactly one of the following must be non(NULL):
+
+    u16_list_base is as defined in dyspoissometer_uint_list_logfreedom_get():In.
+
+    u24_list_base is as defined in dyspoissometer_uint_list_logfreedom_get():In.
+
+    u32_list_base is as defined in dyspoissometer_uint_list_logfreedom_get():In.
+
+    u8_list_base is as defined in dyspoissometer_uint_list_logfreedom_get():In.
+
+    uint_list_base is the base of a list of (mask_idx_max+1) (DYSPOISSOMETER_UINT)s on [0, mask_max].
+
+Out:
+
+  *freq_list_base has been incremented once for each mask in the given list, spread across lanes. Call dyspoissometer_freq_list_merge() to obtain a single-lane frequency list.
+*/
+  DYSPOISSOMETER_UINT *freq_list0_base;
+  DYSPOISSOMETER_UINT *freq_list1_base;
+  DYSPOISSOMETER_UINT *freq_list2_base;
+  DYSPOISSOMETER_UINT *freq_list3_base;
+  DYSPOISSOMETER_UINT mask0;
+  DYSPOISSOMETER_UINT mask1;
+  DYSPOISSOMETER_UINT mask2;
+  DYSPOISSOMETER_UINT mask3;
+  DYSPOISSOMETER_UINT mask_idx;
+  DYSPOISSOMETER_UINT mask_idx_max_block;
+  DYSPOISSOMETER_UINT quad_count;
+  u32 u32_block_base[DYSPOISSOMETER_U24_BLOCK_IDX_MAX+1];
+
+/*
+Accrue 4 masks at a time, one to each lane. With a single lane, all 4 lane bases are the same, which is still correct, and as fast as accruing one mask at a time. Then accrue the remaining masks to the first lane.
+*/
+  freq_list0_base=freq_list_base;
+  freq_list1_base=freq_list_base;
+  freq_list2_base=freq_list_base;
+  freq_list3_base=freq_list_base;
+  if(lane_idx_max){
+    freq_list1_base=&freq_list0_base[(DYSPOISSOMETER_UINT)(mask_max+1)];
+    freq_list2_base=&freq_list1_base[(DYSPOISSOMETER_UINT)(mask_max+1)];
+    freq_list3_base=&freq_list2_base[(DYSPOISSOMETER_UINT)(mask_max+1)];
+  }
+  mask_idx=mask_idx_min;
+  quad_count=(DYSPOISSOMETER_UINT)((DYSPOISSOMETER_UINT)(mask_idx_max-mask_idx_min+1)>>2);
+  if(u8_list_base){
+    while(quad_count--){
+      mask0=u8_list_base[mask_idx];
+      mask1=u8_list_base[mask_idx+1];
+      mask2=u8_list_base[mask_idx+2];
+      mask3=u8_list_base[mask_idx+3];
+      freq_list0_base[mask0]++;
+      freq_list1_base[mask1]++;
+      freq_list2_base[mask2]++;
+      freq_list3_base[mask3]++;
+      mask_idx=(DYSPOISSOMETER_UINT)(mask_idx+4);
+    }
+    while(mask_idx<=mask_idx_max){
+      mask0=u8_list_base[mask_idx];
+      freq_list0_base[mask0]++;
+      mask_idx++;
+    }
+  }else if(u16_list_base){
+    while(quad_count--){
+      mask0=u16_list_base[mask_idx];
+      mask1=u16_list_base[mask_idx+1];
+      mask2=u16_list_base[mask_idx+2];
+      mask3=u16_list_base[mask_idx+3];
+      freq_list0_base[mask0]++;
+      freq_list1_base[mask1]++;
+      freq_list2_base[mask2]++;
+      freq_list3_base[mask3]++;
+      mask_idx=(DYSPOISSOMETER_UINT)(mask_idx+4);
+    }
+    while(mask_idx<=mask_idx_max){
+      mask0=u16_list_base[mask_idx];
+      freq_list0_base[mask0]++;
+      mask_idx++;
+    }
+  }else if(u24_list_base){
+/*
+Unpack the masks a block at a time, then accrue each block as (u32)s.
+*/
+    do{
+      mask_idx_max_block=mask_idx_max;
+      if(DYSPOISSOMETER_U24_BLOCK_IDX_MAX<(DYSPOISSOMETER_UINT)(mask_idx_max-mask_idx)){
+        mask_idx_max_block=(DYSPOISSOMETER_UINT)(mask_idx+DYSPOISSOMETER_U24_BLOCK_IDX_MAX);
+      }
+      dyspoissometer_u24_list_unpack(mask_idx_max_block, mask_idx, u24_list_base, u32_block_base);
+      dyspoissometer_freq_list_accrue(freq_list_base, lane_idx_max, (DYSPOISSOMETER_UINT)(mask_idx_max_block-mask_idx), 0, mask_max, NULL, NULL, u32_block_base, NULL, NULL);
+      mask_idx=(DYSPOISSOMETER_UINT)(mask_idx_max_block+1);
+    }while(mask_idx_max_block!=mask_idx_max);
+  }else if(u32_list_base){
+    while(quad_count--){
+      mask0=(DYSPOISSOMETER_UINT)(u32_list_base[mask_idx]);
+      mask1=(DYSPOISSOMETER_UINT)(u32_list_base[mask_idx+1]);
+      mask2=(DYSPOISSOMETER_UINT)(u32_list_base[mask_idx+2]);
+      mask3=(DYSPOISSOMETER_UINT)(u32_list_base[mask_idx+3]);
+      freq_list0_base[mask0]++;
+      freq_list1_base[mask1]++;
+      freq_list2_base[mask2]++;
+      freq_list3_base[mask3]++;
+      mask_idx=(DYSPOISSOMETER_UINT)(mask_idx+4);
+    }
+    while(mask_idx<=mask_idx_max){
+      mask0=(DYSPOISSOMETER_UINT)(u32_list_base[mask_idx]);
+      freq_list0_base[mask0]++;
+      mask_idx++;
+    }
+  }else{
+    while(quad_count--){
+      mask0=uint_list_base[mask_idx];
+      mask1=uint_list_base[mask_idx+1];
+      mask2=uint_list_base[mask_idx+2];
+      mask3=uint_list_base[mask_idx+3];
+      freq_list0_base[mask0]++;
+      freq_list1_base[mask1]++;
+      freq_list2_base[mask2]++;
+      freq_list3_base[mask3]++;
+      mask_idx=(DYSPOISSOMETER_UINT)(mask_idx+4);
+    }
+    while(mask_idx<=mask_idx_max){
+      mask0=uint_list_base[mask_idx];
+      freq_list0_base[mask0]++;
+      mask_idx++;
+    }
+  }
+  return;
+}
+
+void
+dyspoissometer_freq_list_merge(DYSPOISSOMETER_UINT *freq_list_base, u8 lane_idx_max, DYSPOISSOMETER_UINT mask_max){
+/*
+Merge all lanes of a frequency list into the first one.
+
+In:
+
+  freq_list_base is as defined in dyspoissometer_freq_list_accrue():In.
+
+  lane_idx_max is as defined in dyspoissometer_freq_list_accrue():In.
+
+  mask_max is as defined in dyspoissometer_freq_list_get():In.
+
+Out:
+
+  The first (mask_max+1) items at freq_list_base constitute the sum of all lanes, which is a single-lane frequency list. Other lanes are undefined.
+*/
+  DYSPOISSOMETER_UINT *freq_list1_base;
+  DYSPOISSOMETER_UINT *freq_list2_base;
+  DYSPOISSOMETER_UINT *freq_list3_base;
+  DYSPOISSOMETER_UINT mask;
+
+  if(lane_idx_max){
+    freq_list1_base=&freq_list_base[(DYSPOISSOMETER_UINT)(mask_max+1)];
+    freq_list2_base=&freq_list1_base[(DYSPOISSOMETER_UINT)(mask_max+1)];
+    freq_list3_base=&freq_list2_base[(DYSPOISSOMETER_UINT)(mask_max+1)];
+/*
+This is a simple elementwise sum of disjoint lists, which the compiler can vectorize.
+*/
+    mask=0;
+    do{
+      freq_list_base[mask]=(DYSPOISSOMETER_UINT)(freq_list_base[mask]+freq_list1_base[mask]+freq_list2_base[mask]+freq_list3_base[mask]);
+    }while((mask++)!=mask_max);
+  }
+  return;
+}
+
+void
+dyspoissometer_freq_list_lane_get(DYSPOISSOMETER_UINT *freq_list_base, u8 lane_idx_max, DYSPOISSOMETER_UINT *lane_list_base, DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT *mask_list_base, DYSPOISSOMETER_UINT mask_max){
+/*
+Fill out a frequency list as with dyspoissometer_freq_list_get(), but using lanes allocated by the caller, so that a caller which fills out many frequency lists, such as a Monte Carlo loop, can allocate them only once.
+
+In:
+
+  freq_list_base is as defined in dyspoissometer_freq_list_get():In.
+
+  lane_idx_max is as defined in dyspoissometer_freq_list_accrue():In. Ignored if lane_list_base is NULL.
+
+  lane_list_base is the return value of dyspoissometer_freq_list_lane_malloc_zero() with the same mask_idx_max and mask_max, or NULL to accrue directly to *freq_list_base. Its contents are undefined.
+
+  mask_idx_max is as defined in dyspoissometer_freq_list_get():In.
+
+  mask_list_base is as defined in dyspoissometer_freq_list_get():In.
+
+  mask_max is as defined in dyspoissometer_freq_list_get():In.
+
+Out:
+
+  *freq_list_base is as defined in dyspoissometer_freq_list_get():Out.
+
+  *lane_list_base is undefined.
+*/
+  if(lane_list_base){
+    dyspoissometer_uint_list_zero((DYSPOISSOMETER_UINT)((DYSPOISSOMETER_UINT)(mask_max<<DYSPOISSOMETER_FREQ_LANE_COUNT_LOG2)+DYSPOISSOMETER_FREQ_LANE_IDX_MAX), lane_list_base);
+    dyspoissometer_freq_list_accrue(lane_list_base, lane_idx_max, mask_idx_max, 0, mask_max, NULL, NULL, NULL, NULL, mask_list_base);
+    dyspoissometer_freq_list_merge(lane_list_base, lane_idx_max, mask_max);
+    dyspoissometer_uint_list_copy(mask_max, 0, 0, lane_list_base, freq_list_base);
+  }else{
+/*
+Lanes are unprofitable or we ran out of memory for them, so accrue directly to *freq_list_base.
+*/
+    dyspoissometer_uint_list_zero(mask_max, freq_list_base);
+    dyspoissometer_freq_list_accrue(freq_list_base, 0, mask_idx_max, 0, mask_max, NULL, NULL, NULL, NULL, mask_list_base);
+  }
+  return;
+}
+
 void
 dyspoissometer_freq_list_get(DYSPOISSOMETER_UINT *freq_list_base, DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT *mask_list_base, DYSPOISSOMETER_UINT mask_max){
 /*
@@ -720,14 +1674,15 @@ Out:
 
   *freq_list_base is consistent with *mask_list_base. Its total is mask_idx_max+1.
 */
-  DYSPOISSOMETER_UINT mask;
-  DYSPOISSOMETER_UINT mask_idx;
+  u8 lane_idx_max;
+  DYSPOISSOMETER_UINT *lane_list_base;
 
-  dyspoissometer_uint_list_zero(mask_max, freq_list_base);
-  for(mask_idx=0; mask_idx<=mask_idx_max; mask_idx++){
-    mask=mask_list_base[mask_idx];
-    freq_list_base[mask]++;
-  }
+/*
+This allocates lanes on every call. Callers in a loop should call dyspoissometer_freq_list_lane_get() instead.
+*/
+  lane_list_base=dyspoissometer_freq_list_lane_malloc_zero(0, &lane_idx_max, mask_idx_max, mask_max);
+  dyspoissometer_freq_list_lane_get(freq_list_base, lane_idx_max, lane_list_base, mask_idx_max, mask_list_base, mask_max);
+  dyspoissometer_free(lane_list_base);
   return;
 }
 
@@ -915,76 +1870,175 @@ Had we attempted to compute poisson directly, the factorial would have cost huge
   return poisson;
 }
 
-DYSPOISSOMETER_NUMBER
-dyspoissometer_logfreedom_max_get(u64 iteration_max, DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_max, u64 *random_seed_base){
+u8
+dyspoissometer_chain_init(dyspoissometer_chain_t *chain_base, DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_max, u64 random_seed){
 /*
-Approximate the maximum logfreedom possible with a population list having an implied mask count of (mask_idx_max+1) and an implied mask count of (mask_max+1). The same could be done by finding a discrete Poisson distribution consistent with those constraints, but this approach seems to work better with less code complexity, yielding larger logfreedom especially at low mask counts or mask spans. It may be more computationally expensive, however.
-
-In some cases, it may be faster to generate mask lists using dyspoissometer_mask_list_pseudorandom_get(), and just compute the logfreedom repeatedly in order to approximate the maximum thereof. However, in the general case, such mask lists would exhaust available memory.
-
-Therefore, we use a Monte Carlo method involving piecemeal gradient riding with noise injection to prevent settling onto local maxima. Essentially, we maintain a neighboring pair of "up" frequencies, where the left transfers one population unit to the right; and a neighboring pair of "down" frequencies which do the opposite. "Up" and "down" neighbors are allowed to overlap at a single frequency so that the middle population changes by 2 while the outside populations change by one; in most cases, however, we have 4 disjoint frequencies, in which case all populations change by one. This technique permits us to perform minimal changes, in the sense of the population changes which would occur if only a single mask in a mask set were changed. We perform such a minimal change whether or not it is profitable, merely for the sake of avoiding the trap of local maxima. But if indeed the change proves to be profitable, then we ride a gradient whose first derivative is monotonic in order to find the number of such minimal changes which maximize the resulting increase in logfreedom. This process continues through a specified number of iterations, whereupon the maximum result is returned.
+Initialize a chain, which is a single instance of the gradient riding process described in dyspoissometer_logfreedom_max_get().
 
 In:
 
-  mask_idx_max is the maximum mask index, on [0, DYSPOISSOMETER_UINT_MAX-1].
+  *chain_base is undefined.
 
-  iteration_max is the number of iterations to run, less one. Note that unlike dyspoissometer_logfreedom_median_get(), this is a u64, not a DYSPOISSOMETER_UINT. Experimentation is the only way to determine its significance with respect to accuracy.
+  mask_idx_max is as defined in dyspoissometer_logfreedom_max_get():In, but on [3, DYSPOISSOMETER_UINT_MAX-1].
 
-  mask_max is the maximum possible mask value. Unlike with other Dyspoissometer functions, no restriction is placed on it.
+  mask_max is as defined in dyspoissometer_logfreedom_max_get():In, but at least 2.
 
-  *random_seed_base facilitates easy parallelization (for example, by using Spawn to create many copies of this function). On [1, ((DYSPOISSOMETER_MARSAGLIA_A-1)<<U32_BITS)+U32_MAX-1].
+  random_seed is as defined for *random_seed_base in dyspoissometer_logfreedom_max_get():In.
 
 Out:
 
-  Returns a rational but otherwise undefined negative value if we ran out of memory; else an approximation of maximum logfreedom, guaranteed to be nonnegative. On success, the return value is virtually certain to be less than the infinitely accurate maximum logfreedom, not the least of which because logfreedom is irrational, but also because it is derived from a population set consistent with the input constraints, which may not happen to have maximum logfreedom despite having been evolved for such.
+  Returns one if we ran out of memory, else zero. In either case, *chain_base must eventually be freed by dyspoissometer_chain_free().
 
-  *random_seed_base contains an updated random seed.
+  *chain_base is ready for use by dyspoissometer_chain_iterate().
 */
-  DYSPOISSOMETER_UINT freq_down_right;
-  DYSPOISSOMETER_NUMBER freq_expression;
   DYSPOISSOMETER_UINT freq_max;
-  DYSPOISSOMETER_UINT freq_max_best;
-  DYSPOISSOMETER_UINT freq_max_minus_1;
   DYSPOISSOMETER_UINT freq_min;
-  DYSPOISSOMETER_UINT freq_min_best;
+  DYSPOISSOMETER_UINT lambda;
+  DYSPOISSOMETER_UINT lambda_plus_1;
+  DYSPOISSOMETER_UINT lambda_x_mask_span;
+  DYSPOISSOMETER_UINT mask_count;
+  DYSPOISSOMETER_UINT mask_span;
+  u8 overflow_status;
+  DYSPOISSOMETER_UINT pop_idx_lambda;
+  DYSPOISSOMETER_UINT pop_idx_lambda_plus_1;
+  DYSPOISSOMETER_UINT pop_idx_max;
+  DYSPOISSOMETER_UINT pop_lambda;
+  DYSPOISSOMETER_UINT pop_lambda_plus_1;
+  DYSPOISSOMETER_UINT *pop_list_base;
+  DYSPOISSOMETER_UINT *pop_list_best_base;
+
+  mask_count=(DYSPOISSOMETER_UINT)(mask_idx_max+1);
+  mask_span=(DYSPOISSOMETER_UINT)(mask_max+1);
+  lambda=0;
+/*
+Create an initial distribution at frequencies lambda and (lambda+1) in order to comply with mask_count and mask_span (where the latter might have wrapped). Although this is obviously far from the maximum logfreedom, it gives us a starting point from which zero-sum transfers will still be in constraint compliance.
+*/
+  pop_lambda=(DYSPOISSOMETER_UINT)(mask_span-mask_count);
+  pop_lambda_plus_1=mask_count;
+  if(mask_span){
+    lambda=mask_count/mask_span;
+    lambda_x_mask_span=(DYSPOISSOMETER_UINT)(lambda*mask_span);
+    pop_lambda=(DYSPOISSOMETER_UINT)(pop_lambda+lambda_x_mask_span);
+    pop_lambda_plus_1=(DYSPOISSOMETER_UINT)(pop_lambda_plus_1-lambda_x_mask_span);
+  }
+  pop_lambda=(DYSPOISSOMETER_UINT)(mask_span-pop_lambda_plus_1);
+/*
+Frequencies will be on [freq_min, freq_max], where pop_idx_max is always (freq_max-freq_min).
+*/
+  pop_idx_max=3;
+  freq_max=pop_idx_max;
+  freq_min=0;
+/*
+pop_idx_max needs to be large enough to accomodate frequency (lambda+1) with population pop_lambda_plus_1 followed by frequency (lambda+2) with population zero. (lambda+2) won't wrap because (lambda<DYSPOISSOMETER_UINT_SPAN_HALF).
+*/
+  lambda_plus_1=(DYSPOISSOMETER_UINT)(lambda+1);
+  if(pop_idx_max<=lambda_plus_1){
+    freq_max=(DYSPOISSOMETER_UINT)(lambda_plus_1+1);
+    freq_min=(DYSPOISSOMETER_UINT)(lambda-1);
+  }
+  pop_list_base=dyspoissometer_uint_list_malloc_zero(pop_idx_max);
+  pop_list_best_base=dyspoissometer_uint_list_malloc_zero(pop_idx_max);
+  overflow_status=1;
+  pop_idx_lambda=(DYSPOISSOMETER_UINT)(lambda-freq_min);
+  pop_idx_lambda_plus_1=(DYSPOISSOMETER_UINT)(lambda_plus_1-freq_min);
+  if(pop_list_base&&pop_list_best_base){
+    overflow_status=0;
+    pop_list_base[pop_idx_lambda]=pop_lambda;
+    pop_list_base[pop_idx_lambda_plus_1]=pop_lambda_plus_1;
+    pop_list_best_base[pop_idx_lambda]=pop_lambda;
+    pop_list_best_base[pop_idx_lambda_plus_1]=pop_lambda_plus_1;
+  }
+  chain_base->freq_max=freq_max;
+  chain_base->freq_max_best=freq_max;
+  chain_base->freq_min=freq_min;
+  chain_base->freq_min_best=freq_min;
+  chain_base->iteration=0;
+  chain_base->iteration_count_minus_1=0;
+  chain_base->iteration_last_change=0;
+/*
+logfreedom_delta_sum will be the sum of the logfreedom deltas due to each individual transfer. When it goes positive, it's time to record a new "best" population list, from which the final logfreedom will be evaluated.
+*/
+  chain_base->logfreedom_delta_sum=0.0f;
+  chain_base->marsaglia_p=random_seed;
+  chain_base->mask_idx_max=mask_idx_max;
+  chain_base->mask_max=mask_max;
+  chain_base->overflow_status=overflow_status;
+  chain_base->pop_idx_max=pop_idx_max;
+  chain_base->pop_idx_max_best=pop_idx_max;
+  chain_base->pop_list_base=pop_list_base;
+  chain_base->pop_list_best_base=pop_list_best_base;
+  chain_base->pop_nonzero_idx_max=pop_idx_lambda_plus_1;
+  chain_base->pop_nonzero_idx_max_best=pop_idx_lambda_plus_1;
+  chain_base->pop_nonzero_idx_min=pop_idx_lambda;
+  chain_base->pop_nonzero_idx_min_best=pop_idx_lambda;
+  chain_base->pop_nonzero_idx_span=2;
+  return overflow_status;
+}
+
+void
+dyspoissometer_chain_free(dyspoissometer_chain_t *chain_base){
+/*
+Free the population lists owned by a chain.
+
+In:
+
+  *chain_base is as returned by dyspoissometer_chain_init(), regardless of success.
+
+Out:
+
+  The population lists of *chain_base have been freed, and the corresponding pointers set to NULL.
+*/
+  chain_base->pop_list_best_base=dyspoissometer_free(chain_base->pop_list_best_base);
+  chain_base->pop_list_base=dyspoissometer_free(chain_base->pop_list_base);
+  return;
+}
+
+void
+dyspoissometer_chain_iterate(dyspoissometer_chain_t *chain_base, u64 iteration_count_minus_1){
+/*
+Advance a chain through a given number of iterations of the gradient riding process described in dyspoissometer_logfreedom_max_get().
+
+In:
+
+  *chain_base is as returned by dyspoissometer_chain_init(), dyspoissometer_chain_copy(), or a previous call to this function, all of which must have left (chain_base->overflow_status==0).
+
+  iteration_count_minus_1 is the number of iterations to perform, less one.
+
+Out:
+
+  *chain_base has been advanced. If (chain_base->overflow_status==1), then we ran out of memory and *chain_base is only good for dyspoissometer_chain_free().
+*/
+  DYSPOISSOMETER_UINT freq_down_right;
+  DYSPOISSOMETER_NUMBER freq_expression;
+  DYSPOISSOMETER_UINT freq_max;
+  DYSPOISSOMETER_UINT freq_max_best;
+  DYSPOISSOMETER_UINT freq_min;
+  DYSPOISSOMETER_UINT freq_min_best;
   DYSPOISSOMETER_UINT freq_min_delta;
   DYSPOISSOMETER_UINT freq_up_left;
   u64 iteration;
   u64 iteration_last_change;
-  DYSPOISSOMETER_UINT lambda;
-  DYSPOISSOMETER_UINT lambda_plus_1;
-  DYSPOISSOMETER_UINT lambda_x_mask_span;
+  u64 iteration_max;
   DYSPOISSOMETER_NUMBER logfreedom_delta;
   DYSPOISSOMETER_NUMBER logfreedom_delta_delta;
   DYSPOISSOMETER_NUMBER logfreedom_delta_sum;
-  DYSPOISSOMETER_NUMBER logfreedom_max;
   u32 marsaglia_c;
   u64 marsaglia_p;
   u32 marsaglia_x;
-  DYSPOISSOMETER_UINT mask_count;
-  DYSPOISSOMETER_UINT mask_count_part0;
-  DYSPOISSOMETER_UINT mask_count_part1;
-  DYSPOISSOMETER_UINT mask_span;
   u8 overflow_status;
-  DYSPOISSOMETER_UINT pop;
   DYSPOISSOMETER_UINT pop_delta;
   DYSPOISSOMETER_UINT pop_delta_max;
   DYSPOISSOMETER_UINT pop_delta_max_minus_1;
   DYSPOISSOMETER_UINT pop_delta_min;
   DYSPOISSOMETER_UINT pop_down_left;
   DYSPOISSOMETER_UINT pop_down_right;
-  DYSPOISSOMETER_UINT pop_idx;
   DYSPOISSOMETER_UINT pop_idx_count_half;
   DYSPOISSOMETER_UINT pop_idx_delta;
   DYSPOISSOMETER_UINT pop_idx_down;
-  DYSPOISSOMETER_UINT pop_idx_lambda;
-  DYSPOISSOMETER_UINT pop_idx_lambda_plus_1;
   DYSPOISSOMETER_UINT pop_idx_max;
   DYSPOISSOMETER_UINT pop_idx_max_best;
   DYSPOISSOMETER_UINT pop_idx_max_old;
   DYSPOISSOMETER_UINT pop_idx_up;
-  DYSPOISSOMETER_UINT pop_lambda;
-  DYSPOISSOMETER_UINT pop_lambda_plus_1;
   DYSPOISSOMETER_UINT *pop_list_base;
   DYSPOISSOMETER_UINT *pop_list_base_new;
   DYSPOISSOMETER_UINT *pop_list_best_base;
@@ -997,135 +2051,96 @@ Out:
   DYSPOISSOMETER_UINT pop_up_right;
   u64 u64_product_hi;
 
+  freq_max=chain_base->freq_max;
+  freq_max_best=chain_base->freq_max_best;
+  freq_min=chain_base->freq_min;
+  freq_min_best=chain_base->freq_min_best;
+  iteration=chain_base->iteration;
+  iteration_last_change=chain_base->iteration_last_change;
+  logfreedom_delta_sum=chain_base->logfreedom_delta_sum;
+  marsaglia_p=chain_base->marsaglia_p;
   overflow_status=0;
-  logfreedom_max=0.0f;
-  if((2<mask_idx_max)&&(1<mask_max)){
-    overflow_status=1;
-    mask_count=(DYSPOISSOMETER_UINT)(mask_idx_max+1);
-    mask_span=(DYSPOISSOMETER_UINT)(mask_max+1);
-    lambda=0;
-/*
-Create an initial distribution at frequencies lambda and (lambda+1) in order to comply with mask_count and mask_span (where the latter might have wrapped). Although this is obviously far from the maximum logfreedom, it gives us a starting point from which zero-sum transfers will still be in constraint compliance.
-*/
-    pop_lambda=(DYSPOISSOMETER_UINT)(mask_span-mask_count);
-    pop_lambda_plus_1=mask_count;
-    if(mask_span){
-      lambda=mask_count/mask_span;
-      lambda_x_mask_span=(DYSPOISSOMETER_UINT)(lambda*mask_span);
-      pop_lambda=(DYSPOISSOMETER_UINT)(pop_lambda+lambda_x_mask_span);
-      pop_lambda_plus_1=(DYSPOISSOMETER_UINT)(pop_lambda_plus_1-lambda_x_mask_span);
-    }
-    pop_lambda=(DYSPOISSOMETER_UINT)(mask_span-pop_lambda_plus_1);
-/*
-Frequencies will be on [freq_min, freq_max], where pop_idx_max is always (freq_max-freq_min).
-*/
-    pop_idx_max=3;
-    pop_idx_max_best=pop_idx_max;
-    freq_max=pop_idx_max;
-    freq_min=0;
-/*
-pop_idx_max needs to be large enough to accomodate frequency (lambda+1) with population pop_lambda_plus_1 followed by frequency (lambda+2) with population zero. (lambda+2) won't wrap because (lambda<DYSPOISSOMETER_UINT_SPAN_HALF).
-*/
-    lambda_plus_1=(DYSPOISSOMETER_UINT)(lambda+1);
-    if(pop_idx_max<=lambda_plus_1){
-      freq_max=(DYSPOISSOMETER_UINT)(lambda_plus_1+1);
-      freq_min=(DYSPOISSOMETER_UINT)(lambda-1);
-    }
-    freq_max_best=freq_max;
-    freq_min_best=freq_min;
-    pop_list_base=dyspoissometer_uint_list_malloc_zero(pop_idx_max);
-    pop_list_best_base=dyspoissometer_uint_list_malloc_zero(pop_idx_max);
-    if(pop_list_base&&pop_list_best_base){
-      overflow_status=0;
-      pop_idx_lambda=(DYSPOISSOMETER_UINT)(lambda-freq_min);
-      pop_idx_lambda_plus_1=(DYSPOISSOMETER_UINT)(lambda_plus_1-freq_min);
-      pop_list_base[pop_idx_lambda]=pop_lambda;
-      pop_list_base[pop_idx_lambda_plus_1]=pop_lambda_plus_1;
-      pop_list_best_base[pop_idx_lambda]=pop_lambda;
-      pop_list_best_base[pop_idx_lambda_plus_1]=pop_lambda_plus_1;
-      pop_nonzero_idx_max=pop_idx_lambda_plus_1;
-      pop_nonzero_idx_max_best=pop_idx_lambda_plus_1;
-      pop_nonzero_idx_min=pop_idx_lambda;
-      pop_nonzero_idx_min_best=pop_idx_lambda;
-      pop_nonzero_idx_span=2;
-/*
-logfreedom_delta_sum will be the sum of the logfreedom deltas due to each individual transfer. When it goes positive, it's time to record a new "best" population list, from which the final logfreedom will be evaluated.
-*/
-      logfreedom_delta_sum=0.0f;
-      marsaglia_p=*random_seed_base;
-      pop_down_left=0;
-      pop_down_right=0;
-      pop_up_left=0;
-      pop_up_right=0;
-      iteration=0;
-      iteration_last_change=0;
-      do{
+  pop_idx_max=chain_base->pop_idx_max;
+  pop_idx_max_best=chain_base->pop_idx_max_best;
+  pop_list_base=chain_base->pop_list_base;
+  pop_list_best_base=chain_base->pop_list_best_base;
+  pop_nonzero_idx_max=chain_base->pop_nonzero_idx_max;
+  pop_nonzero_idx_max_best=chain_base->pop_nonzero_idx_max_best;
+  pop_nonzero_idx_min=chain_base->pop_nonzero_idx_min;
+  pop_nonzero_idx_min_best=chain_base->pop_nonzero_idx_min_best;
+  pop_nonzero_idx_span=chain_base->pop_nonzero_idx_span;
+  iteration_max=iteration+iteration_count_minus_1;
+  pop_down_left=0;
+  pop_down_right=0;
+  pop_up_left=0;
+  pop_up_right=0;
+  do{
 /*
 Use the largest available 64-bit Marsaglia oscillator to produce random pairs (pop_idx_down, pop_idx_up), corresponding to the move-down and move-up indexes into the population list, respectively. The multiplication is kind of disgusting, and the pseudorandom sequence is somewhat biased, but it doesn't matter for our purposes here.
 */
-        do{
-          do{
-            marsaglia_c=(u32)(marsaglia_p>>U32_BITS);
-            marsaglia_x=(u32)(marsaglia_p);
-            marsaglia_p=((u64)(marsaglia_x)*DYSPOISSOMETER_MARSAGLIA_A)+marsaglia_c;
-            U64_PRODUCT_HI(marsaglia_p, (u64)(pop_nonzero_idx_span), u64_product_hi);
-            pop_idx_down=(DYSPOISSOMETER_UINT)(u64_product_hi+pop_nonzero_idx_min);
-            pop_down_right=pop_list_base[pop_idx_down];
-          }while(!(pop_down_right&&(pop_idx_down|freq_min)));
-          do{
-            marsaglia_c=(u32)(marsaglia_p>>U32_BITS);
-            marsaglia_x=(u32)(marsaglia_p);
-            marsaglia_p=((u64)(marsaglia_x)*DYSPOISSOMETER_MARSAGLIA_A)+marsaglia_c;
-            U64_PRODUCT_HI(marsaglia_p, (u64)(pop_nonzero_idx_span), u64_product_hi);
-            pop_idx_up=(DYSPOISSOMETER_UINT)(u64_product_hi+pop_nonzero_idx_min);
-            pop_up_left=pop_list_base[pop_idx_up];
-            pop_idx_delta=(DYSPOISSOMETER_UINT)(pop_idx_down-pop_idx_up);
-          }while((!pop_up_left)||((!pop_idx_delta)&&(pop_up_left==1)));
+    do{
+      do{
+        marsaglia_c=(u32)(marsaglia_p>>U32_BITS);
+        marsaglia_x=(u32)(marsaglia_p);
+        marsaglia_p=((u64)(marsaglia_x)*DYSPOISSOMETER_MARSAGLIA_A)+marsaglia_c;
+        U64_PRODUCT_HI(marsaglia_p, (u64)(pop_nonzero_idx_span), u64_product_hi);
+        pop_idx_down=(DYSPOISSOMETER_UINT)(u64_product_hi+pop_nonzero_idx_min);
+        pop_down_right=pop_list_base[pop_idx_down];
+      }while(!(pop_down_right&&(pop_idx_down|freq_min)));
+      do{
+        marsaglia_c=(u32)(marsaglia_p>>U32_BITS);
+        marsaglia_x=(u32)(marsaglia_p);
+        marsaglia_p=((u64)(marsaglia_x)*DYSPOISSOMETER_MARSAGLIA_A)+marsaglia_c;
+        U64_PRODUCT_HI(marsaglia_p, (u64)(pop_nonzero_idx_span), u64_product_hi);
+        pop_idx_up=(DYSPOISSOMETER_UINT)(u64_product_hi+pop_nonzero_idx_min);
+        pop_up_left=pop_list_base[pop_idx_up];
+        pop_idx_delta=(DYSPOISSOMETER_UINT)(pop_idx_down-pop_idx_up);
+      }while((!pop_up_left)||((!pop_idx_delta)&&(pop_up_left==1)));
 /*
 If (pop_idx_delta==1), we're trying to exchange population units between 2 frequencies, which could result in a stuck state, in which case we need to start over with a new pop_idx_down.
 */
-        }while(pop_idx_delta==1);
-        if((!pop_idx_down)||(pop_idx_up==pop_idx_max)){
+    }while(pop_idx_delta==1);
+    if((!pop_idx_down)||(pop_idx_up==pop_idx_max)){
 /*
 We're attempting to slide off the left or right side of the distribution. If the former, then we already guaranteed above that we're not trying to move below frequency zero. So attempt to expand pop_list_base accordingly, in particular, by a factor of 2 so as to minimize memory map entropy.
 */
-          pop_idx_max_old=pop_idx_max;
-          pop_idx_count_half=(DYSPOISSOMETER_UINT)((pop_idx_max>>1)+1);
+      pop_idx_max_old=pop_idx_max;
+      pop_idx_count_half=(DYSPOISSOMETER_UINT)((pop_idx_max>>1)+1);
 /*
 Adjust [freq_min, freq_max] to fit this new interval size.
 */
-          freq_max=(DYSPOISSOMETER_UINT)(freq_max+pop_idx_count_half);
-          freq_min_delta=freq_min;
-          freq_min=(DYSPOISSOMETER_UINT)(freq_min-pop_idx_count_half);
+      freq_max=(DYSPOISSOMETER_UINT)(freq_max+pop_idx_count_half);
+      freq_min_delta=freq_min;
+      freq_min=(DYSPOISSOMETER_UINT)(freq_min-pop_idx_count_half);
 /*
 Set pop_idx_max to a power of 2, less one. It will never wrap because the highest possible frequency is DYSPOISSOMETER_UINT_MAX, so we would never be required to expand beyond that based on the while() conditions above.
 */
-          pop_idx_max=(DYSPOISSOMETER_UINT)((DYSPOISSOMETER_UINT)(pop_idx_max<<1)+1);
-          if(((freq_min+pop_idx_count_half)<pop_idx_count_half)||(freq_max<pop_idx_count_half)){
-            freq_max=pop_idx_max;
-            freq_min=0;
-          }
-          freq_min_delta=(DYSPOISSOMETER_UINT)(freq_min_delta-freq_min);
-          pop_list_base_new=dyspoissometer_uint_list_malloc_zero(pop_idx_max);
-          if(!pop_list_base_new){
-            overflow_status=1;
-            break;
-          }
+      pop_idx_max=(DYSPOISSOMETER_UINT)((DYSPOISSOMETER_UINT)(pop_idx_max<<1)+1);
+      if(((freq_min+pop_idx_count_half)<pop_idx_count_half)||(freq_max<pop_idx_count_half)){
+        freq_max=pop_idx_max;
+        freq_min=0;
+      }
+      freq_min_delta=(DYSPOISSOMETER_UINT)(freq_min_delta-freq_min);
+      pop_list_base_new=dyspoissometer_uint_list_malloc_zero(pop_idx_max);
+      if(!pop_list_base_new){
+        overflow_status=1;
+        break;
+      }
 /*
 Copy the old population list to its appropriate place (usually, the middle) in the corresponding new list. Adjust (pop_idx_down, pop_idx_up) accordingly.
 */
-          dyspoissometer_uint_list_copy(pop_idx_max_old, 0, freq_min_delta, pop_list_base, pop_list_base_new);
-          dyspoissometer_free(pop_list_base);
-          pop_list_base=pop_list_base_new;
-          pop_idx_down=(DYSPOISSOMETER_UINT)(pop_idx_down+freq_min_delta);
-          pop_idx_up=(DYSPOISSOMETER_UINT)(pop_idx_up+freq_min_delta);
-          pop_nonzero_idx_max=(DYSPOISSOMETER_UINT)(pop_nonzero_idx_max+freq_min_delta);
-          pop_nonzero_idx_min=(DYSPOISSOMETER_UINT)(pop_nonzero_idx_min+freq_min_delta);
-        }
-        pop_down_left=pop_list_base[pop_idx_down-1];
-        pop_up_right=pop_list_base[pop_idx_up+1];
-        freq_down_right=(DYSPOISSOMETER_UINT)(pop_idx_down+freq_min);
-        freq_up_left=(DYSPOISSOMETER_UINT)(pop_idx_up+freq_min);
+      dyspoissometer_uint_list_copy(pop_idx_max_old, 0, freq_min_delta, pop_list_base, pop_list_base_new);
+      dyspoissometer_free(pop_list_base);
+      pop_list_base=pop_list_base_new;
+      pop_idx_down=(DYSPOISSOMETER_UINT)(pop_idx_down+freq_min_delta);
+      pop_idx_up=(DYSPOISSOMETER_UINT)(pop_idx_up+freq_min_delta);
+      pop_nonzero_idx_max=(DYSPOISSOMETER_UINT)(pop_nonzero_idx_max+freq_min_delta);
+      pop_nonzero_idx_min=(DYSPOISSOMETER_UINT)(pop_nonzero_idx_min+freq_min_delta);
+    }
+    pop_down_left=pop_list_base[pop_idx_down-1];
+    pop_up_right=pop_list_base[pop_idx_up+1];
+    freq_down_right=(DYSPOISSOMETER_UINT)(pop_idx_down+freq_min);
+    freq_up_left=(DYSPOISSOMETER_UINT)(pop_idx_up+freq_min);
 /*
 We now have pop_down_left, pop_down_right, pop_up_left, and pop_up_right, which are the populations of frequencies (freq_down_right-1), freq_down_right, freq_up_left, and (freq_up_left+1), respectively. We're going to move at least one population unit from freq_down_right to (freq_down_right-1), and simultaneously from freq_up_left to (freq_up_left+1), thereby maintaining both the implied mask count and the implied mask span. We will do this regardless of whether or not doing so increases the logfreedom of *pop_list_base (because otherwise we might get stuck a local maximum which is not the global maximum). However, it's possible that moving pop_delta population units -- instead of just one -- in this zero-sum manner would increase the logfreedom even more. So if we force pop_delta to be at least one, then its optimum value (which results in maximum logfreedom) must exist on [1, MIN(pop_down_right, pop_up_left)] if (freq_down_right!=freq_up_left), or [1, pop_down_right>>1] otherwise.
 
@@ -1215,1760 +2230,4407 @@ Having said all that, we will use multiplication and division to accelerate the
 
 The following code uses logfreedom_delta and logfreedom_delta_delta to compute the value of pop_delta which induces the most positive change in logfreedom_delta (which might still be negative):
 */
-        freq_expression=LOG((DYSPOISSOMETER_NUMBER)(freq_down_right)/(DYSPOISSOMETER_UINT)(freq_up_left+1));
-        logfreedom_delta=freq_expression-LOG((DYSPOISSOMETER_NUMBER)(pop_down_left+1));
+    freq_expression=LOG((DYSPOISSOMETER_NUMBER)(freq_down_right)/(DYSPOISSOMETER_UINT)(freq_up_left+1));
+    logfreedom_delta=freq_expression-LOG((DYSPOISSOMETER_NUMBER)(pop_down_left+1));
 /*
 Handle each of the aforementioned 3 possible "up" and "down" interaction topologies, with the most likely first.
 */
-        if(2<pop_idx_delta){
-          logfreedom_delta+=LOG((DYSPOISSOMETER_NUMBER)(pop_down_right)*pop_up_left/(DYSPOISSOMETER_UINT)(pop_up_right+1));
-        }else if(!pop_idx_delta){
-          logfreedom_delta+=LOG((DYSPOISSOMETER_NUMBER)(pop_down_right-1)*pop_down_right/(DYSPOISSOMETER_UINT)(pop_up_right+1));
-        }else{
-          logfreedom_delta-=LOG((DYSPOISSOMETER_NUMBER)(pop_down_left+2)/((DYSPOISSOMETER_NUMBER)(pop_down_right)*pop_up_left));
-        }
-        pop_delta_max=MIN(pop_down_right, pop_up_left);
-        if(pop_idx_down==pop_idx_up){
-          pop_delta_max>>=1;
-        }
-        pop_delta_min=1;
+    if(2<pop_idx_delta){
+      logfreedom_delta+=LOG((DYSPOISSOMETER_NUMBER)(pop_down_right)*pop_up_left/(DYSPOISSOMETER_UINT)(pop_up_right+1));
+    }else if(!pop_idx_delta){
+      logfreedom_delta+=LOG((DYSPOISSOMETER_NUMBER)(pop_down_right-1)*pop_down_right/(DYSPOISSOMETER_UINT)(pop_up_right+1));
+    }else{
+      logfreedom_delta-=LOG((DYSPOISSOMETER_NUMBER)(pop_down_left+2)/((DYSPOISSOMETER_NUMBER)(pop_down_right)*pop_up_left));
+    }
+    pop_delta_max=MIN(pop_down_right, pop_up_left);
+    if(pop_idx_down==pop_idx_up){
+      pop_delta_max>>=1;
+    }
+    pop_delta_min=1;
 /*
 Set pop_delta_max_minus_1 to (pop_delta_max-1) because we can't evaluate logfreedom_delta_delta at pop_delta_max because it's a discrete first derivative, meaning that it's the difference of 2 neighboring sample points, so we need to bound our search accordingly.
 */
-        pop_delta_max_minus_1=(DYSPOISSOMETER_UINT)(pop_delta_max-pop_delta_min);
-        if(pop_delta_max_minus_1){
+    pop_delta_max_minus_1=(DYSPOISSOMETER_UINT)(pop_delta_max-pop_delta_min);
+    if(pop_delta_max_minus_1){
+      logfreedom_delta_delta=freq_expression;
+      if(2<pop_idx_delta){
+        logfreedom_delta_delta-=LOG((DYSPOISSOMETER_NUMBER)(pop_down_left+2)*(DYSPOISSOMETER_UINT)(pop_up_right+2)/((DYSPOISSOMETER_NUMBER)(pop_down_right-1)*(DYSPOISSOMETER_UINT)(pop_up_left-1)));
+      }else if(!pop_idx_delta){
+        logfreedom_delta_delta-=LOG((DYSPOISSOMETER_NUMBER)(pop_down_left+2)*(DYSPOISSOMETER_UINT)(pop_up_right+2)/((DYSPOISSOMETER_NUMBER)(pop_down_right-3)*(DYSPOISSOMETER_UINT)(pop_down_right-2)));
+      }else{
+        logfreedom_delta_delta-=LOG((DYSPOISSOMETER_NUMBER)(pop_down_left+3)*(DYSPOISSOMETER_UINT)(pop_down_left+4)/((DYSPOISSOMETER_NUMBER)(pop_down_right-1)*(DYSPOISSOMETER_UINT)(pop_up_left-1)));
+      }
+/*
+If the discrete derivative of logfreedom_delta is positive, then we should binary search for the apex of the inverted "U". Otherwise stick with (pop_delta_min==1) because there is no improvement to be found.
+*/
+      if(0.0f<logfreedom_delta_delta){
+        while(pop_delta_max_minus_1!=pop_delta_min){
+          pop_delta=(DYSPOISSOMETER_UINT)(pop_delta_max_minus_1-((pop_delta_max_minus_1-pop_delta_min)>>1));
           logfreedom_delta_delta=freq_expression;
           if(2<pop_idx_delta){
-            logfreedom_delta_delta-=LOG((DYSPOISSOMETER_NUMBER)(pop_down_left+2)*(DYSPOISSOMETER_UINT)(pop_up_right+2)/((DYSPOISSOMETER_NUMBER)(pop_down_right-1)*(DYSPOISSOMETER_UINT)(pop_up_left-1)));
+            logfreedom_delta_delta-=LOG((DYSPOISSOMETER_NUMBER)((DYSPOISSOMETER_UINT)(pop_down_left+pop_delta)+1)*(DYSPOISSOMETER_UINT)((DYSPOISSOMETER_UINT)(pop_up_right+pop_delta)+1)/((DYSPOISSOMETER_NUMBER)(pop_down_right-pop_delta)*(DYSPOISSOMETER_UINT)(pop_up_left-pop_delta)));
           }else if(!pop_idx_delta){
-            logfreedom_delta_delta-=LOG((DYSPOISSOMETER_NUMBER)(pop_down_left+2)*(DYSPOISSOMETER_UINT)(pop_up_right+2)/((DYSPOISSOMETER_NUMBER)(pop_down_right-3)*(DYSPOISSOMETER_UINT)(pop_down_right-2)));
+            logfreedom_delta_delta-=LOG((DYSPOISSOMETER_NUMBER)((DYSPOISSOMETER_UINT)(pop_down_left+pop_delta)+1)*(DYSPOISSOMETER_UINT)((DYSPOISSOMETER_UINT)(pop_up_right+pop_delta)+1)/((DYSPOISSOMETER_NUMBER)((DYSPOISSOMETER_UINT)(pop_down_right-(DYSPOISSOMETER_UINT)(pop_delta<<1))-1)*(DYSPOISSOMETER_UINT)(pop_down_right-(DYSPOISSOMETER_UINT)(pop_delta<<1))));
           }else{
-            logfreedom_delta_delta-=LOG((DYSPOISSOMETER_NUMBER)(pop_down_left+3)*(DYSPOISSOMETER_UINT)(pop_down_left+4)/((DYSPOISSOMETER_NUMBER)(pop_down_right-1)*(DYSPOISSOMETER_UINT)(pop_up_left-1)));
+            logfreedom_delta_delta-=LOG((DYSPOISSOMETER_NUMBER)((DYSPOISSOMETER_UINT)(pop_down_left+(DYSPOISSOMETER_UINT)(pop_delta<<1))+1)*(DYSPOISSOMETER_UINT)((DYSPOISSOMETER_UINT)(pop_down_left+(pop_delta<<1))+2)/((DYSPOISSOMETER_NUMBER)(pop_down_right-pop_delta)*(DYSPOISSOMETER_UINT)(pop_up_left-pop_delta)));
           }
-/*
-If the discrete derivative of logfreedom_delta is positive, then we should binary search for the apex of the inverted "U". Otherwise stick with (pop_delta_min==1) because there is no improvement to be found.
-*/
           if(0.0f<logfreedom_delta_delta){
-            while(pop_delta_max_minus_1!=pop_delta_min){
-              pop_delta=(DYSPOISSOMETER_UINT)(pop_delta_max_minus_1-((pop_delta_max_minus_1-pop_delta_min)>>1));
-              logfreedom_delta_delta=freq_expression;
-              if(2<pop_idx_delta){
-                logfreedom_delta_delta-=LOG((DYSPOISSOMETER_NUMBER)((DYSPOISSOMETER_UINT)(pop_down_left+pop_delta)+1)*(DYSPOISSOMETER_UINT)((DYSPOISSOMETER_UINT)(pop_up_right+pop_delta)+1)/((DYSPOISSOMETER_NUMBER)(pop_down_right-pop_delta)*(DYSPOISSOMETER_UINT)(pop_up_left-pop_delta)));
-              }else if(!pop_idx_delta){
-                logfreedom_delta_delta-=LOG((DYSPOISSOMETER_NUMBER)((DYSPOISSOMETER_UINT)(pop_down_left+pop_delta)+1)*(DYSPOISSOMETER_UINT)((DYSPOISSOMETER_UINT)(pop_up_right+pop_delta)+1)/((DYSPOISSOMETER_NUMBER)((DYSPOISSOMETER_UINT)(pop_down_right-(DYSPOISSOMETER_UINT)(pop_delta<<1))-1)*(DYSPOISSOMETER_UINT)(pop_down_right-(DYSPOISSOMETER_UINT)(pop_delta<<1))));
-              }else{
-                logfreedom_delta_delta-=LOG((DYSPOISSOMETER_NUMBER)((DYSPOISSOMETER_UINT)(pop_down_left+(DYSPOISSOMETER_UINT)(pop_delta<<1))+1)*(DYSPOISSOMETER_UINT)((DYSPOISSOMETER_UINT)(pop_down_left+(pop_delta<<1))+2)/((DYSPOISSOMETER_NUMBER)(pop_down_right-pop_delta)*(DYSPOISSOMETER_UINT)(pop_up_left-pop_delta)));
-              }
-              if(0.0f<logfreedom_delta_delta){
-                pop_delta_min=pop_delta;
-              }else{
-                pop_delta_max_minus_1=(DYSPOISSOMETER_UINT)(pop_delta-1);
-              }
-            }
+            pop_delta_min=pop_delta;
+          }else{
+            pop_delta_max_minus_1=(DYSPOISSOMETER_UINT)(pop_delta-1);
+          }
+        }
 /*
 logfreedom_delta_delta is positive, so go with the righthand pop_delta instead of the lefthand one.
 */
-            pop_delta_min++;
-          }
-        }
-        pop_delta=pop_delta_min;
+        pop_delta_min++;
+      }
+    }
+    pop_delta=pop_delta_min;
 /*
 Evaluate the logfreedom_delta, now that we've found the optimal pop_delta.
 */
-        logfreedom_delta=LOG_SUM(pop_down_left)+LOG_SUM(pop_down_right)+(pop_delta*freq_expression);
-        if(2<pop_idx_delta){
-          logfreedom_delta+=LOG_SUM(pop_up_left)+LOG_SUM(pop_up_right);
-          pop_down_left=(DYSPOISSOMETER_UINT)(pop_down_left+pop_delta);
-          pop_down_right=(DYSPOISSOMETER_UINT)(pop_down_right-pop_delta);
-          pop_up_left=(DYSPOISSOMETER_UINT)(pop_up_left-pop_delta);
-          pop_up_right=(DYSPOISSOMETER_UINT)(pop_up_right+pop_delta);
-          logfreedom_delta-=LOG_SUM(pop_down_left)+LOG_SUM(pop_down_right)+LOG_SUM(pop_up_left)+LOG_SUM(pop_up_right);
-        }else if(!pop_idx_delta){
-          logfreedom_delta+=LOG_SUM(pop_up_right);
-          pop_down_left=(DYSPOISSOMETER_UINT)(pop_down_left+pop_delta);
-          pop_down_right=(DYSPOISSOMETER_UINT)(pop_down_right-(pop_delta<<1));
-          pop_up_left=pop_down_right;
-          pop_up_right=(DYSPOISSOMETER_UINT)(pop_up_right+pop_delta);
-          logfreedom_delta-=LOG_SUM(pop_down_left)+LOG_SUM(pop_down_right)+LOG_SUM(pop_up_right);
-        }else{
-          logfreedom_delta+=LOG_SUM(pop_up_left);
-          pop_down_left=(DYSPOISSOMETER_UINT)(pop_down_left+(pop_delta<<1));
-          pop_down_right=(DYSPOISSOMETER_UINT)(pop_down_right-pop_delta);
-          pop_up_left=(DYSPOISSOMETER_UINT)(pop_up_left-pop_delta);
-          pop_up_right=pop_down_left;
-          logfreedom_delta-=LOG_SUM(pop_down_left)+LOG_SUM(pop_down_right)+LOG_SUM(pop_up_left);
-        }
-        pop_list_base[pop_idx_down-1]=pop_down_left;
-        pop_list_base[pop_idx_down]=pop_down_right;
-        pop_list_base[pop_idx_up]=pop_up_left;
-        pop_list_base[pop_idx_up+1]=pop_up_right;
+    logfreedom_delta=LOG_SUM(pop_down_left)+LOG_SUM(pop_down_right)+(pop_delta*freq_expression);
+    if(2<pop_idx_delta){
+      logfreedom_delta+=LOG_SUM(pop_up_left)+LOG_SUM(pop_up_right);
+      pop_down_left=(DYSPOISSOMETER_UINT)(pop_down_left+pop_delta);
+      pop_down_right=(DYSPOISSOMETER_UINT)(pop_down_right-pop_delta);
+      pop_up_left=(DYSPOISSOMETER_UINT)(pop_up_left-pop_delta);
+      pop_up_right=(DYSPOISSOMETER_UINT)(pop_up_right+pop_delta);
+      logfreedom_delta-=LOG_SUM(pop_down_left)+LOG_SUM(pop_down_right)+LOG_SUM(pop_up_left)+LOG_SUM(pop_up_right);
+    }else if(!pop_idx_delta){
+      logfreedom_delta+=LOG_SUM(pop_up_right);
+      pop_down_left=(DYSPOISSOMETER_UINT)(pop_down_left+pop_delta);
+      pop_down_right=(DYSPOISSOMETER_UINT)(pop_down_right-(pop_delta<<1));
+      pop_up_left=pop_down_right;
+      pop_up_right=(DYSPOISSOMETER_UINT)(pop_up_right+pop_delta);
+      logfreedom_delta-=LOG_SUM(pop_down_left)+LOG_SUM(pop_down_right)+LOG_SUM(pop_up_right);
+    }else{
+      logfreedom_delta+=LOG_SUM(pop_up_left);
+      pop_down_left=(DYSPOISSOMETER_UINT)(pop_down_left+(pop_delta<<1));
+      pop_down_right=(DYSPOISSOMETER_UINT)(pop_down_right-pop_delta);
+      pop_up_left=(DYSPOISSOMETER_UINT)(pop_up_left-pop_delta);
+      pop_up_right=pop_down_left;
+      logfreedom_delta-=LOG_SUM(pop_down_left)+LOG_SUM(pop_down_right)+LOG_SUM(pop_up_left);
+    }
+    pop_list_base[pop_idx_down-1]=pop_down_left;
+    pop_list_base[pop_idx_down]=pop_down_right;
+    pop_list_base[pop_idx_up]=pop_up_left;
+    pop_list_base[pop_idx_up+1]=pop_up_right;
 /*
 All nonzero populations lie on indexes on [pop_nonzero_idx_min, pop_nonzero_idx_max]. Some zero populations also lie on that interval, which is OK and not worth the trouble to trim. Update them as needed. All we're trying to do, in the interest of speed, is to minimize memory and time consumed dealing with zero populations at the periphery of the distribution.
 */
-        if(pop_idx_down==pop_nonzero_idx_min){
-          pop_nonzero_idx_min--;
-          pop_nonzero_idx_span++;
-        }else if((pop_idx_down==pop_nonzero_idx_max)&&(!pop_down_right)&&(pop_idx_up<pop_idx_down)){
-          pop_nonzero_idx_max--;
-          pop_nonzero_idx_span--;
-        }
-        if(pop_idx_up==pop_nonzero_idx_max){
-          pop_nonzero_idx_max++;
-          pop_nonzero_idx_span++;
-        }else if((pop_idx_up==pop_nonzero_idx_min)&&(!pop_up_left)&&(pop_idx_up<pop_idx_down)){
-          pop_nonzero_idx_min++;
-          pop_nonzero_idx_span--;
-        }
-        logfreedom_delta_sum+=logfreedom_delta;
-        if(0.0f<logfreedom_delta_sum){
+    if(pop_idx_down==pop_nonzero_idx_min){
+      pop_nonzero_idx_min--;
+      pop_nonzero_idx_span++;
+    }else if((pop_idx_down==pop_nonzero_idx_max)&&(!pop_down_right)&&(pop_idx_up<pop_idx_down)){
+      pop_nonzero_idx_max--;
+      pop_nonzero_idx_span--;
+    }
+    if(pop_idx_up==pop_nonzero_idx_max){
+      pop_nonzero_idx_max++;
+      pop_nonzero_idx_span++;
+    }else if((pop_idx_up==pop_nonzero_idx_min)&&(!pop_up_left)&&(pop_idx_up<pop_idx_down)){
+      pop_nonzero_idx_min++;
+      pop_nonzero_idx_span--;
+    }
+    logfreedom_delta_sum+=logfreedom_delta;
+    if(0.0f<logfreedom_delta_sum){
 /*
 The sum of all the (logfreedom_delta)s that we've incurred by a combination of logfreedom gradient riding and random single unit population transfers has resulted in a population list with a logfreedom greater than the existing best. So copy pop_list_base to pop_list_best_base where they differ. Note that the resulting logfreedom might not increase, and in theory could even decrease, due to numerical error. But we'll do the best we can.
 */
-          logfreedom_delta_sum=0.0f;
-          iteration_last_change=iteration;
-          if(pop_idx_max!=pop_idx_max_best){
-            dyspoissometer_free(pop_list_best_base);
-            pop_list_best_base=dyspoissometer_uint_list_malloc_zero(pop_idx_max);
-            if(!pop_list_best_base){
-              overflow_status=1;
-              break;
-            }
-            pop_idx_max_best=pop_idx_max;
-          }
-          dyspoissometer_uint_list_copy(pop_idx_max, 0, 0, pop_list_base, pop_list_best_base);
-          pop_nonzero_idx_max_best=pop_nonzero_idx_max;
-          pop_nonzero_idx_min_best=pop_nonzero_idx_min;
-          freq_max_best=freq_max;
-          freq_min_best=freq_min;
-        }else{
+      logfreedom_delta_sum=0.0f;
+      iteration_last_change=iteration;
+      if(pop_idx_max!=pop_idx_max_best){
+        dyspoissometer_free(pop_list_best_base);
+        pop_list_best_base=dyspoissometer_uint_list_malloc_zero(pop_idx_max);
+        if(!pop_list_best_base){
+          overflow_status=1;
+          break;
+        }
+        pop_idx_max_best=pop_idx_max;
+      }
+      dyspoissometer_uint_list_copy(pop_idx_max, 0, 0, pop_list_base, pop_list_best_base);
+      pop_nonzero_idx_max_best=pop_nonzero_idx_max;
+      pop_nonzero_idx_min_best=pop_nonzero_idx_min;
+      freq_max_best=freq_max;
+      freq_min_best=freq_min;
+    }else{
 /*
 If at least pop_nonzero_idx_span iterations have passed since the last "best" was found, then, empirically, it's time to revert to the known best and try mutating it some other way. There's surely some better thresholding value, but this seems to work well.
 */
-          if(pop_nonzero_idx_span<=(iteration-iteration_last_change)){
+      if(pop_nonzero_idx_span<=(iteration-iteration_last_change)){
 /*
 Revert to the known best and try again. This is simple because *pop_list_base is at least as large as *pop_list_best_base.
 */
-            logfreedom_delta_sum=0.0f;
-            iteration_last_change=iteration;
-            dyspoissometer_uint_list_copy(pop_idx_max_best, 0, 0, pop_list_best_base, pop_list_base);
-            pop_idx_max=pop_idx_max_best;
-            pop_nonzero_idx_max=pop_nonzero_idx_max_best;
-            pop_nonzero_idx_min=pop_nonzero_idx_min_best;
-            freq_max=freq_max_best;
-            freq_min=freq_min_best;
-            pop_nonzero_idx_span=(DYSPOISSOMETER_UINT)((DYSPOISSOMETER_UINT)(pop_nonzero_idx_max_best-pop_nonzero_idx_min_best)+1);
-          }
-        }
-      }while((iteration++)!=iteration_max);
-      *random_seed_base=marsaglia_p;
-      if(!overflow_status){
-/*
-Compute the logfreedom of the best population list.
-*/
-        freq_max_minus_1=(DYSPOISSOMETER_UINT)((DYSPOISSOMETER_UINT)(freq_min_best+pop_nonzero_idx_max_best)-1);
-        logfreedom_max=dyspoissometer_logfreedom_dense_get(freq_max_minus_1, freq_min_best, mask_idx_max, mask_max, pop_list_best_base);
-/*
-Considering the complexity of this process, a little paranoia is reasonable. Check to ensure that the best population list is actually consistent with mask_idx_max and mask_max.
-*/
-        pop_idx=pop_nonzero_idx_min_best;
-        do{
-          pop=pop_list_best_base[pop_idx];
-          mask_idx_max=(DYSPOISSOMETER_UINT)(mask_idx_max-(pop*(pop_idx+freq_min_best)));
-          mask_max=(DYSPOISSOMETER_UINT)(mask_max-pop);
-        }while((pop_idx++)!=pop_nonzero_idx_max_best);
-        overflow_status=!!((++mask_idx_max)|(++mask_max));
+        logfreedom_delta_sum=0.0f;
+        iteration_last_change=iteration;
+        dyspoissometer_uint_list_copy(pop_idx_max_best, 0, 0, pop_list_best_base, pop_list_base);
+        pop_idx_max=pop_idx_max_best;
+        pop_nonzero_idx_max=pop_nonzero_idx_max_best;
+        pop_nonzero_idx_min=pop_nonzero_idx_min_best;
+        freq_max=freq_max_best;
+        freq_min=freq_min_best;
+        pop_nonzero_idx_span=(DYSPOISSOMETER_UINT)((DYSPOISSOMETER_UINT)(pop_nonzero_idx_max_best-pop_nonzero_idx_min_best)+1);
       }
     }
-    dyspoissometer_free(pop_list_best_base);
-    dyspoissometer_free(pop_list_base);
-  }else if(mask_max){
-    if(2<mask_idx_max){
-/*
-There are exactly 2 masks. Maximum logfreedom occurs when as close as possible to half of them are in either state. Compute the log of the possible number of combinations.
-*/
-      mask_count=(DYSPOISSOMETER_UINT)(mask_idx_max+1);
-      mask_count_part0=mask_count>>1;
-      mask_count_part1=(DYSPOISSOMETER_UINT)(mask_count-mask_count_part0);
-      logfreedom_max=LOG_SUM(mask_count)-LOG_SUM(mask_count_part0)-LOG_SUM(mask_count_part1);
-      if(mask_count_part0!=mask_count_part1){
+  }while((iteration++)!=iteration_max);
+  chain_base->freq_max=freq_max;
+  chain_base->freq_max_best=freq_max_best;
+  chain_base->freq_min=freq_min;
+  chain_base->freq_min_best=freq_min_best;
+  chain_base->iteration=iteration;
+  chain_base->iteration_last_change=iteration_last_change;
+  chain_base->logfreedom_delta_sum=logfreedom_delta_sum;
+  chain_base->marsaglia_p=marsaglia_p;
+  chain_base->overflow_status=overflow_status;
+  chain_base->pop_idx_max=pop_idx_max;
+  chain_base->pop_idx_max_best=pop_idx_max_best;
+  chain_base->pop_list_base=pop_list_base;
+  chain_base->pop_list_best_base=pop_list_best_base;
+  chain_base->pop_nonzero_idx_max=pop_nonzero_idx_max;
+  chain_base->pop_nonzero_idx_max_best=pop_nonzero_idx_max_best;
+  chain_base->pop_nonzero_idx_min=pop_nonzero_idx_min;
+  chain_base->pop_nonzero_idx_min_best=pop_nonzero_idx_min_best;
+  chain_base->pop_nonzero_idx_span=pop_nonzero_idx_span;
+  return;
+}
+
+void *
+dyspoissometer_chain_thread_run(void *chain_base){
 /*
-Mask count is odd, so we need to double the way count (i.e. add (ln 2) to the logfreedom) because we could have majority zeroes or majority ones.
+Thread entry point for dyspoissometer_logfreedom_max_parallel_get().
+
+In:
+
+  chain_base is a (dyspoissometer_chain_t *) as defined for dyspoissometer_chain_iterate():In, with chain_base->iteration_count_minus_1 set to the desired number of iterations, less one.
+
+Out:
+
+  Returns NULL.
+
+  *chain_base is as defined in dyspoissometer_chain_iterate():Out.
 */
-        logfreedom_max+=LOG(2.0f);
-      }
-    }else{
+  dyspoissometer_chain_t *chain_base_typed;
+
+  chain_base_typed=(dyspoissometer_chain_t *)(chain_base);
+  dyspoissometer_chain_iterate(chain_base_typed, chain_base_typed->iteration_count_minus_1);
+  return NULL;
+}
+
+DYSPOISSOMETER_NUMBER
+dyspoissometer_chain_logfreedom_get(dyspoissometer_chain_t *chain_base){
 /*
-mask_idx_max is too small to deal with. Compute logfreedom_max formulaically.
+Compute the logfreedom of the best population list which a chain has found so far.
 
-With only one mask index (mask_idx_max==0), the logfreedom is just the log of the number of possible masks. (H=={1}), meaning that we have one mask with frequency one, and no other masks. In this case, set (logfreedom_max==LOG(mask_max+1)).
+In:
 
-With 2 mask indexes, and in the case of maximum logfreedom, we have mask_span choices for the first and mask_max choices for the 2nd; (H=={2}). In this case, set (logfreedom_max==LOG(mask_max+1)+LOG(mask_max)).
+  *chain_base is as defined in dyspoissometer_chain_iterate():Out.
 
-With 3 mask indexes, logfreedom is maximized when (H=={1, 1}) or (H=={3}). If (4<=mask_max), then the latter provides maximum logfreedom; otherwise the former does so. So if (4<=mask_max), set (logfreedom_max==LOG(mask_max+1)+LOG(mask_max)+LOG(mask_max-1)), else set (logfreedom_max==LOG(mask_max+1)+LOG(mask_max)+LOG(3.0f)).
+Out:
+
+  Returns a rational but otherwise undefined negative value if *chain_base ran out of memory or its best population list is inconsistent with its mask_idx_max and mask_max; else the logfreedom of its best population list, guaranteed to be nonnegative.
 */
-      logfreedom_max=LOG_N_PLUS_1(mask_max);
-      if(mask_idx_max){
-        logfreedom_max+=LOG(mask_max);
-        if(mask_idx_max==2){
-          logfreedom_max+=LOG((DYSPOISSOMETER_NUMBER)(MAX(4, mask_max)-1));
-        }
-      }
-    }
-  }
-  if(overflow_status){
+  DYSPOISSOMETER_UINT freq_max_minus_1;
+  DYSPOISSOMETER_UINT freq_min_best;
+  DYSPOISSOMETER_NUMBER logfreedom;
+  DYSPOISSOMETER_UINT mask_idx_max;
+  DYSPOISSOMETER_UINT mask_max;
+  u8 overflow_status;
+  DYSPOISSOMETER_UINT pop;
+  DYSPOISSOMETER_UINT pop_idx;
+  DYSPOISSOMETER_UINT *pop_list_best_base;
+  DYSPOISSOMETER_UINT pop_nonzero_idx_max_best;
+
+  logfreedom=0.0f;
+  overflow_status=chain_base->overflow_status;
+  if(!overflow_status){
+    freq_min_best=chain_base->freq_min_best;
+    mask_idx_max=chain_base->mask_idx_max;
+    mask_max=chain_base->mask_max;
+    pop_list_best_base=chain_base->pop_list_best_base;
+    pop_nonzero_idx_max_best=chain_base->pop_nonzero_idx_max_best;
+    freq_max_minus_1=(DYSPOISSOMETER_UINT)((DYSPOISSOMETER_UINT)(freq_min_best+pop_nonzero_idx_max_best)-1);
+    logfreedom=dyspoissometer_logfreedom_dense_get(freq_max_minus_1, freq_min_best, mask_idx_max, mask_max, pop_list_best_base);
 /*
-It's impossible to have a negative logfreedom, legitmately. Flag overflow to the caller.
+Considering the complexity of this process, a little paranoia is reasonable. Check to ensure that the best population list is actually consistent with mask_idx_max and mask_max.
 */
-    logfreedom_max=-1.0f;
-  }else if(logfreedom_max<=0.0f){
+    pop_idx=chain_base->pop_nonzero_idx_min_best;
+    do{
+      pop=pop_list_best_base[pop_idx];
+      mask_idx_max=(DYSPOISSOMETER_UINT)(mask_idx_max-(pop*(pop_idx+freq_min_best)));
+      mask_max=(DYSPOISSOMETER_UINT)(mask_max-pop);
+    }while((pop_idx++)!=pop_nonzero_idx_max_best);
+    overflow_status=!!((++mask_idx_max)|(++mask_max));
+  }
+  if(overflow_status){
+    logfreedom=-1.0f;
+  }else if(logfreedom<=0.0f){
 /*
 logfreedom might be negative (or negative zero) due to numerical error, so flush it to zero.
 */
-    logfreedom_max=0.0f;
+    logfreedom=0.0f;
   }
-  return logfreedom_max;
+  return logfreedom;
 }
 
-void
-dyspoissometer_mask_list_pseudorandom_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT *mask_list_base, DYSPOISSOMETER_UINT mask_max, u64 *random_seed_base){
+u8
+dyspoissometer_chain_copy(dyspoissometer_chain_t *chain0_base, dyspoissometer_chain_t *chain1_base){
 /*
-Generate a pseudorandom mask list consistent with a given mask count and mask span.
+Replace both the current and best population lists of one chain with the best population list of another, so that the former continues its search from the latter's best known state, using its own pseudorandom sequence.
 
 In:
 
-  mask_idx_max is as defined in dyspoissometer_logfreedom_max_get().
-
-  *mask_list_base is as it was previously returned from this function, or (mask_idx_max+1) zeroes on the first call.
-
-  mask_max is as defined in dyspoissometer_logfreedom_max_get().
+  *chain0_base is the source chain, as defined in dyspoissometer_chain_iterate():Out, with (chain0_base->overflow_status==0).
 
-  *random_seed_base is as defined in dyspoissometer_logfreedom_max_get():In.
+  *chain1_base is the target chain, as defined in dyspoissometer_chain_iterate():Out, which must differ from *chain0_base.
 
 Out:
 
-  Returns the value of random_seed to use on the next call.
-
-  *mask_list_base will contain a mask list consistent with mask_idx_max and mask_max, which was selected from an essentially uniform distribution of all possible mask lists.
+  Returns one if we ran out of memory, in which case (chain1_base->overflow_status==1); else zero.
 
-  *random_seed_base is as defined in dyspoissometer_logfreedom_max_get():Out.
+  *chain1_base is ready for use by dyspoissometer_chain_iterate() if we returned zero.
 */
-  u32 marsaglia_c;
-  u64 marsaglia_p;
-  u32 marsaglia_x;
-  DYSPOISSOMETER_UINT mask;
-  DYSPOISSOMETER_UINT mask_idx;
-  DYSPOISSOMETER_UINT mask_span;
+  DYSPOISSOMETER_UINT pop_idx_max;
+  DYSPOISSOMETER_UINT *pop_list_base;
+  DYSPOISSOMETER_UINT *pop_list_best_base;
+  u8 status;
 
-  mask_idx=0;
-  marsaglia_p=*random_seed_base;
-  mask_span=(DYSPOISSOMETER_UINT)(mask_max+1);
+  dyspoissometer_chain_free(chain1_base);
+  pop_idx_max=chain0_base->pop_idx_max_best;
+  pop_list_base=dyspoissometer_uint_list_malloc(pop_idx_max);
+  pop_list_best_base=dyspoissometer_uint_list_malloc(pop_idx_max);
+  chain1_base->pop_list_base=pop_list_base;
+  chain1_base->pop_list_best_base=pop_list_best_base;
+  status=1;
+  if(pop_list_base&&pop_list_best_base){
+    status=0;
+    dyspoissometer_uint_list_copy(pop_idx_max, 0, 0, chain0_base->pop_list_best_base, pop_list_base);
+    dyspoissometer_uint_list_copy(pop_idx_max, 0, 0, chain0_base->pop_list_best_base, pop_list_best_base);
+    chain1_base->freq_max=chain0_base->freq_max_best;
+    chain1_base->freq_max_best=chain0_base->freq_max_best;
+    chain1_base->freq_min=chain0_base->freq_min_best;
+    chain1_base->freq_min_best=chain0_base->freq_min_best;
+    chain1_base->iteration_last_change=chain1_base->iteration;
+    chain1_base->logfreedom_delta_sum=0.0f;
+    chain1_base->pop_idx_max=pop_idx_max;
+    chain1_base->pop_idx_max_best=pop_idx_max;
+    chain1_base->pop_nonzero_idx_max=chain0_base->pop_nonzero_idx_max_best;
+    chain1_base->pop_nonzero_idx_max_best=chain0_base->pop_nonzero_idx_max_best;
+    chain1_base->pop_nonzero_idx_min=chain0_base->pop_nonzero_idx_min_best;
+    chain1_base->pop_nonzero_idx_min_best=chain0_base->pop_nonzero_idx_min_best;
+    chain1_base->pop_nonzero_idx_span=(DYSPOISSOMETER_UINT)((DYSPOISSOMETER_UINT)(chain0_base->pop_nonzero_idx_max_best-chain0_base->pop_nonzero_idx_min_best)+1);
+  }
+  chain1_base->overflow_status=status;
+  return status;
+}
+
+dyspoissometer_chain_t *
+dyspoissometer_chain_list_malloc(u32 chain_idx_max){
 /*
-Use modulo summation, over mask_span, of the previous mask value and a Marsaglia pseudorandom value to obtain new masks. This leads to essentially unbiased mask lists, despite the slight high bit bias of the oscillator.
+Allocate a list of undefined chains.
+
+In:
+
+  chain_idx_max is the number of chains to allocate, less one.
+
+Out:
+
+  Returns NULL on failure, else the base of (chain_idx_max+1) undefined (dyspoissometer_chain_t)s, which should eventually be freed via dyspoissometer_free().
 */
-  if(!(mask_max&mask_span)){
+  ULONG chain_count;
+  dyspoissometer_chain_t *list_base;
+  ULONG list_size;
+
+  list_base=NULL;
+  chain_count=(ULONG)((ULONG)(chain_idx_max)+1);
+  if(chain_count){
+    list_size=(ULONG)(chain_count*sizeof(dyspoissometer_chain_t));
+    if((list_size/sizeof(dyspoissometer_chain_t))==chain_count){
+      list_base=DEBUG_MALLOC_PARANOID(list_size);
+    }
+  }
+  return list_base;
+}
+
+u32
+dyspoissometer_cpu_count_get(void){
 /*
-mask_span is a power of 2, so we can just use "&" to obtain masks instead of expensive "%".
+Get the number of CPU cores which are online, for the purpose of determining a reasonable thread count.
+
+Out:
+
+  Returns the number of cores available to this process, which is at least one.
 */
-    do{
-      mask=mask_list_base[mask_idx];
-      marsaglia_c=(u32)(marsaglia_p>>U32_BITS);
-      marsaglia_x=(u32)(marsaglia_p);
-      mask=(DYSPOISSOMETER_UINT)((marsaglia_p+mask)&mask_max);
-      marsaglia_p=((u64)(marsaglia_x)*DYSPOISSOMETER_MARSAGLIA_A)+marsaglia_c;
-      mask_list_base[mask_idx]=mask;
-    }while((mask_idx++)!=mask_idx_max);
-  }else{
-    do{
-      mask=mask_list_base[mask_idx];
-      marsaglia_c=(u32)(marsaglia_p>>U32_BITS);
-      marsaglia_x=(u32)(marsaglia_p);
-      mask=(DYSPOISSOMETER_UINT)((marsaglia_p+mask)%mask_span);
-      marsaglia_p=((u64)(marsaglia_x)*DYSPOISSOMETER_MARSAGLIA_A)+marsaglia_c;
-      mask_list_base[mask_idx]=mask;
-    }while((mask_idx++)!=mask_idx_max);
+  u32 cpu_count;
+#ifdef WINDOWS
+  SYSTEM_INFO system_info;
+
+  GetSystemInfo(&system_info);
+  cpu_count=(u32)(system_info.dwNumberOfProcessors);
+#else
+  long cpu_count_long;
+
+  cpu_count_long=sysconf(_SC_NPROCESSORS_ONLN);
+  cpu_count=(u32)(cpu_count_long);
+  if((cpu_count_long<=0)||(U32_MAX<(u64)(cpu_count_long))){
+    cpu_count=1;
   }
-  *random_seed_base=marsaglia_p;
-  return;
+#endif
+  cpu_count=MAX(cpu_count, 1);
+  return cpu_count;
 }
 
-void
-dyspoissometer_number_list_sort(DYSPOISSOMETER_UINT number_idx_max, DYSPOISSOMETER_NUMBER *number_list0_base, DYSPOISSOMETER_NUMBER *number_list1_base){
+DYSPOISSOMETER_NUMBER
+dyspoissometer_logfreedom_max_get(u64 iteration_max, DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_max, u64 *random_seed_base){
 /*
-Sort a list of (DYSPOISSOMETER_NUMBER)s ascending as though they were unsigned integers equal to their implementation-specific representations, using double buffering for speed.
+Approximate the maximum logfreedom possible with a population list having an implied mask count of (mask_idx_max+1) and an implied mask count of (mask_max+1). The same could be done by finding a discrete Poisson distribution consistent with those constraints, but this approach seems to work better with less code complexity, yielding larger logfreedom especially at low mask counts or mask spans. It may be more computationally expensive, however.
+
+In some cases, it may be faster to generate mask lists using dyspoissometer_mask_list_pseudorandom_get(), and just compute the logfreedom repeatedly in order to approximate the maximum thereof. However, in the general case, such mask lists would exhaust available memory.
+
+Therefore, we use a Monte Carlo method involving piecemeal gradient riding with noise injection to prevent settling onto local maxima. Essentially, we maintain a neighboring pair of "up" frequencies, where the left transfers one population unit to the right; and a neighboring pair of "down" frequencies which do the opposite. "Up" and "down" neighbors are allowed to overlap at a single frequency so that the middle population changes by 2 while the outside populations change by one; in most cases, however, we have 4 disjoint frequencies, in which case all populations change by one. This technique permits us to perform minimal changes, in the sense of the population changes which would occur if only a single mask in a mask set were changed. We perform such a minimal change whether or not it is profitable, merely for the sake of avoiding the trap of local maxima. But if indeed the change proves to be profitable, then we ride a gradient whose first derivative is monotonic in order to find the number of such minimal changes which maximize the resulting increase in logfreedom. This process continues through a specified number of iterations, whereupon the maximum result is returned.
+
 In:
 
-  number_idx_max is one less than the number of items in each list.
+  mask_idx_max is the maximum mask index, on [0, DYSPOISSOMETER_UINT_MAX-1].
 
-  *number_list0_base contains (number_idx_max+1) items to sort.
+  iteration_max is the number of iterations to run, less one. Note that unlike dyspoissometer_logfreedom_median_get(), this is a u64, not a DYSPOISSOMETER_UINT. Experimentation is the only way to determine its significance with respect to accuracy.
 
-  *number_list1_base is undefined and writable for (number_idx_max+1) items.
+  mask_max is the maximum possible mask value. Unlike with other Dyspoissometer functions, no restriction is placed on it.
+
+  *random_seed_base allows the caller to run many independent copies of this function. On [1, ((DYSPOISSOMETER_MARSAGLIA_A-1)<<U32_BITS)+U32_MAX-1]. See also dyspoissometer_logfreedom_max_parallel_get(), which does so on all available cores.
 
 Out:
 
-  *number_list0_base is sorted ascending.
+  Returns a rational but otherwise undefined negative value if we ran out of memory; else an approximation of maximum logfreedom, guaranteed to be nonnegative. On success, the return value is virtually certain to be less than the infinitely accurate maximum logfreedom, not the least of which because logfreedom is irrational, but also because it is derived from a population set consistent with the input constraints, which may not happen to have maximum logfreedom despite having been evolved for such.
 
-  *number_list1_base is undefined. 
-*/
-  u8 continue_status;
-  ULONG list_size;
-  DYSPOISSOMETER_NUMBER number;
-  DYSPOISSOMETER_UINT number_idx_list_base[U8_SPAN];
-  DYSPOISSOMETER_UINT number_idx0;
-  DYSPOISSOMETER_UINT number_idx1;
-  DYSPOISSOMETER_NUMBER *number_list2_base;
-  DYSPOISSOMETER_NUMBER number_old;
-  DYSPOISSOMETER_UINT number_u8;
-  DYSPOISSOMETER_UINT number_u8_freq;
-  DYSPOISSOMETER_UINT number_u8_idx;
-/*
-Perform a bytewise radix sort of *number_list0_base.
+  *random_seed_base contains an updated random seed.
 */
-  number_u8_idx=0;
-  do{
+  DYSPOISSOMETER_NUMBER logfreedom_max;
+  DYSPOISSOMETER_UINT mask_count;
+  DYSPOISSOMETER_UINT mask_count_part0;
+  DYSPOISSOMETER_UINT mask_count_part1;
+  dyspoissometer_chain_t chain;
+  u8 overflow_status;
+
+  overflow_status=0;
+  logfreedom_max=0.0f;
+  if((2<mask_idx_max)&&(1<mask_max)){
+    overflow_status=dyspoissometer_chain_init(&chain, mask_idx_max, mask_max, *random_seed_base);
+    if(!overflow_status){
+      dyspoissometer_chain_iterate(&chain, iteration_max);
+      *random_seed_base=chain.marsaglia_p;
 /*
-*number_idx_list_base will serve as a list of base indexes for all possible (u8)s. Zero it.
+Compute the logfreedom of the best population list. The result will be negative if we ran out of memory.
 */
-    memset(number_idx_list_base, 0, (size_t)(U8_SPAN<<DYSPOISSOMETER_UINT_SIZE_LOG2));
-    continue_status=0;
+      logfreedom_max=dyspoissometer_chain_logfreedom_get(&chain);
+      overflow_status=(logfreedom_max<0.0f);
+    }
+    dyspoissometer_chain_free(&chain);
+  }else if(mask_max){
+    if(2<mask_idx_max){
 /*
-Count u8 frequencies and save them to *number_idx_list_base. Move backwards to maximize cache hits in most cases.
+There are exactly 2 masks. Maximum logfreedom occurs when as close as possible to half of them are in either state. Compute the log of the possible number of combinations.
 */
-    number_idx0=number_idx_max;
-    number_old=number_list0_base[number_idx_max];
-    do{
-      number=number_list0_base[number_idx0];
-      continue_status=(u8)(continue_status|(number_old<number));
-      number_u8=((unsigned char *)(&number))[number_u8_idx];
-      number_old=number;
-      number_idx_list_base[number_u8]++;
-    }while(number_idx0--);
-    if(continue_status){
+      mask_count=(DYSPOISSOMETER_UINT)(mask_idx_max+1);
+      mask_count_part0=mask_count>>1;
+      mask_count_part1=(DYSPOISSOMETER_UINT)(mask_count-mask_count_part0);
+      logfreedom_max=LOG_SUM(mask_count)-LOG_SUM(mask_count_part0)-LOG_SUM(mask_count_part1);
+      if(mask_count_part0!=mask_count_part1){
 /*
-Convert number_idx_list_base from a list of frequencies of (u8)s to a list of preceding cummulative sums of frequencies of (u8)s. This will tell us how to sort this particular u8 lane.
+Mask count is odd, so we need to double the way count (i.e. add (ln 2) to the logfreedom) because we could have majority zeroes or majority ones.
 */
-      number_u8=0;
-      number_idx0=0;
-      do{
-        number_u8_freq=number_idx_list_base[number_u8];
-        number_idx_list_base[number_u8]=number_idx0;
-        number_idx0=(DYSPOISSOMETER_UINT)(number_idx0+number_u8_freq);
-      }while((number_u8++)!=U8_MAX);
+        logfreedom_max+=LOG(2.0f);
+      }
+    }else{
 /*
-Sort *number_list1_base ascending by the u8 lane designated by number_u8_idx.
+mask_idx_max is too small to deal with. Compute logfreedom_max formulaically.
+
+With only one mask index (mask_idx_max==0), the logfreedom is just the log of the number of possible masks. (H=={1}), meaning that we have one mask with frequency one, and no other masks. In this case, set (logfreedom_max==LOG(mask_max+1)).
+
+With 2 mask indexes, and in the case of maximum logfreedom, we have mask_span choices for the first and mask_max choices for the 2nd; (H=={2}). In this case, set (logfreedom_max==LOG(mask_max+1)+LOG(mask_max)).
+
+With 3 mask indexes, logfreedom is maximized when (H=={1, 1}) or (H=={3}). If (4<=mask_max), then the latter provides maximum logfreedom; otherwise the former does so. So if (4<=mask_max), set (logfreedom_max==LOG(mask_max+1)+LOG(mask_max)+LOG(mask_max-1)), else set (logfreedom_max==LOG(mask_max+1)+LOG(mask_max)+LOG(3.0f)).
 */
-      number_idx0=0;
-      do{
-        number=number_list0_base[number_idx0];
-        number_u8=((unsigned char *)(&number))[number_u8_idx];
-        number_idx1=number_idx_list_base[number_u8];
-        number_list1_base[number_idx1]=number;
-        number_idx1++;
-        number_idx_list_base[number_u8]=number_idx1;
-      }while((number_idx0++)!=number_idx_max);
+      logfreedom_max=LOG_N_PLUS_1(mask_max);
+      if(mask_idx_max){
+        logfreedom_max+=LOG(mask_max);
+        if(mask_idx_max==2){
+          logfreedom_max+=LOG((DYSPOISSOMETER_NUMBER)(MAX(4, mask_max)-1));
+        }
+      }
     }
+  }
+  if(overflow_status){
 /*
-Swap list bases in order to accomplish double buffering.
-*/
-    number_list2_base=number_list0_base;
-    number_list0_base=number_list1_base;
-    number_list1_base=number_list2_base;
-/*
-continue_status should always be zero when the items have been sorted. However, due to floating-point undefinedness, it might be one even though the objects have actually been sorted when viewed as unsigned integers (which we could not have done because it would have been an aliasing violation, hence our use of (unsigned char *)).
+It's impossible to have a negative logfreedom, legitmately. Flag overflow to the caller.
 */
-    number_u8_idx++;
-  }while(continue_status&&(number_u8_idx!=sizeof(DYSPOISSOMETER_NUMBER)));
-  if((number_u8_idx&1)^(!continue_status)){
+    logfreedom_max=-1.0f;
+  }else if(logfreedom_max<=0.0f){
 /*
-Copy the object list back to what is, from the caller's perspective, number_list0_base.
+logfreedom might be negative (or negative zero) due to numerical error, so flush it to zero.
 */
-    list_size=(ULONG)(number_idx_max);
-    list_size++;
-    list_size=(ULONG)(list_size*sizeof(DYSPOISSOMETER_NUMBER));
-    memcpy(number_list0_base, number_list1_base, (size_t)(list_size));
+    logfreedom_max=0.0f;
   }
-  return;
+  return logfreedom_max;
 }
 
 DYSPOISSOMETER_NUMBER
-dyspoissometer_logfreedom_median_get(DYSPOISSOMETER_UINT iteration_max, DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_max, u64 *random_seed_base){
+dyspoissometer_logfreedom_max_parallel_get(u64 iteration_max, u64 iteration_stall_max, DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_max, u64 *random_seed_base, u32 thread_count){
 /*
-Approximate the median (not to be confused with mean) logfreedom of all mask lists consistent with a given mask count and mask span. Median logfreedom is important because it provides a threshold above and below which there is essentially equal probability of decreasing or increasing logfreedom. Mask lists generated by a strong true random number generator should asymptotically exhibit this median. In other words, consistently exhibiting improbably low or high logfreedom is an indicator of nonrandomness; the former case indicates a lack of entropy and the latter indicates an attempt to artificially contrive maximum randomness.
+Approximate the maximum logfreedom, as with dyspoissometer_logfreedom_max_get(), but using several chains of the gradient riding process at once, each in its own thread with its own pseudorandom sequence. After every DYSPOISSOMETER_CHAIN_EPOCH_ITERATION_COUNT iterations, the chains are synchronized: the best population list found by any of them is copied into all the others, which then continue mutating it in different directions. The process stops after iteration_max iterations per chain, or sooner if the best logfreedom has not improved in iteration_stall_max iterations.
 
 In:
 
-  mask_idx_max is as defined in dyspoissometer_logfreedom_max_get().
+  iteration_max is the maximum number of iterations to run in each chain, less one.
 
-  iteration_max is as defined in dyspoissometer_logfreedom_max_get(), except that it is restricted to [0, DYSPOISSOMETER_UINT_MAX-1].
+  iteration_stall_max is the number of iterations per chain, rounded up to a multiple of DYSPOISSOMETER_CHAIN_EPOCH_ITERATION_COUNT, which may pass without any improvement in the best logfreedom before we give up early. Set it to iteration_max in order to disable early stopping.
 
-  mask_max is as defined in dyspoissometer_logfreedom_max_get().
+  mask_idx_max is as defined in dyspoissometer_logfreedom_max_get():In.
 
-  *random_seed_base is as defined in dyspoissometer_logfreedom_max_get():In.
+  mask_max is as defined in dyspoissometer_logfreedom_max_get():In.
+
+  *random_seed_base is as defined in dyspoissometer_logfreedom_max_get():In. Each chain derives its own seed from it.
+
+  thread_count is the number of chains to run, one per thread, or zero to use dyspoissometer_cpu_count_get(). If DEBUG is defined, the chains all run on the calling thread because the paranoid memory allocator is not thread-safe, so the result is the same but slower.
 
 Out:
 
-  Returns a rational but otherwise undefined negative value if we ran out of memory; else an approximation of median logfreedom, guaranteed to be nonnegative. Critically, this value is in fact an actual logfreedom of at least one generated mask list; it is not an interpolated or value. For this reason, given sufficiently high iteration_max, it becomes asymptotically certain to be the actual median, within the limits of numerical precision.
+  Returns as defined in dyspoissometer_logfreedom_max_get():Out. If mask_idx_max or mask_max is too small to warrant a search, then this is simply the result of dyspoissometer_logfreedom_max_get().
 
-  *random_seed_base is as defined in dyspoissometer_logfreedom_max_get():Out.
+  *random_seed_base contains an updated random seed.
 */
-  DYSPOISSOMETER_UINT *freq_list_base;
-  DYSPOISSOMETER_UINT freq_max_minus_1;
+  dyspoissometer_chain_t *chain_base;
+  u32 chain_idx;
+  u32 chain_idx_best;
+  u32 chain_idx_max;
+  dyspoissometer_chain_t *chain_list_base;
+  u8 done_status;
+  u64 iteration;
+  u64 iteration_count_minus_1;
+  u64 iteration_last_change;
   DYSPOISSOMETER_NUMBER logfreedom;
-  DYSPOISSOMETER_UINT logfreedom_idx;
-  DYSPOISSOMETER_NUMBER *logfreedom_list0_base;
-  DYSPOISSOMETER_NUMBER *logfreedom_list1_base;
-  DYSPOISSOMETER_UINT *mask_list_base;
-  DYSPOISSOMETER_NUMBER median;
+  DYSPOISSOMETER_NUMBER logfreedom_best;
+  DYSPOISSOMETER_NUMBER logfreedom_max;
+  u64 marsaglia_p;
   u8 overflow_status;
-  DYSPOISSOMETER_UINT *pop_list_base;
+  u8 *thread_status_list_base;
+  pthread_t *thread_list_base;
 
-  overflow_status=0;
-  median=0.0f;
-  if(mask_max&&mask_idx_max){
-    overflow_status=1;
-    freq_list_base=dyspoissometer_uint_list_malloc(mask_max);
-    logfreedom_list0_base=dyspoissometer_number_list_malloc(iteration_max);
-    logfreedom_list1_base=dyspoissometer_number_list_malloc(iteration_max);
-    mask_list_base=dyspoissometer_uint_list_malloc_zero(mask_idx_max);
-    pop_list_base=dyspoissometer_uint_list_malloc_zero(mask_idx_max);
-    if(freq_list_base&&logfreedom_list0_base&&logfreedom_list1_base&&mask_list_base&&pop_list_base){
+  if(!((2<mask_idx_max)&&(1<mask_max))){
+    logfreedom_max=dyspoissometer_logfreedom_max_get(iteration_max, mask_idx_max, mask_max, random_seed_base);
+    return logfreedom_max;
+  }
+  if(!thread_count){
+    thread_count=dyspoissometer_cpu_count_get();
+  }
+  chain_idx_max=thread_count-1;
+  logfreedom_max=-1.0f;
+  overflow_status=1;
+  chain_list_base=dyspoissometer_chain_list_malloc(chain_idx_max);
+  thread_list_base=NULL;
+  thread_status_list_base=NULL;
+  if(chain_list_base){
+    thread_list_base=DEBUG_MALLOC_PARANOID((ULONG)(thread_count*sizeof(pthread_t)));
+    thread_status_list_base=DEBUG_MALLOC_PARANOID((ULONG)(thread_count));
+  }
+  if(chain_list_base&&thread_list_base&&thread_status_list_base){
 /*
-Generate pseudorandom mask lists one at a time based on *random_seed_base. For each mask list, find the logfreedom and save it to *logfreedom_list_base.
+Give each chain its own seed, but keep chain zero on the caller's seed so that (thread_count==1) behaves like dyspoissometer_logfreedom_max_get() for the first epoch. The other seeds are scrambled by an odd multiple of the chain index, then mapped into the legal seed range. Because the Marsaglia oscillator has a single huge cycle, the chains will then occupy essentially unrelated positions on it.
 */
-      logfreedom_idx=0;
+    overflow_status=0;
+    chain_idx=0;
+    do{
+      marsaglia_p=*random_seed_base;
+      if(chain_idx){
+        marsaglia_p^=(u64)(chain_idx)*0x9E3779B97F4A7C15ULL;
+        marsaglia_p=(marsaglia_p%((((u64)(DYSPOISSOMETER_MARSAGLIA_A-1))<<U32_BITS)+U32_MAX-1))+1;
+      }
+      overflow_status=(u8)(overflow_status|dyspoissometer_chain_init(&chain_list_base[chain_idx], mask_idx_max, mask_max, marsaglia_p));
+    }while((chain_idx++)!=chain_idx_max);
+    done_status=0;
+    iteration=0;
+    iteration_last_change=0;
+    while(!(done_status|overflow_status)){
+      iteration_count_minus_1=MIN(iteration_max-iteration, DYSPOISSOMETER_CHAIN_EPOCH_ITERATION_COUNT-1);
+      done_status=(iteration_count_minus_1==(iteration_max-iteration));
+/*
+Run chain zero on this thread and all others in their own threads. If a thread cannot be created, then run its chain on this thread as well.
+*/
+      chain_idx=0;
       do{
-        dyspoissometer_mask_list_pseudorandom_get(mask_idx_max, mask_list_base, mask_max, random_seed_base);
-        dyspoissometer_uint_list_zero(mask_max, freq_list_base);
-        dyspoissometer_freq_list_get(freq_list_base, mask_idx_max, mask_list_base, mask_max);
-        freq_max_minus_1=dyspoissometer_freq_max_minus_1_get(freq_list_base, mask_max);
-        dyspoissometer_pop_list_get(freq_list_base, freq_max_minus_1, mask_max, pop_list_base);
-        logfreedom=dyspoissometer_logfreedom_dense_get(freq_max_minus_1, 1, mask_idx_max, mask_max, pop_list_base);
-        logfreedom_list0_base[logfreedom_idx]=logfreedom;
-      }while((logfreedom_idx++)!=iteration_max);
-      dyspoissometer_number_list_sort(iteration_max, logfreedom_list0_base, logfreedom_list1_base);
-      median=logfreedom_list0_base[iteration_max>>1];
-      overflow_status=0;
+        chain_base=&chain_list_base[chain_idx];
+        chain_base->iteration_count_minus_1=iteration_count_minus_1;
+        thread_status_list_base[chain_idx]=0;
+#ifndef DEBUG
+        if(chain_idx){
+          thread_status_list_base[chain_idx]=!pthread_create(&thread_list_base[chain_idx], NULL, dyspoissometer_chain_thread_run, chain_base);
+        }
+#endif
+      }while((chain_idx++)!=chain_idx_max);
+      chain_idx=0;
+      do{
+        if(!thread_status_list_base[chain_idx]){
+          dyspoissometer_chain_thread_run(&chain_list_base[chain_idx]);
+        }
+      }while((chain_idx++)!=chain_idx_max);
+      chain_idx=0;
+      do{
+        if(thread_status_list_base[chain_idx]){
+          pthread_join(thread_list_base[chain_idx], NULL);
+        }
+      }while((chain_idx++)!=chain_idx_max);
+/*
+Find the chain with the best population list.
+*/
+      chain_idx=0;
+      chain_idx_best=0;
+      logfreedom_best=-1.0f;
+      do{
+        logfreedom=dyspoissometer_chain_logfreedom_get(&chain_list_base[chain_idx]);
+        if(logfreedom<0.0f){
+          overflow_status=1;
+        }else if(logfreedom_best<logfreedom){
+          chain_idx_best=chain_idx;
+          logfreedom_best=logfreedom;
+        }
+      }while((chain_idx++)!=chain_idx_max);
+      iteration+=iteration_count_minus_1;
+      if(logfreedom_max<logfreedom_best){
+        logfreedom_max=logfreedom_best;
+        iteration_last_change=iteration;
+      }
+      if(iteration_stall_max<=(iteration-iteration_last_change)){
+        done_status=1;
+      }
+      iteration++;
+      if(!(done_status|overflow_status)){
+/*
+Share the best population list with all the other chains.
+*/
+        chain_base=&chain_list_base[chain_idx_best];
+        chain_idx=0;
+        do{
+          if(chain_idx!=chain_idx_best){
+            overflow_status=(u8)(overflow_status|dyspoissometer_chain_copy(chain_base, &chain_list_base[chain_idx]));
+          }
+        }while((chain_idx++)!=chain_idx_max);
+      }
     }
-    dyspoissometer_free(pop_list_base);
-    dyspoissometer_free(mask_list_base);
-    dyspoissometer_free(logfreedom_list1_base);
-    dyspoissometer_free(logfreedom_list0_base);
-    dyspoissometer_free(freq_list_base);
-  }else{
-    median=LOG_SUM_N_PLUS_1(mask_max);
+    *random_seed_base=chain_list_base[0].marsaglia_p;
+    chain_idx=0;
+    do{
+      dyspoissometer_chain_free(&chain_list_base[chain_idx]);
+    }while((chain_idx++)!=chain_idx_max);
   }
+  dyspoissometer_free(thread_status_list_base);
+  dyspoissometer_free(thread_list_base);
+  dyspoissometer_free(chain_list_base);
   if(overflow_status){
-    median=-1.0f;
-  }else if(median<=0.0f){
-    median=0.0f;
+/*
+It's impossible to have a negative logfreedom, legitmately. Flag overflow to the caller.
+*/
+    logfreedom_max=-1.0f;
   }
-  return median;
+  return logfreedom_max;
 }
 
-DYSPOISSOMETER_NUMBER
-dyspoissometer_uint_list_logfreedom_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u32 mask_max, u16 *u16_list_base, u8 *u24_list_base, u32 *u32_list_base, u8 *u8_list_base){
+u64
+dyspoissometer_marsaglia_product_get(u64 factor0, u64 factor1){
 /*
-Get the logfreedom of a mask list.
+Multiply 2 Marsaglia oscillator states modulo DYSPOISSOMETER_MARSAGLIA_M. Because one step of the oscillator is just multiplication by DYSPOISSOMETER_MARSAGLIA_A modulo DYSPOISSOMETER_MARSAGLIA_M, this allows arbitrary jumps ahead.
 
 In:
 
-  mask_idx_max is the number of masks whose logfreedom to compute, less (mask_idx_min+1). On [mask_idx_min, DYSPOISSOMETER_UINT_MAX-1].
+  factor0 is on [0, DYSPOISSOMETER_MARSAGLIA_M-1].
 
-  mask_idx_min is the index of the first mask in the list whose logfreedom to compute. On [0, mask_idx_max].
+  factor1 is on [0, DYSPOISSOMETER_MARSAGLIA_M-1].
 
-  mask_max is the number of possible masks, whether or not they actually occur, less one.
+Out:
 
-  Exactly one of the following must be non(NULL):
+  Returns (factor0*factor1) modulo DYSPOISSOMETER_MARSAGLIA_M.
+*/
+  u64 product_hi;
+  u64 product_lo;
+  u64 residue;
+  u64 term;
 
-    u16_list_base is the base of a list of (mask_idx_max+1) (u16)s on [0, mask_max].
+  U64_PRODUCT_HI(factor0, factor1, product_hi);
+  product_lo=factor0*factor1;
+/*
+(2^64) is congruent to residue, which is less than 2^40, so folding the high half of the product back into the low half converges in a few iterations.
+*/
+  residue=(u64)(0ULL-DYSPOISSOMETER_MARSAGLIA_M);
+  while(product_hi){
+    factor0=product_hi;
+    U64_PRODUCT_HI(factor0, residue, product_hi);
+    term=factor0*residue;
+    product_lo+=term;
+    product_hi+=(product_lo<term);
+  }
+  if(DYSPOISSOMETER_MARSAGLIA_M<=product_lo){
+    product_lo-=DYSPOISSOMETER_MARSAGLIA_M;
+  }
+  return product_lo;
+}
 
-    u24_list_base is the base of a list of (mask_idx_max+1) (u24)s on [0, mask_max]. Note that their alignment is U8_SIZE, not U32_SIZE.
+u64
+dyspoissometer_random_seed_jump_get(u64 random_seed, u64 step_count){
+/*
+Jump a Marsaglia oscillator ahead by an arbitrary number of steps in logarithmic time. This allows threads or lanes to generate disjoint pieces of one pseudorandom sequence.
 
-    u32_list_base is the base of a list of (mask_idx_max+1) (u32)s on [0, mask_max].
+In:
 
-    u8_list_base is the base of a list of (mask_idx_max+1) (u8)s on [0, mask_max].
+  random_seed is as defined in dyspoissometer_logfreedom_max_get():In.
+
+  step_count is the number of oscillator steps to skip.
 
 Out:
 
-  Returns a rational but otherwise undefined negative value if we ran out of memory; else the logfreedom of the mask list, guaranteed to be nonnegative.
+  Returns the value of random_seed after step_count steps.
 */
-  DYSPOISSOMETER_UINT *freq_list0_base;
-  DYSPOISSOMETER_UINT *freq_list1_base;
-  DYSPOISSOMETER_NUMBER logfreedom;
-  u32 mask;
-  DYSPOISSOMETER_UINT mask_idx;
-  DYSPOISSOMETER_UINT mask_max_uint;
-  ULONG u8_idx;
+  u64 power;
 
-  logfreedom=0.0f;
-  if(mask_max){
-    logfreedom=-1.0f;
-    mask_max_uint=(DYSPOISSOMETER_UINT)(mask_max);
-    if(mask_max==mask_max_uint){
-      freq_list0_base=dyspoissometer_uint_list_malloc_zero(mask_max_uint);
-      freq_list1_base=dyspoissometer_uint_list_malloc(mask_max_uint);
-      if(freq_list0_base&&freq_list1_base){
-        mask_idx=mask_idx_min;
-        if(u8_list_base){
-          do{
-            mask=u8_list_base[mask_idx];
-            freq_list0_base[mask]++;
-          }while((mask_idx++)!=mask_idx_max);
-        }else if(u16_list_base){
-          do{
-            mask=u16_list_base[mask_idx];
-            freq_list0_base[mask]++;
-          }while((mask_idx++)!=mask_idx_max);
-        }else if(u24_list_base){
-          u8_idx=(ULONG)((ULONG)(mask_idx_min)*3);
-          do{
-            mask=(u32)((u32)(u24_list_base[u8_idx+2])<<U16_BITS)+(u16)((u16)(u24_list_base[u8_idx+1])<<U8_BITS)+u24_list_base[u8_idx];
-            freq_list0_base[mask]++;
-            u8_idx=(ULONG)(u8_idx+3);
-          }while((mask_idx++)!=mask_idx_max);
-        }else{
-          do{
-            mask=u32_list_base[mask_idx];
-            freq_list0_base[mask]++;
-          }while((mask_idx++)!=mask_idx_max);
-        }
-        logfreedom=dyspoissometer_logfreedom_sparse_get(freq_list0_base, freq_list1_base, mask_max_uint);
-      }
-      dyspoissometer_free(freq_list1_base);
-      dyspoissometer_free(freq_list0_base);
+  power=DYSPOISSOMETER_MARSAGLIA_A;
+  while(step_count){
+    if(step_count&1){
+      random_seed=dyspoissometer_marsaglia_product_get(power, random_seed);
+    }
+    step_count>>=1;
+    if(step_count){
+      power=dyspoissometer_marsaglia_product_get(power, power);
     }
   }
-  return logfreedom;
+  return random_seed;
 }
 
-DYSPOISSOMETER_NUMBER
-dyspoissometer_uint_list_mean_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u8 sign_status, u16 *u16_list_base, u8 *u24_list_base, u32 *u32_list_base, u8 *u8_list_base){
+void
+dyspoissometer_mask_list_pseudorandom_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT *mask_list_base, DYSPOISSOMETER_UINT mask_max, u64 *random_seed_base){
 /*
-Get the mean of a mask list consisting of (un)signed integers.
+Generate a pseudorandom mask list consistent with a given mask count and mask span.
 
 In:
 
-  mask_idx_max is the number of masks whose mean to compute, less (mask_idx_min+1). On [mask_idx_min, DYSPOISSOMETER_UINT_MAX-1].
+  mask_idx_max is as defined in dyspoissometer_logfreedom_max_get().
 
-  mask_idx_min is the index of the first mask in the list whose mean to compute. On [0, mask_idx_max].
+  *mask_list_base is as it was previously returned from this function, or (mask_idx_max+1) zeroes on the first call.
 
-  sign_status is one if the list of so-called uints actually consists of (signed) ints, else zero. (As far as the compiler is concerned, they're uints in either case so we don't get into signed overflow badness.)
+  mask_max is as defined in dyspoissometer_logfreedom_max_get().
 
-  Exactly one of the following must be non(NULL):
+  *random_seed_base is as defined in dyspoissometer_logfreedom_max_get():In.
 
-    u16_list_base is the base of a list of (mask_idx_max+1) (u16)s on [0, mask_max].
+Out:
 
-    u24_list_base is the base of a list of (mask_idx_max+1) (u24)s on [0, mask_max]. Note that their alignment is U8_SIZE, not U32_SIZE.
+  Returns the value of random_seed to use on the next call.
 
-    u32_list_base is the base of a list of (mask_idx_max+1) (u32)s on [0, mask_max].
-
-    u8_list_base is the base of a list of (mask_idx_max+1) (u8)s on [0, mask_max].
-
-Out:
+  *mask_list_base will contain a mask list consistent with mask_idx_max and mask_max, which was selected from an essentially uniform distribution of all possible mask lists.
 
-  Returns the mean of the mask list, guaranteed to be at least the minimum and at most the maximum (un)signed integer representable as a mask of the same format as in the nonnull input list. However, the mean is rational and generally not an integer. It may also be less than the minimum or greater than the maximum mask in the list due to numerical error.
+  *random_seed_base is as defined in dyspoissometer_logfreedom_max_get():Out.
 */
-  u64 int_sum;
-  u32 mask;
-  u64 mask_count;
+  u8 lane_idx;
+  u8 lane_idx_max;
+  DYSPOISSOMETER_UINT lane_mask_idx;
+  DYSPOISSOMETER_UINT lane_mask_idx_max;
+  DYSPOISSOMETER_UINT lane_mask_idx_span;
+  u64 marsaglia_p;
+  u64 marsaglia_p_jump;
+  u64 marsaglia_p_list_base[DYSPOISSOMETER_MARSAGLIA_LANE_IDX_MAX+1];
+  DYSPOISSOMETER_UINT mask;
+  DYSPOISSOMETER_UINT mask_delta;
   DYSPOISSOMETER_UINT mask_idx;
-  u32 mask_max;
-  i64 mask_max_max;
-  u32 mask_min;
-  i64 mask_min_min;
-  DYSPOISSOMETER_NUMBER mean;
-  ULONG u8_idx;
-  u64 uint_sum;
-
-  mask_idx=mask_idx_min;
-  int_sum=0;
-  uint_sum=0;
-  if(!sign_status){
-    mask_max=0;
-    mask_min=U32_MAX;
-  }else{
-    mask_max=U32_SPAN_HALF;
-    mask_min=I32_MAX;
-  }
-  if(u8_list_base){
-    mask_max>>=U32_BITS-U8_BITS;
-    mask_min>>=U32_BITS-U8_BITS;
-  }else if(u16_list_base){
-    mask_max>>=U32_BITS-U16_BITS;
-    mask_min>>=U32_BITS-U16_BITS;
-  }else if(u24_list_base){
-    mask_max>>=U32_BITS-U24_BITS;
-    mask_min>>=U32_BITS-U24_BITS;
+  DYSPOISSOMETER_UINT mask_idx_min;
+  DYSPOISSOMETER_UINT mask_span;
+  DYSPOISSOMETER_UINT mask_wrap;
+  u8 mode;
+  u64 product_hi;
+  u8 remainder_status;
+
+  lane_idx_max=0;
+  lane_mask_idx_max=mask_idx_max;
+  lane_mask_idx_span=0;
+  marsaglia_p=*random_seed_base;
+  mask_idx_min=0;
+  mask_span=(DYSPOISSOMETER_UINT)(mask_max+1);
+/*
+Use modulo summation, over mask_span, of the previous mask value and a Marsaglia pseudorandom value to obtain new masks. This leads to essentially unbiased mask lists, despite the slight high bit bias of the oscillator. If mask_span is a power of 2 (mode 0), then we can just use "&". Otherwise, scale the oscillator state to [0, mask_max] by taking the high half of its product with mask_span, which is much cheaper than "%". If mask_span fits in 32 bits (mode 1), then the low half of the state, which lacks the high bit bias of the carry, suffices. Otherwise (mode 2), use all of it.
+*/
+  mode=0;
+  if(mask_max&mask_span){
+    mode=1;
+    if((u64)(mask_max)>>U32_BITS){
+      mode=2;
+    }
   }
-  mask_max_max=mask_min;
-  mask_min_min=0;
-  if(sign_status){
-    mask_min_min=(~mask_max)+1;
-    mask_min_min=-mask_min_min;
+/*
+A single oscillator is latency bound, so split the list into (DYSPOISSOMETER_MARSAGLIA_LANE_IDX_MAX+1) equal pieces, each with its own oscillator jumped ahead to the start of its piece, and step them all in lockstep. Then finish the remainder, if any, with one lane. The result is identical to that of a single oscillator.
+*/
+  lane_mask_idx=(DYSPOISSOMETER_UINT)((mask_idx_max>>DYSPOISSOMETER_MARSAGLIA_LANE_COUNT_LOG2)+((mask_idx_max&DYSPOISSOMETER_MARSAGLIA_LANE_IDX_MAX)==DYSPOISSOMETER_MARSAGLIA_LANE_IDX_MAX));
+  marsaglia_p_list_base[0]=marsaglia_p;
+  if(DYSPOISSOMETER_MARSAGLIA_LANE_MASK_COUNT_MIN<=lane_mask_idx){
+    lane_idx_max=DYSPOISSOMETER_MARSAGLIA_LANE_IDX_MAX;
+    lane_mask_idx_max=(DYSPOISSOMETER_UINT)(lane_mask_idx-1);
+    lane_mask_idx_span=lane_mask_idx;
+    marsaglia_p_jump=dyspoissometer_random_seed_jump_get(1, lane_mask_idx_span);
+    lane_idx=0;
+    do{
+      marsaglia_p=dyspoissometer_marsaglia_product_get(marsaglia_p, marsaglia_p_jump);
+      marsaglia_p_list_base[lane_idx+1]=marsaglia_p;
+    }while((++lane_idx)!=lane_idx_max);
   }
-  if(u8_list_base){
+  do{
+    mask_idx=mask_idx_min;
     do{
-      mask=u8_list_base[mask_idx];
-      if(!sign_status){
-        mask_max=MAX(mask, mask_max);
-        mask_min=MIN(mask, mask_min);
-        uint_sum+=mask;
-      }else{
-        if(mask<=I8_MAX){
-          int_sum+=mask;
-          mask_max=MAX(mask, mask_max);
-          if(mask_min<=I8_MAX){
-            mask_min=MIN(mask, mask_min);
-          }
+      lane_idx=0;
+      lane_mask_idx=mask_idx;
+      do{
+        marsaglia_p=marsaglia_p_list_base[lane_idx];
+        mask=mask_list_base[lane_mask_idx];
+        if(!mode){
+          mask=(DYSPOISSOMETER_UINT)((marsaglia_p+mask)&mask_max);
         }else{
-          int_sum--;
-          int_sum-=(u8)(~mask);
-          if(I8_MAX<mask_max){
-            mask_max=MAX(mask, mask_max);
+          if(mode==1){
+            product_hi=((u64)((u32)(marsaglia_p))*mask_span)>>U32_BITS;
+          }else{
+            U64_PRODUCT_HI(marsaglia_p, (u64)(mask_span), product_hi);
           }
-          mask_min=MIN(mask, mask_min);
+/*
+Add product_hi to mask, modulo mask_span, without a branch that would be mispredicted about half the time.
+*/
+          mask_delta=(DYSPOISSOMETER_UINT)(product_hi);
+          mask_wrap=(DYSPOISSOMETER_UINT)((DYSPOISSOMETER_UINT)(mask_max-mask)<mask_delta);
+          mask_wrap=(DYSPOISSOMETER_UINT)(0U-mask_wrap);
+          mask=(DYSPOISSOMETER_UINT)(mask+mask_delta-(mask_span&mask_wrap));
         }
-      }
-    }while((mask_idx++)!=mask_idx_max);
-  }else if(u16_list_base){
+        marsaglia_p_list_base[lane_idx]=((u64)((u32)(marsaglia_p))*DYSPOISSOMETER_MARSAGLIA_A)+(marsaglia_p>>U32_BITS);
+        mask_list_base[lane_mask_idx]=mask;
+        lane_mask_idx=(DYSPOISSOMETER_UINT)(lane_mask_idx+lane_mask_idx_span);
+      }while((lane_idx++)!=lane_idx_max);
+    }while((mask_idx++)!=(DYSPOISSOMETER_UINT)(mask_idx_min+lane_mask_idx_max));
+/*
+The last lane ends where the remainder, if any, begins.
+*/
+    marsaglia_p=marsaglia_p_list_base[lane_idx_max];
+    marsaglia_p_list_base[0]=marsaglia_p;
+    remainder_status=(lane_idx_max&&((mask_idx_max&DYSPOISSOMETER_MARSAGLIA_LANE_IDX_MAX)!=DYSPOISSOMETER_MARSAGLIA_LANE_IDX_MAX));
+    if(remainder_status){
+      lane_idx_max=0;
+      mask_idx_min=(DYSPOISSOMETER_UINT)(lane_mask_idx_span<<DYSPOISSOMETER_MARSAGLIA_LANE_COUNT_LOG2);
+      lane_mask_idx_max=(DYSPOISSOMETER_UINT)(mask_idx_max-mask_idx_min);
+    }
+  }while(remainder_status);
+  *random_seed_base=marsaglia_p;
+  return;
+}
+
+void
+dyspoissometer_number_list_sort(DYSPOISSOMETER_UINT number_idx_max, DYSPOISSOMETER_NUMBER *number_list0_base, DYSPOISSOMETER_NUMBER *number_list1_base){
+/*
+Sort a list of (DYSPOISSOMETER_NUMBER)s ascending, using double buffering for speed.
+
+In:
+
+  number_idx_max is one less than the number of items in each list.
+
+  *number_list0_base contains (number_idx_max+1) items to sort, none of which are NaN. Negative zero sorts just before positive zero.
+
+  *number_list1_base is undefined and writable for (number_idx_max+1) items.
+
+Out:
+
+  *number_list0_base is sorted ascending.
+
+  *number_list1_base is undefined. 
+*/
+  u8 continue_status;
+  u16 digit_mask;
+  DYSPOISSOMETER_UINT *key_digit_idx_list_base;
+  DYSPOISSOMETER_UINT key_digit_idx_list_base_list[DYSPOISSOMETER_NUMBER_KEY_DIGIT_COUNT][DYSPOISSOMETER_NUMBER_KEY_DIGIT_SPAN];
+  DYSPOISSOMETER_UINT key_digit;
+  DYSPOISSOMETER_UINT key_digit_freq;
+  u8 key_digit_idx;
+  u8 key_digit_idx_max;
+  u8 key_digit_shift;
+  u8 key_digit_word_idx;
+  u8 *key_list0_base;
+  u8 *key_list1_base;
+  u8 *key_list2_base;
+  DYSPOISSOMETER_NUMBER_KEY_WORD key_word_list_base[DYSPOISSOMETER_NUMBER_KEY_WORD_IDX_MAX+1];
+  u8 key_word_idx;
+  DYSPOISSOMETER_NUMBER_KEY_WORD key_word_mask;
+  DYSPOISSOMETER_NUMBER_KEY_WORD key_word_old_list_base[DYSPOISSOMETER_NUMBER_KEY_WORD_IDX_MAX+1];
+  ULONG list_size;
+  DYSPOISSOMETER_UINT number_idx0;
+  DYSPOISSOMETER_UINT number_idx1;
+
+/*
+Radix sort order-preserving integer keys rather than the numbers themselves. A key is the IEEE 754 representation of a number, viewed as an unsigned integer made of (DYSPOISSOMETER_NUMBER_KEY_WORD_IDX_MAX+1) little-endian words, with its sign bit set if it was clear, or all of its bits inverted if the sign bit was set. This maps negatives below positives in the correct order, and negative zero just below positive zero.
+
+The keys for some numbers, such as negative zero and negative subnormals, are NaN bit patterns. Loading and storing those as floating-point values could alter them (for instance, on an X87 FPU), so keys are only ever held in (DYSPOISSOMETER_NUMBER_KEY_WORD)s, and moved to and from the memory of the number lists, which we treat as key lists of DYSPOISSOMETER_NUMBER_SIZE bytes per key, via memcpy(). Likewise, the numbers themselves are moved via memcpy() so that their bits survive intact.
+
+First, translate *number_list0_base into keys at number_list1_base, while counting the frequencies of every digit of the keys at once. Note whether the keys are already sorted, in which case so are the numbers, and there's nothing more to do.
+*/
+  key_list0_base=(u8 *)(number_list0_base);
+  key_list1_base=(u8 *)(number_list1_base);
+  memset(key_digit_idx_list_base_list, 0, sizeof(key_digit_idx_list_base_list));
+  memset(key_word_old_list_base, 0, sizeof(key_word_old_list_base));
+  continue_status=0;
+  number_idx0=0;
+  do{
+    memcpy(key_word_list_base, &key_list0_base[(ULONG)(number_idx0)*DYSPOISSOMETER_NUMBER_SIZE], (size_t)(DYSPOISSOMETER_NUMBER_SIZE));
+    key_word_mask=(DYSPOISSOMETER_NUMBER_KEY_WORD)(0U-(key_word_list_base[DYSPOISSOMETER_NUMBER_KEY_WORD_IDX_MAX]>>(DYSPOISSOMETER_NUMBER_KEY_WORD_BITS-1)));
+    key_word_list_base[DYSPOISSOMETER_NUMBER_KEY_WORD_IDX_MAX]|=DYSPOISSOMETER_NUMBER_KEY_WORD_SIGN;
+    key_digit_idx=0;
+    key_word_idx=0;
     do{
-      mask=u16_list_base[mask_idx];
-      if(!sign_status){
-        mask_max=MAX(mask, mask_max);
-        mask_min=MIN(mask, mask_min);
-        uint_sum+=mask;
-      }else{
-        if(mask<=I16_MAX){
-          int_sum+=mask;
-          mask_max=MAX(mask, mask_max);
-          if(mask_min<=I16_MAX){
-            mask_min=MIN(mask, mask_min);
-          }
-        }else{
-          int_sum--;
-          int_sum-=(u16)(~mask);
-          if(I16_MAX<mask_max){
-            mask_max=MAX(mask, mask_max);
-          }
-          mask_min=MIN(mask, mask_min);
-        }
+      key_word_list_base[key_word_idx]^=key_word_mask;
+      key_digit_shift=0;
+      do{
+        key_digit=(DYSPOISSOMETER_UINT)((key_word_list_base[key_word_idx]>>key_digit_shift)&DYSPOISSOMETER_NUMBER_KEY_DIGIT_MAX);
+        key_digit_idx_list_base_list[key_digit_idx][key_digit]++;
+        key_digit_idx++;
+        key_digit_shift=(u8)(key_digit_shift+DYSPOISSOMETER_NUMBER_KEY_DIGIT_BITS);
+      }while(key_digit_shift<DYSPOISSOMETER_NUMBER_KEY_WORD_BITS);
+    }while((key_word_idx++)!=DYSPOISSOMETER_NUMBER_KEY_WORD_IDX_MAX);
+/*
+Compare this key to the previous one (or to zero, which is less than all keys, for the first one), most significant word first.
+*/
+    key_word_idx=DYSPOISSOMETER_NUMBER_KEY_WORD_IDX_MAX;
+    while(key_word_idx&&(key_word_list_base[key_word_idx]==key_word_old_list_base[key_word_idx])){
+      key_word_idx--;
+    }
+    continue_status=(u8)(continue_status|(key_word_list_base[key_word_idx]<key_word_old_list_base[key_word_idx]));
+    memcpy(key_word_old_list_base, key_word_list_base, sizeof(key_word_list_base));
+    memcpy(&key_list1_base[(ULONG)(number_idx0)*DYSPOISSOMETER_NUMBER_SIZE], key_word_list_base, (size_t)(DYSPOISSOMETER_NUMBER_SIZE));
+  }while((number_idx0++)!=number_idx_max);
+  if(continue_status){
+/*
+Set a bit in digit_mask for each digit which is not constant, i.e. for which a pass would not be an identity permutation. With numbers of similar magnitude, this typically eliminates the digits containing the sign and high exponent bits, as well as any low mantissa digits which happen to be zero. At least one bit must be set, because the list isn't sorted. key_digit_idx_max is the last such digit.
+*/
+    memcpy(key_word_list_base, &key_list1_base[0], (size_t)(DYSPOISSOMETER_NUMBER_SIZE));
+    digit_mask=0;
+    key_digit_idx=0;
+    key_digit_idx_max=0;
+    do{
+      key_digit_word_idx=(u8)(key_digit_idx/DYSPOISSOMETER_NUMBER_KEY_WORD_DIGIT_COUNT);
+      key_digit_shift=(u8)((key_digit_idx%DYSPOISSOMETER_NUMBER_KEY_WORD_DIGIT_COUNT)*DYSPOISSOMETER_NUMBER_KEY_DIGIT_BITS);
+      key_digit=(DYSPOISSOMETER_UINT)((key_word_list_base[key_digit_word_idx]>>key_digit_shift)&DYSPOISSOMETER_NUMBER_KEY_DIGIT_MAX);
+      if(key_digit_idx_list_base_list[key_digit_idx][key_digit]!=(DYSPOISSOMETER_UINT)(number_idx_max+1)){
+        digit_mask=(u16)(digit_mask|(1U<<key_digit_idx));
+        key_digit_idx_max=key_digit_idx;
       }
-    }while((mask_idx++)!=mask_idx_max);
-  }else if(u24_list_base){
-    u8_idx=(ULONG)((ULONG)(mask_idx_min)*3);
+    }while((key_digit_idx++)!=(DYSPOISSOMETER_NUMBER_KEY_DIGIT_COUNT-1));
+/*
+Perform a stable radix sort of the keys at key_list1_base by each nonconstant digit, least significant first, alternating between the lists. On the last pass, translate the keys back to numbers.
+*/
+    key_digit_idx=0;
     do{
-      mask=(u32)((u32)(u24_list_base[u8_idx+2])<<U16_BITS)+(u16)((u16)(u24_list_base[u8_idx+1])<<U8_BITS)+u24_list_base[u8_idx];
-      u8_idx=(ULONG)(u8_idx+3);
-      if(!sign_status){
-        mask_max=MAX(mask, mask_max);
-        mask_min=MIN(mask, mask_min);
-        uint_sum+=mask;
-      }else{
-        if(mask<=I24_MAX){
-          int_sum+=mask;
-          mask_max=MAX(mask, mask_max);
-          if(mask_min<=I24_MAX){
-            mask_min=MIN(mask, mask_min);
-          }
+      if((digit_mask>>key_digit_idx)&1){
+/*
+Convert *key_digit_idx_list_base from a list of frequencies of digits to a list of preceding cummulative sums thereof.
+*/
+        key_digit_idx_list_base=key_digit_idx_list_base_list[key_digit_idx];
+        key_digit=0;
+        number_idx0=0;
+        do{
+          key_digit_freq=key_digit_idx_list_base[key_digit];
+          key_digit_idx_list_base[key_digit]=number_idx0;
+          number_idx0=(DYSPOISSOMETER_UINT)(number_idx0+key_digit_freq);
+        }while((key_digit++)!=DYSPOISSOMETER_NUMBER_KEY_DIGIT_MAX);
+        key_digit_word_idx=(u8)(key_digit_idx/DYSPOISSOMETER_NUMBER_KEY_WORD_DIGIT_COUNT);
+        key_digit_shift=(u8)((key_digit_idx%DYSPOISSOMETER_NUMBER_KEY_WORD_DIGIT_COUNT)*DYSPOISSOMETER_NUMBER_KEY_DIGIT_BITS);
+        number_idx0=0;
+        if(key_digit_idx!=key_digit_idx_max){
+          do{
+            memcpy(key_word_list_base, &key_list1_base[(ULONG)(number_idx0)*DYSPOISSOMETER_NUMBER_SIZE], (size_t)(DYSPOISSOMETER_NUMBER_SIZE));
+            key_digit=(DYSPOISSOMETER_UINT)((key_word_list_base[key_digit_word_idx]>>key_digit_shift)&DYSPOISSOMETER_NUMBER_KEY_DIGIT_MAX);
+            number_idx1=key_digit_idx_list_base[key_digit];
+            memcpy(&key_list0_base[(ULONG)(number_idx1)*DYSPOISSOMETER_NUMBER_SIZE], key_word_list_base, (size_t)(DYSPOISSOMETER_NUMBER_SIZE));
+            key_digit_idx_list_base[key_digit]=(DYSPOISSOMETER_UINT)(number_idx1+1);
+          }while((number_idx0++)!=number_idx_max);
         }else{
-          int_sum--;
-          int_sum-=(u32)((~mask)&U24_MAX);
-          if(I24_MAX<mask_max){
-            mask_max=MAX(mask, mask_max);
-          }
-          mask_min=MIN(mask, mask_min);
+          do{
+            memcpy(key_word_list_base, &key_list1_base[(ULONG)(number_idx0)*DYSPOISSOMETER_NUMBER_SIZE], (size_t)(DYSPOISSOMETER_NUMBER_SIZE));
+            key_digit=(DYSPOISSOMETER_UINT)((key_word_list_base[key_digit_word_idx]>>key_digit_shift)&DYSPOISSOMETER_NUMBER_KEY_DIGIT_MAX);
+            key_word_mask=(DYSPOISSOMETER_NUMBER_KEY_WORD)((key_word_list_base[DYSPOISSOMETER_NUMBER_KEY_WORD_IDX_MAX]>>(DYSPOISSOMETER_NUMBER_KEY_WORD_BITS-1))-1U);
+            key_word_list_base[DYSPOISSOMETER_NUMBER_KEY_WORD_IDX_MAX]&=(DYSPOISSOMETER_NUMBER_KEY_WORD)(~DYSPOISSOMETER_NUMBER_KEY_WORD_SIGN);
+            key_word_idx=0;
+            do{
+              key_word_list_base[key_word_idx]^=key_word_mask;
+            }while((key_word_idx++)!=DYSPOISSOMETER_NUMBER_KEY_WORD_IDX_MAX);
+            number_idx1=key_digit_idx_list_base[key_digit];
+            memcpy(&key_list0_base[(ULONG)(number_idx1)*DYSPOISSOMETER_NUMBER_SIZE], key_word_list_base, (size_t)(DYSPOISSOMETER_NUMBER_SIZE));
+            key_digit_idx_list_base[key_digit]=(DYSPOISSOMETER_UINT)(number_idx1+1);
+          }while((number_idx0++)!=number_idx_max);
         }
+/*
+Swap list bases in order to accomplish double buffering.
+*/
+        key_list2_base=key_list0_base;
+        key_list0_base=key_list1_base;
+        key_list1_base=key_list2_base;
+        continue_status=(u8)(continue_status^1);
       }
-    }while((mask_idx++)!=mask_idx_max);
-  }else{
+    }while((key_digit_idx++)!=key_digit_idx_max);
+    if(continue_status){
+/*
+There were an even number of passes, so the sorted numbers are at what is, from the caller's perspective, number_list1_base. Copy them back to number_list0_base.
+*/
+      list_size=(ULONG)(number_idx_max);
+      list_size++;
+      list_size=(ULONG)(list_size*DYSPOISSOMETER_NUMBER_SIZE);
+      memcpy(number_list0_base, number_list1_base, (size_t)(list_size));
+    }
+  }
+  return;
+}
+
+DYSPOISSOMETER_NUMBER
+dyspoissometer_number_list_select(DYSPOISSOMETER_UINT number_idx, DYSPOISSOMETER_UINT number_idx_max, DYSPOISSOMETER_NUMBER *number_list_base){
+/*
+Find the item which would be at a given index if a list of (DYSPOISSOMETER_NUMBER)s were sorted ascending, without actually sorting it. This is a quickselect with median-of-3 pivots and 3-way partitioning, which takes linear time on average, and does not suffer on lists with many duplicates.
+
+In:
+
+  number_idx is the index of the item to find, on [0, number_idx_max].
+
+  number_idx_max is one less than the number of items in the list, on [0, DYSPOISSOMETER_UINT_MAX-1].
+
+  *number_list_base contains (number_idx_max+1) items.
+
+Out:
+
+  Returns the item which would be at number_list_base[number_idx] if *number_list_base were sorted ascending.
+
+  *number_list_base has been partially reordered.
+*/
+  DYSPOISSOMETER_NUMBER number;
+  DYSPOISSOMETER_NUMBER number_hi;
+  DYSPOISSOMETER_UINT number_idx_hi;
+  DYSPOISSOMETER_UINT number_idx_lo;
+  DYSPOISSOMETER_UINT number_idx_max_partial;
+  DYSPOISSOMETER_UINT number_idx_min;
+  DYSPOISSOMETER_UINT number_idx_mid;
+  DYSPOISSOMETER_NUMBER number_lo;
+  DYSPOISSOMETER_NUMBER number_mid;
+  DYSPOISSOMETER_NUMBER pivot;
+
+  number_idx_max_partial=number_idx_max;
+  number_idx_min=0;
+  while(number_idx_min!=number_idx_max_partial){
+/*
+Choose the median of the first, middle, and last items as the pivot, so that sorted or reverse-sorted input doesn't cause quadratic behavior.
+*/
+    number_idx_mid=(DYSPOISSOMETER_UINT)(number_idx_min+((DYSPOISSOMETER_UINT)(number_idx_max_partial-number_idx_min)>>1));
+    number_lo=number_list_base[number_idx_min];
+    number_mid=number_list_base[number_idx_mid];
+    number_hi=number_list_base[number_idx_max_partial];
+    pivot=number_mid;
+    if(number_lo<number_mid){
+      if(number_hi<number_mid){
+        pivot=MAX(number_lo, number_hi);
+      }
+    }else if(number_mid<number_hi){
+      pivot=MIN(number_lo, number_hi);
+    }
+/*
+Partition [number_idx_min, number_idx_max_partial] into items less than pivot on [number_idx_min, number_idx_lo-1], items equal to pivot on [number_idx_lo, number_idx_hi-1], and items greater than pivot on [number_idx_hi, number_idx_max_partial]. number_idx is the scan index.
+*/
+    number_idx_lo=number_idx_min;
+    number_idx_hi=(DYSPOISSOMETER_UINT)(number_idx_max_partial+1);
+    number_idx_mid=number_idx_min;
     do{
-      mask=u32_list_base[mask_idx];
-      if(!sign_status){
-        mask_max=MAX(mask, mask_max);
-        mask_min=MIN(mask, mask_min);
-        uint_sum+=mask;
+      number=number_list_base[number_idx_mid];
+      if(number<pivot){
+        number_list_base[number_idx_mid]=number_list_base[number_idx_lo];
+        number_list_base[number_idx_lo]=number;
+        number_idx_lo++;
+        number_idx_mid++;
+      }else if(pivot<number){
+        number_idx_hi--;
+        number_list_base[number_idx_mid]=number_list_base[number_idx_hi];
+        number_list_base[number_idx_hi]=number;
       }else{
-        if(mask<=I32_MAX){
-          int_sum+=mask;
-          mask_max=MAX(mask, mask_max);
-          if(mask_min<=INT32_MAX){
-            mask_min=MIN(mask, mask_min);
-          }
-        }else{
-          int_sum--;
-          int_sum-=(u32)(~mask);
-          if(I32_MAX<mask_max){
-            mask_max=MAX(mask, mask_max);
-          }
-          mask_min=MIN(mask, mask_min);
-        }
+        number_idx_mid++;
       }
-    }while((mask_idx++)!=mask_idx_max);
-  }
-  mean=(DYSPOISSOMETER_NUMBER)(uint_sum);
-  if(sign_status){
-    mean=(DYSPOISSOMETER_NUMBER)(int_sum);
-    if(int_sum>>U64_BIT_MAX){
-      mean=(DYSPOISSOMETER_NUMBER)((~int_sum)+1);
-      mean=-mean;
+    }while(number_idx_mid!=number_idx_hi);
+    if(number_idx<number_idx_lo){
+      number_idx_max_partial=(DYSPOISSOMETER_UINT)(number_idx_lo-1);
+    }else if(number_idx_hi<=number_idx){
+      number_idx_min=number_idx_hi;
+    }else{
+      return pivot;
     }
   }
-  mask_count=((u64)(mask_idx_max)-mask_idx_min)+1;
-  mean=mean/(DYSPOISSOMETER_NUMBER)(mask_count);
-  if(mean<mask_min_min){
-    mean=(DYSPOISSOMETER_NUMBER)(mask_min_min);
-  }else if(mask_max_max<mean){
-    mean=(DYSPOISSOMETER_NUMBER)(mask_max_max);
+  number=number_list_base[number_idx_min];
+  return number;
+}
+
+u8
+dyspoissometer_quantile_init(DYSPOISSOMETER_UINT buffer_idx_max, dyspoissometer_quantile_t *quantile_base){
+/*
+Initialize a streaming quantile estimator. It accepts an unlimited number of samples (well, up to U64_MAX) in bounded memory, and then returns an approximate quantile with a guaranteed bound on its rank error.
+
+This is a Munro-Paterson compactor: samples accumulate in an input buffer; when it fills up, it's sorted and carried into a stack of levels like a binary counter. Each level holds either nothing or one sorted buffer whose samples each represent 2^(level index) original samples. When a carry lands on an occupied level, the 2 buffers are merged and every other item is kept (alternating between even and odd items on successive merges at the same level, to avoid bias). Each such merge at level L moves the rank of any value by at most 2^L, so the sum of all such amounts is a hard bound on the rank error of the final result.
+
+In:
+
+  buffer_idx_max is the number of items in each buffer, less one. It must be odd, and on [1, DYSPOISSOMETER_UINT_MAX>>1]. Larger values cost more memory but reduce the rank error. Memory usage is about (buffer_idx_max+1)*(log2(sample_count/(buffer_idx_max+1))+4) (DYSPOISSOMETER_NUMBER)s.
+
+  *quantile_base is undefined.
+
+Out:
+
+  Returns one if we ran out of memory, else zero. In either case, *quantile_base must eventually be freed via dyspoissometer_quantile_free().
+
+  *quantile_base is ready for use by dyspoissometer_quantile_add().
+*/
+  DYSPOISSOMETER_NUMBER *carry_list_base;
+  DYSPOISSOMETER_NUMBER *input_list_base;
+  u8 level_idx;
+  DYSPOISSOMETER_NUMBER *scratch_list_base;
+  u8 status;
+
+  carry_list_base=dyspoissometer_number_list_malloc(buffer_idx_max);
+  input_list_base=dyspoissometer_number_list_malloc(buffer_idx_max);
+  scratch_list_base=dyspoissometer_number_list_malloc((DYSPOISSOMETER_UINT)((DYSPOISSOMETER_UINT)(buffer_idx_max<<1)+1));
+  level_idx=0;
+  do{
+    quantile_base->level_list_base_list[level_idx]=NULL;
+  }while((++level_idx)!=DYSPOISSOMETER_QUANTILE_LEVEL_COUNT);
+  quantile_base->buffer_idx_max=buffer_idx_max;
+  quantile_base->carry_list_base=carry_list_base;
+  quantile_base->input_count=0;
+  quantile_base->input_list_base=input_list_base;
+  quantile_base->level_parity_mask=0;
+  quantile_base->level_status_mask=0;
+  quantile_base->rank_error_max=0;
+  quantile_base->sample_count=0;
+  quantile_base->scratch_list_base=scratch_list_base;
+  status=!(carry_list_base&&input_list_base&&scratch_list_base);
+  return status;
+}
+
+void
+dyspoissometer_quantile_free(dyspoissometer_quantile_t *quantile_base){
+/*
+Free all memory owned by a streaming quantile estimator.
+
+In:
+
+  *quantile_base is as returned by dyspoissometer_quantile_init(), regardless of success.
+
+Out:
+
+  All lists owned by *quantile_base have been freed.
+*/
+  u8 level_idx;
+
+  level_idx=0;
+  do{
+    quantile_base->level_list_base_list[level_idx]=dyspoissometer_free(quantile_base->level_list_base_list[level_idx]);
+  }while((++level_idx)!=DYSPOISSOMETER_QUANTILE_LEVEL_COUNT);
+  quantile_base->scratch_list_base=dyspoissometer_free(quantile_base->scratch_list_base);
+  quantile_base->input_list_base=dyspoissometer_free(quantile_base->input_list_base);
+  quantile_base->carry_list_base=dyspoissometer_free(quantile_base->carry_list_base);
+  return;
+}
+
+u8
+dyspoissometer_quantile_add(dyspoissometer_quantile_t *quantile_base, DYSPOISSOMETER_NUMBER number){
+/*
+Add a sample to a streaming quantile estimator.
+
+In:
+
+  *quantile_base is as returned by dyspoissometer_quantile_init() or a previous call to this function, provided that neither of them failed.
+
+  number is the sample to add. It must not be NaN.
+
+Out:
+
+  Returns one if we ran out of memory, in which case *quantile_base is only good for dyspoissometer_quantile_free(); else zero.
+
+  *quantile_base has absorbed number.
+*/
+  DYSPOISSOMETER_UINT buffer_idx;
+  DYSPOISSOMETER_UINT buffer_idx_max;
+  DYSPOISSOMETER_NUMBER *carry_list_base;
+  DYSPOISSOMETER_UINT input_count;
+  DYSPOISSOMETER_NUMBER *input_list_base;
+  DYSPOISSOMETER_NUMBER *level_list_base;
+  u8 level_idx;
+  u64 level_mask;
+  u64 level_status_mask;
+  DYSPOISSOMETER_UINT merge_idx0;
+  DYSPOISSOMETER_UINT merge_idx1;
+  u8 parity;
+  DYSPOISSOMETER_NUMBER *scratch_list_base;
+  DYSPOISSOMETER_UINT scratch_idx;
+  DYSPOISSOMETER_UINT scratch_idx_max;
+  u8 status;
+
+  buffer_idx_max=quantile_base->buffer_idx_max;
+  input_count=quantile_base->input_count;
+  input_list_base=quantile_base->input_list_base;
+  input_list_base[input_count]=number;
+  quantile_base->sample_count++;
+  status=0;
+  if(input_count!=buffer_idx_max){
+    input_count++;
+  }else{
+/*
+The input buffer is full. Sort it and swap it with the carry buffer, then carry it up through the occupied levels.
+*/
+    input_count=0;
+    scratch_list_base=quantile_base->scratch_list_base;
+    dyspoissometer_number_list_sort(buffer_idx_max, input_list_base, scratch_list_base);
+    carry_list_base=input_list_base;
+    quantile_base->input_list_base=quantile_base->carry_list_base;
+    level_idx=0;
+    level_status_mask=quantile_base->level_status_mask;
+    scratch_idx_max=(DYSPOISSOMETER_UINT)((DYSPOISSOMETER_UINT)(buffer_idx_max<<1)+1);
+    while((level_status_mask>>level_idx)&1){
+      level_list_base=quantile_base->level_list_base_list[level_idx];
+/*
+Merge the carry with this level into *scratch_list_base.
+*/
+      merge_idx0=0;
+      merge_idx1=0;
+      scratch_idx=0;
+      do{
+        if((buffer_idx_max<merge_idx1)||((merge_idx0<=buffer_idx_max)&&(carry_list_base[merge_idx0]<level_list_base[merge_idx1]))){
+          scratch_list_base[scratch_idx]=carry_list_base[merge_idx0];
+          merge_idx0++;
+        }else{
+          scratch_list_base[scratch_idx]=level_list_base[merge_idx1];
+          merge_idx1++;
+        }
+      }while((scratch_idx++)!=scratch_idx_max);
+/*
+Keep every other item, alternating parity on each merge at this level. The level buffer is now free, so swap it in as the next carry.
+*/
+      level_mask=1ULL<<level_idx;
+      parity=!!(quantile_base->level_parity_mask&level_mask);
+      quantile_base->level_parity_mask^=level_mask;
+      buffer_idx=0;
+      do{
+        level_list_base[buffer_idx]=scratch_list_base[(DYSPOISSOMETER_UINT)(buffer_idx<<1)+parity];
+      }while((buffer_idx++)!=buffer_idx_max);
+      quantile_base->level_list_base_list[level_idx]=carry_list_base;
+      carry_list_base=level_list_base;
+      level_status_mask^=level_mask;
+      quantile_base->rank_error_max+=level_mask;
+      level_idx++;
+    }
+/*
+Park the carry at the first unoccupied level. Allocate a new carry buffer if that level has never been used.
+*/
+    level_list_base=quantile_base->level_list_base_list[level_idx];
+    quantile_base->level_list_base_list[level_idx]=carry_list_base;
+    if(!level_list_base){
+      level_list_base=dyspoissometer_number_list_malloc(buffer_idx_max);
+      status=!level_list_base;
+    }
+    quantile_base->carry_list_base=level_list_base;
+    quantile_base->level_status_mask=level_status_mask|(1ULL<<level_idx);
+  }
+  quantile_base->input_count=input_count;
+  return status;
+}
+
+DYSPOISSOMETER_NUMBER
+dyspoissometer_quantile_get(dyspoissometer_quantile_t *quantile_base, u64 rank, u64 *rank_error_max_base){
+/*
+Get the approximate sample at a given rank from a streaming quantile estimator.
+
+In:
+
+  *quantile_base is as defined in dyspoissometer_quantile_add():Out, after having absorbed at least one sample.
+
+  rank is the zero-based rank of the sample to find, on [0, (quantile_base->sample_count)-1]. For the median, use ((quantile_base->sample_count-1)>>1).
+
+Out:
+
+  Returns a sample whose true rank is within *rank_error_max_base of rank.
+
+  *rank_error_max_base is the maximum possible difference between rank and the true rank of the return value.
+
+  *quantile_base has the same contents, but the input buffer has been sorted.
+*/
+  DYSPOISSOMETER_UINT buffer_idx_max;
+  DYSPOISSOMETER_UINT idx_list_base[DYSPOISSOMETER_QUANTILE_LEVEL_COUNT+1];
+  DYSPOISSOMETER_UINT input_count;
+  DYSPOISSOMETER_NUMBER *input_list_base;
+  DYSPOISSOMETER_NUMBER *level_list_base;
+  u8 level_idx;
+  u8 level_idx_min;
+  u64 level_status_mask;
+  DYSPOISSOMETER_NUMBER number;
+  DYSPOISSOMETER_NUMBER number_min;
+  u64 weight_sum;
+
+  buffer_idx_max=quantile_base->buffer_idx_max;
+  input_count=quantile_base->input_count;
+  input_list_base=quantile_base->input_list_base;
+  if(input_count){
+    dyspoissometer_number_list_sort((DYSPOISSOMETER_UINT)(input_count-1), input_list_base, quantile_base->scratch_list_base);
+  }
+  memset(idx_list_base, 0, sizeof(idx_list_base));
+  level_status_mask=quantile_base->level_status_mask;
+  number_min=0.0f;
+  weight_sum=0;
+/*
+Walk all the sorted buffers in ascending order as though they were merged, accumulating the weight of each item, until we pass rank. Index zero of *idx_list_base is for the input buffer, whose items have weight one; index (level_idx+1) is for the level with items of weight (1<<level_idx).
+*/
+  do{
+    level_idx_min=DYSPOISSOMETER_QUANTILE_LEVEL_COUNT+1;
+    if(idx_list_base[0]!=input_count){
+      level_idx_min=0;
+      number_min=input_list_base[idx_list_base[0]];
+    }
+    level_idx=0;
+    do{
+      if(((level_status_mask>>level_idx)&1)&&(idx_list_base[level_idx+1]<=buffer_idx_max)){
+        level_list_base=quantile_base->level_list_base_list[level_idx];
+        number=level_list_base[idx_list_base[level_idx+1]];
+        if((level_idx_min==(DYSPOISSOMETER_QUANTILE_LEVEL_COUNT+1))||(number<number_min)){
+          level_idx_min=(u8)(level_idx+1);
+          number_min=number;
+        }
+      }
+    }while((++level_idx)!=DYSPOISSOMETER_QUANTILE_LEVEL_COUNT);
+    idx_list_base[level_idx_min]++;
+    if(level_idx_min){
+      weight_sum+=1ULL<<(level_idx_min-1);
+    }else{
+      weight_sum++;
+    }
+  }while(weight_sum<=rank);
+  *rank_error_max_base=quantile_base->rank_error_max;
+  return number_min;
+}
+
+DYSPOISSOMETER_NUMBER
+dyspoissometer_logfreedom_median_get(DYSPOISSOMETER_UINT iteration_max, DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_max, u64 *random_seed_base){
+/*
+Approximate the median (not to be confused with mean) logfreedom of all mask lists consistent with a given mask count and mask span. Median logfreedom is important because it provides a threshold above and below which there is essentially equal probability of decreasing or increasing logfreedom. Mask lists generated by a strong true random number generator should asymptotically exhibit this median. In other words, consistently exhibiting improbably low or high logfreedom is an indicator of nonrandomness; the former case indicates a lack of entropy and the latter indicates an attempt to artificially contrive maximum randomness.
+
+In:
+
+  mask_idx_max is as defined in dyspoissometer_logfreedom_max_get().
+
+  iteration_max is as defined in dyspoissometer_logfreedom_max_get(), except that it is restricted to [0, DYSPOISSOMETER_UINT_MAX-1].
+
+  mask_max is as defined in dyspoissometer_logfreedom_max_get().
+
+  *random_seed_base is as defined in dyspoissometer_logfreedom_max_get():In.
+
+Out:
+
+  Returns a rational but otherwise undefined negative value if we ran out of memory; else an approximation of median logfreedom, guaranteed to be nonnegative. Critically, this value is in fact an actual logfreedom of at least one generated mask list; it is not an interpolated or value. For this reason, given sufficiently high iteration_max, it becomes asymptotically certain to be the actual median, within the limits of numerical precision. Memory usage is proportional to iteration_max; see dyspoissometer_logfreedom_median_stream_get() for a bounded-memory alternative.
+
+  *random_seed_base is as defined in dyspoissometer_logfreedom_max_get():Out.
+*/
+  DYSPOISSOMETER_UINT *freq_list_base;
+  DYSPOISSOMETER_UINT freq_max_minus_1;
+  u8 lane_idx_max;
+  DYSPOISSOMETER_UINT *lane_list_base;
+  DYSPOISSOMETER_NUMBER logfreedom;
+  DYSPOISSOMETER_UINT logfreedom_idx;
+  DYSPOISSOMETER_NUMBER *logfreedom_list_base;
+  DYSPOISSOMETER_UINT *mask_list_base;
+  DYSPOISSOMETER_NUMBER median;
+  u8 overflow_status;
+  DYSPOISSOMETER_UINT *pop_list_base;
+
+  overflow_status=0;
+  median=0.0f;
+  if(mask_max&&mask_idx_max){
+    overflow_status=1;
+    freq_list_base=dyspoissometer_uint_list_malloc(mask_max);
+    lane_list_base=dyspoissometer_freq_list_lane_malloc_zero(0, &lane_idx_max, mask_idx_max, mask_max);
+    logfreedom_list_base=dyspoissometer_number_list_malloc(iteration_max);
+    mask_list_base=dyspoissometer_uint_list_malloc_zero(mask_idx_max);
+    pop_list_base=dyspoissometer_uint_list_malloc_zero(mask_idx_max);
+    if(freq_list_base&&logfreedom_list_base&&mask_list_base&&pop_list_base){
+/*
+Generate pseudorandom mask lists one at a time based on *random_seed_base. For each mask list, find the logfreedom and save it to *logfreedom_list_base.
+*/
+      logfreedom_idx=0;
+      do{
+        dyspoissometer_mask_list_pseudorandom_get(mask_idx_max, mask_list_base, mask_max, random_seed_base);
+        dyspoissometer_freq_list_lane_get(freq_list_base, lane_idx_max, lane_list_base, mask_idx_max, mask_list_base, mask_max);
+        freq_max_minus_1=dyspoissometer_freq_max_minus_1_get(freq_list_base, mask_max);
+        dyspoissometer_pop_list_get(freq_list_base, freq_max_minus_1, mask_max, pop_list_base);
+        logfreedom=dyspoissometer_logfreedom_dense_get(freq_max_minus_1, 1, mask_idx_max, mask_max, pop_list_base);
+        logfreedom_list_base[logfreedom_idx]=logfreedom;
+      }while((logfreedom_idx++)!=iteration_max);
+/*
+Select the median without sorting the whole list.
+*/
+      median=dyspoissometer_number_list_select(iteration_max>>1, iteration_max, logfreedom_list_base);
+      overflow_status=0;
+    }
+    dyspoissometer_free(pop_list_base);
+    dyspoissometer_free(mask_list_base);
+    dyspoissometer_free(logfreedom_list_base);
+    dyspoissometer_free(lane_list_base);
+    dyspoissometer_free(freq_list_base);
+  }else{
+    median=LOG_SUM_N_PLUS_1(mask_max);
+  }
+  if(overflow_status){
+    median=-1.0f;
+  }else if(median<=0.0f){
+    median=0.0f;
+  }
+  return median;
+}
+
+DYSPOISSOMETER_NUMBER
+dyspoissometer_logfreedom_median_stream_get(DYSPOISSOMETER_UINT buffer_idx_max, u64 iteration_max, DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_max, u64 *random_seed_base, u64 *rank_error_max_base){
+/*
+Approximate the median logfreedom as with dyspoissometer_logfreedom_median_get(), but using a streaming quantile estimator instead of storing every sample. Memory usage therefore grows only logarithmically with iteration_max, at the cost of a small but bounded error in the rank of the result.
+
+In:
+
+  buffer_idx_max is as defined in dyspoissometer_quantile_init():In.
+
+  iteration_max is as defined in dyspoissometer_logfreedom_max_get():In.
+
+  mask_idx_max is as defined in dyspoissometer_logfreedom_max_get():In.
+
+  mask_max is as defined in dyspoissometer_logfreedom_max_get():In.
+
+  *random_seed_base is as defined in dyspoissometer_logfreedom_max_get():In.
+
+Out:
+
+  Returns as defined in dyspoissometer_logfreedom_median_get():Out, except that the return value is only guaranteed to have a rank within *rank_error_max_base of the median sample's rank.
+
+  *random_seed_base is as defined in dyspoissometer_logfreedom_max_get():Out.
+
+  *rank_error_max_base is as defined in dyspoissometer_quantile_get():Out. Divide by (iteration_max+1) to get the maximum error as a fraction of all samples. Zero if we ran out of memory.
+*/
+  DYSPOISSOMETER_UINT *freq_list_base;
+  DYSPOISSOMETER_UINT freq_max_minus_1;
+  u64 iteration;
+  u8 lane_idx_max;
+  DYSPOISSOMETER_UINT *lane_list_base;
+  DYSPOISSOMETER_NUMBER logfreedom;
+  DYSPOISSOMETER_UINT *mask_list_base;
+  DYSPOISSOMETER_NUMBER median;
+  u8 overflow_status;
+  DYSPOISSOMETER_UINT *pop_list_base;
+  dyspoissometer_quantile_t quantile;
+
+  overflow_status=0;
+  median=0.0f;
+  *rank_error_max_base=0;
+  if(mask_max&&mask_idx_max){
+    overflow_status=dyspoissometer_quantile_init(buffer_idx_max, &quantile);
+    freq_list_base=dyspoissometer_uint_list_malloc(mask_max);
+    lane_list_base=dyspoissometer_freq_list_lane_malloc_zero(0, &lane_idx_max, mask_idx_max, mask_max);
+    mask_list_base=dyspoissometer_uint_list_malloc_zero(mask_idx_max);
+    pop_list_base=dyspoissometer_uint_list_malloc_zero(mask_idx_max);
+    if(!(overflow_status|!(freq_list_base&&mask_list_base&&pop_list_base))){
+      iteration=0;
+      do{
+        dyspoissometer_mask_list_pseudorandom_get(mask_idx_max, mask_list_base, mask_max, random_seed_base);
+        dyspoissometer_freq_list_lane_get(freq_list_base, lane_idx_max, lane_list_base, mask_idx_max, mask_list_base, mask_max);
+        freq_max_minus_1=dyspoissometer_freq_max_minus_1_get(freq_list_base, mask_max);
+        dyspoissometer_pop_list_get(freq_list_base, freq_max_minus_1, mask_max, pop_list_base);
+        logfreedom=dyspoissometer_logfreedom_dense_get(freq_max_minus_1, 1, mask_idx_max, mask_max, pop_list_base);
+/*
+Flush negative zero, which is not a legitimate logfreedom.
+*/
+        logfreedom=MAX(logfreedom, 0.0f);
+        overflow_status=dyspoissometer_quantile_add(&quantile, logfreedom);
+      }while((!overflow_status)&&((iteration++)!=iteration_max));
+      if(!overflow_status){
+        median=dyspoissometer_quantile_get(&quantile, iteration_max>>1, rank_error_max_base);
+      }
+    }else{
+      overflow_status=1;
+    }
+    dyspoissometer_free(pop_list_base);
+    dyspoissometer_free(mask_list_base);
+    dyspoissometer_free(lane_list_base);
+    dyspoissometer_free(freq_list_base);
+    dyspoissometer_quantile_free(&quantile);
+  }else{
+    median=LOG_SUM_N_PLUS_1(mask_max);
+  }
+  if(overflow_status){
+    median=-1.0f;
+  }else if(median<=0.0f){
+    median=0.0f;
+  }
+  return median;
+}
+
+void
+dyspoissometer_uint_list_unpack(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u16 *u16_list_base, u8 *u24_list_base, u32 *u32_list_base, u8 *u8_list_base, DYSPOISSOMETER_UINT *uint_list_base){
+/*
+Copy part of a mask list of any supported width to a list of (DYSPOISSOMETER_UINT)s.
+
+In:
+
+  mask_idx_max is as defined in dyspoissometer_uint_list_logfreedom_get():In.
+
+  mask_idx_min is as defined in dyspoissometer_uint_list_logfreedom_get():In.
+
+  Exactly one of the following must be non(NULL):
+
+    u16_list_base is as defined in dyspoissometer_uint_list_logfreedom_get():In.
+
+    u24_list_base is as defined in dyspoissometer_uint_list_logfreedom_get():In.
+
+    u32_list_base is as defined in dyspoissometer_uint_list_logfreedom_get():In.
+
+    u8_list_base is as defined in dyspoissometer_uint_list_logfreedom_get():In.
+
+  *uint_list_base is writable for (mask_idx_max-mask_idx_min+1) (DYSPOISSOMETER_UINT)s.
+
+Out:
+
+  *uint_list_base contains the masks from index mask_idx_min through mask_idx_max of the nonnull input list, inclusive, starting at index zero.
+*/
+  DYSPOISSOMETER_UINT mask_idx;
+  DYSPOISSOMETER_UINT mask_idx_max_block;
+  u32 u32_block_base[DYSPOISSOMETER_U24_BLOCK_IDX_MAX+1];
+  ULONG u32_idx;
+  ULONG u32_idx_max;
+  DYSPOISSOMETER_UINT uint_idx;
+
+  mask_idx=mask_idx_min;
+  uint_idx=0;
+  if(u8_list_base){
+    do{
+      uint_list_base[uint_idx]=u8_list_base[mask_idx];
+      uint_idx++;
+    }while((mask_idx++)!=mask_idx_max);
+  }else if(u16_list_base){
+    do{
+      uint_list_base[uint_idx]=u16_list_base[mask_idx];
+      uint_idx++;
+    }while((mask_idx++)!=mask_idx_max);
+  }else if(u24_list_base){
+    do{
+      mask_idx_max_block=mask_idx_max;
+      if(DYSPOISSOMETER_U24_BLOCK_IDX_MAX<(DYSPOISSOMETER_UINT)(mask_idx_max-mask_idx)){
+        mask_idx_max_block=(DYSPOISSOMETER_UINT)(mask_idx+DYSPOISSOMETER_U24_BLOCK_IDX_MAX);
+      }
+      dyspoissometer_u24_list_unpack(mask_idx_max_block, mask_idx, u24_list_base, u32_block_base);
+      u32_idx=0;
+      u32_idx_max=(ULONG)((DYSPOISSOMETER_UINT)(mask_idx_max_block-mask_idx));
+      do{
+        uint_list_base[uint_idx]=(DYSPOISSOMETER_UINT)(u32_block_base[u32_idx]);
+        uint_idx++;
+      }while((u32_idx++)!=u32_idx_max);
+      mask_idx=(DYSPOISSOMETER_UINT)(mask_idx_max_block+1);
+    }while(mask_idx_max_block!=mask_idx_max);
+  }else{
+    do{
+      uint_list_base[uint_idx]=(DYSPOISSOMETER_UINT)(u32_list_base[mask_idx]);
+      uint_idx++;
+    }while((mask_idx++)!=mask_idx_max);
+  }
+  return;
+}
+
+DYSPOISSOMETER_UINT
+dyspoissometer_freq_list_sparse_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT *mask_list0_base, DYSPOISSOMETER_UINT *mask_list1_base){
+/*
+Replace a mask list with the list of nonzero frequencies of its distinct masks, without allocating a frequency list spanning all possible masks.
+
+In:
+
+  mask_idx_max is the number of masks at mask_list0_base, less one.
+
+  *mask_list0_base contains (mask_idx_max+1) masks in any order.
+
+  *mask_list1_base is undefined and writable for (mask_idx_max+1) (DYSPOISSOMETER_UINT)s.
+
+Out:
+
+  Returns freq_idx_max, the number of distinct masks at mask_list0_base, less one.
+
+  *mask_list0_base contains (freq_idx_max+1) nonzero frequencies, one for each distinct mask, which sum to (mask_idx_max+1), as required by dyspoissometer_logfreedom_nonzero_get():In. Items beyond those are undefined.
+
+  *mask_list1_base is undefined.
+*/
+  DYSPOISSOMETER_UINT freq;
+  DYSPOISSOMETER_UINT freq_idx;
+  DYSPOISSOMETER_UINT mask;
+  DYSPOISSOMETER_UINT mask_idx;
+  DYSPOISSOMETER_UINT mask_old;
+
+  dyspoissometer_uint_list_sort(mask_idx_max, mask_list0_base, mask_list1_base);
+/*
+Equal masks are now adjacent, so count the length of each run. Write each run length over the list itself, which is safe because freq_idx never exceeds mask_idx.
+*/
+  freq=1;
+  freq_idx=0;
+  mask_old=mask_list0_base[0];
+  mask_idx=0;
+  while((mask_idx++)!=mask_idx_max){
+    mask=mask_list0_base[mask_idx];
+    if(mask==mask_old){
+      freq++;
+    }else{
+      mask_list0_base[freq_idx]=freq;
+      freq=1;
+      freq_idx++;
+      mask_old=mask;
+    }
+  }
+  mask_list0_base[freq_idx]=freq;
+  return freq_idx;
+}
+
+DYSPOISSOMETER_NUMBER
+dyspoissometer_uint_list_logfreedom_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u32 mask_max, u16 *u16_list_base, u8 *u24_list_base, u32 *u32_list_base, u8 *u8_list_base){
+/*
+Get the logfreedom of a mask list. If the mask span is much greater than the mask count, then the frequencies are obtained by sorting a copy of the masks, so that memory usage is proportional to the mask count instead of the mask span.
+
+In:
+
+  mask_idx_max is the number of masks whose logfreedom to compute, less (mask_idx_min+1). On [mask_idx_min, DYSPOISSOMETER_UINT_MAX-1].
+
+  mask_idx_min is the index of the first mask in the list whose logfreedom to compute. On [0, mask_idx_max].
+
+  mask_max is the number of possible masks, whether or not they actually occur, less one.
+
+  Exactly one of the following must be non(NULL):
+
+    u16_list_base is the base of a list of (mask_idx_max+1) (u16)s on [0, mask_max].
+
+    u24_list_base is the base of a list of (mask_idx_max+1) (u24)s on [0, mask_max]. Note that their alignment is U8_SIZE, not U32_SIZE.
+
+    u32_list_base is the base of a list of (mask_idx_max+1) (u32)s on [0, mask_max].
+
+    u8_list_base is the base of a list of (mask_idx_max+1) (u8)s on [0, mask_max].
+
+Out:
+
+  Returns a rational but otherwise undefined negative value if we ran out of memory; else the logfreedom of the mask list, guaranteed to be nonnegative.
+*/
+  DYSPOISSOMETER_UINT *freq_list0_base;
+  DYSPOISSOMETER_UINT *freq_list1_base;
+  DYSPOISSOMETER_UINT freq_idx_max;
+  u8 lane_idx_max;
+  DYSPOISSOMETER_NUMBER logfreedom;
+  DYSPOISSOMETER_UINT mask_idx_max_relative;
+  DYSPOISSOMETER_UINT mask_max_uint;
+
+  logfreedom=0.0f;
+  if(mask_max){
+    logfreedom=-1.0f;
+    mask_max_uint=(DYSPOISSOMETER_UINT)(mask_max);
+    if(mask_max==mask_max_uint){
+      mask_idx_max_relative=(DYSPOISSOMETER_UINT)(mask_idx_max-mask_idx_min);
+      if((mask_max_uint>>DYSPOISSOMETER_FREQ_SPARSE_SPAN_SHIFT)<=mask_idx_max_relative){
+        freq_list0_base=dyspoissometer_freq_list_lane_malloc_zero(0, &lane_idx_max, mask_idx_max_relative, mask_max_uint);
+        if(!freq_list0_base){
+          freq_list0_base=dyspoissometer_uint_list_malloc_zero(mask_max_uint);
+        }
+        freq_list1_base=dyspoissometer_uint_list_malloc(mask_max_uint);
+        if(freq_list0_base&&freq_list1_base){
+          dyspoissometer_freq_list_accrue(freq_list0_base, lane_idx_max, mask_idx_max, mask_idx_min, mask_max_uint, u16_list_base, u24_list_base, u32_list_base, u8_list_base, NULL);
+          dyspoissometer_freq_list_merge(freq_list0_base, lane_idx_max, mask_max_uint);
+          logfreedom=dyspoissometer_logfreedom_sparse_get(freq_list0_base, freq_list1_base, mask_max_uint);
+        }
+      }else{
+/*
+A dense frequency list would consist mostly of zeroes, and could be far too large to allocate, so count the frequencies by sorting instead.
+*/
+        freq_list0_base=dyspoissometer_uint_list_malloc(mask_idx_max_relative);
+        freq_list1_base=dyspoissometer_uint_list_malloc(mask_idx_max_relative);
+        if(freq_list0_base&&freq_list1_base){
+          dyspoissometer_uint_list_unpack(mask_idx_max, mask_idx_min, u16_list_base, u24_list_base, u32_list_base, u8_list_base, freq_list0_base);
+          freq_idx_max=dyspoissometer_freq_list_sparse_get(mask_idx_max_relative, freq_list0_base, freq_list1_base);
+          logfreedom=dyspoissometer_logfreedom_nonzero_get(freq_idx_max, freq_list0_base, freq_list1_base, mask_idx_max_relative, mask_max_uint);
+        }
+      }
+      dyspoissometer_free(freq_list1_base);
+      dyspoissometer_free(freq_list0_base);
+    }
+  }
+  return logfreedom;
+}
+
+DYSPOISSOMETER_NUMBER
+dyspoissometer_uint_list_mean_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u8 sign_status, u16 *u16_list_base, u8 *u24_list_base, u32 *u32_list_base, u8 *u8_list_base){
+/*
+Get the mean of a mask list consisting of (un)signed integers.
+
+In:
+
+  mask_idx_max is the number of masks whose mean to compute, less (mask_idx_min+1). On [mask_idx_min, DYSPOISSOMETER_UINT_MAX-1].
+
+  mask_idx_min is the index of the first mask in the list whose mean to compute. On [0, mask_idx_max].
+
+  sign_status is one if the list of so-called uints actually consists of (signed) ints, else zero. (As far as the compiler is concerned, they're uints in either case so we don't get into signed overflow badness.)
+
+  Exactly one of the following must be non(NULL):
+
+    u16_list_base is the base of a list of (mask_idx_max+1) (u16)s on [0, mask_max].
+
+    u24_list_base is the base of a list of (mask_idx_max+1) (u24)s on [0, mask_max]. Note that their alignment is U8_SIZE, not U32_SIZE.
+
+    u32_list_base is the base of a list of (mask_idx_max+1) (u32)s on [0, mask_max].
+
+    u8_list_base is the base of a list of (mask_idx_max+1) (u8)s on [0, mask_max].
+
+Out:
+
+  Returns the mean of the mask list, guaranteed to be at least the minimum and at most the maximum (un)signed integer representable as a mask of the same format as in the nonnull input list. However, the mean is rational and generally not an integer. It may also be less than the minimum or greater than the maximum mask in the list due to numerical error.
+*/
+  u64 int_sum;
+  u32 mask;
+  u64 mask_count;
+  DYSPOISSOMETER_UINT mask_idx;
+  DYSPOISSOMETER_UINT mask_idx_max_block;
+  u32 mask_max;
+  i64 mask_max_max;
+  u32 mask_min;
+  i64 mask_min_min;
+  DYSPOISSOMETER_NUMBER mean;
+  u32 u32_block_base[DYSPOISSOMETER_U24_BLOCK_IDX_MAX+1];
+  ULONG u32_idx;
+  ULONG u32_idx_max;
+  u64 uint_sum;
+
+  mask_idx=mask_idx_min;
+  int_sum=0;
+  uint_sum=0;
+  if(!sign_status){
+    mask_max=0;
+    mask_min=U32_MAX;
+  }else{
+    mask_max=U32_SPAN_HALF;
+    mask_min=I32_MAX;
+  }
+  if(u8_list_base){
+    mask_max>>=U32_BITS-U8_BITS;
+    mask_min>>=U32_BITS-U8_BITS;
+  }else if(u16_list_base){
+    mask_max>>=U32_BITS-U16_BITS;
+    mask_min>>=U32_BITS-U16_BITS;
+  }else if(u24_list_base){
+    mask_max>>=U32_BITS-U24_BITS;
+    mask_min>>=U32_BITS-U24_BITS;
+  }
+  mask_max_max=mask_min;
+  mask_min_min=0;
+  if(sign_status){
+    mask_min_min=(~mask_max)+1;
+    mask_min_min=-mask_min_min;
+  }
+  if(u8_list_base){
+    do{
+      mask=u8_list_base[mask_idx];
+      if(!sign_status){
+        mask_max=MAX(mask, mask_max);
+        mask_min=MIN(mask, mask_min);
+        uint_sum+=mask;
+      }else{
+        if(mask<=I8_MAX){
+          int_sum+=mask;
+          mask_max=MAX(mask, mask_max);
+          if(mask_min<=I8_MAX){
+            mask_min=MIN(mask, mask_min);
+          }
+        }else{
+          int_sum--;
+          int_sum-=(u8)(~mask);
+          if(I8_MAX<mask_max){
+            mask_max=MAX(mask, mask_max);
+          }
+          mask_min=MIN(mask, mask_min);
+        }
+      }
+    }while((mask_idx++)!=mask_idx_max);
+  }else if(u16_list_base){
+    do{
+      mask=u16_list_base[mask_idx];
+      if(!sign_status){
+        mask_max=MAX(mask, mask_max);
+        mask_min=MIN(mask, mask_min);
+        uint_sum+=mask;
+      }else{
+        if(mask<=I16_MAX){
+          int_sum+=mask;
+          mask_max=MAX(mask, mask_max);
+          if(mask_min<=I16_MAX){
+            mask_min=MIN(mask, mask_min);
+          }
+        }else{
+          int_sum--;
+          int_sum-=(u16)(~mask);
+          if(I16_MAX<mask_max){
+            mask_max=MAX(mask, mask_max);
+          }
+          mask_min=MIN(mask, mask_min);
+        }
+      }
+    }while((mask_idx++)!=mask_idx_max);
+  }else if(u24_list_base){
+    do{
+      mask_idx_max_block=mask_idx_max;
+      if(DYSPOISSOMETER_U24_BLOCK_IDX_MAX<(DYSPOISSOMETER_UINT)(mask_idx_max-mask_idx)){
+        mask_idx_max_block=(DYSPOISSOMETER_UINT)(mask_idx+DYSPOISSOMETER_U24_BLOCK_IDX_MAX);
+      }
+      dyspoissometer_u24_list_unpack(mask_idx_max_block, mask_idx, u24_list_base, u32_block_base);
+      u32_idx=0;
+      u32_idx_max=(ULONG)((DYSPOISSOMETER_UINT)(mask_idx_max_block-mask_idx));
+      do{
+        mask=u32_block_base[u32_idx];
+        if(!sign_status){
+          mask_max=MAX(mask, mask_max);
+          mask_min=MIN(mask, mask_min);
+          uint_sum+=mask;
+        }else{
+          if(mask<=I24_MAX){
+            int_sum+=mask;
+            mask_max=MAX(mask, mask_max);
+            if(mask_min<=I24_MAX){
+              mask_min=MIN(mask, mask_min);
+            }
+          }else{
+            int_sum--;
+            int_sum-=(u32)((~mask)&U24_MAX);
+            if(I24_MAX<mask_max){
+              mask_max=MAX(mask, mask_max);
+            }
+            mask_min=MIN(mask, mask_min);
+          }
+        }
+      }while((u32_idx++)!=u32_idx_max);
+      mask_idx=(DYSPOISSOMETER_UINT)(mask_idx_max_block+1);
+    }while(mask_idx_max_block!=mask_idx_max);
+  }else{
+    do{
+      mask=u32_list_base[mask_idx];
+      if(!sign_status){
+        mask_max=MAX(mask, mask_max);
+        mask_min=MIN(mask, mask_min);
+        uint_sum+=mask;
+      }else{
+        if(mask<=I32_MAX){
+          int_sum+=mask;
+          mask_max=MAX(mask, mask_max);
+          if(mask_min<=INT32_MAX){
+            mask_min=MIN(mask, mask_min);
+          }
+        }else{
+          int_sum--;
+          int_sum-=(u32)(~mask);
+          if(I32_MAX<mask_max){
+            mask_max=MAX(mask, mask_max);
+          }
+          mask_min=MIN(mask, mask_min);
+        }
+      }
+    }while((mask_idx++)!=mask_idx_max);
+  }
+  mean=(DYSPOISSOMETER_NUMBER)(uint_sum);
+  if(sign_status){
+    mean=(DYSPOISSOMETER_NUMBER)(int_sum);
+    if(int_sum>>U64_BIT_MAX){
+      mean=(DYSPOISSOMETER_NUMBER)((~int_sum)+1);
+      mean=-mean;
+    }
+  }
+  mask_count=((u64)(mask_idx_max)-mask_idx_min)+1;
+  mean=mean/(DYSPOISSOMETER_NUMBER)(mask_count);
+  if(mean<mask_min_min){
+    mean=(DYSPOISSOMETER_NUMBER)(mask_min_min);
+  }else if(mask_max_max<mean){
+    mean=(DYSPOISSOMETER_NUMBER)(mask_max_max);
+  }
+  return mean;
+}
+
+void
+dyspoissometer_moment_merge(dyspoissometer_moment_t *moment0_base, dyspoissometer_moment_t *moment1_base){
+/*
+Merge the central moments of 2 disjoint parts of a mask list, using the pairwise update formulas of Chan et al. and Pebay.
+
+In:
+
+  *moment0_base contains the mask count, mean, and central moment sums of one part, or a mask count of zero.
+
+  *moment1_base contains the same for another part.
+
+Out:
+
+  *moment0_base contains the mask count, mean, and central moment sums of the union of both parts. Other fields are unchanged.
+*/
+  DYSPOISSOMETER_NUMBER delta;
+  DYSPOISSOMETER_NUMBER delta_squared;
+  DYSPOISSOMETER_NUMBER m2;
+  DYSPOISSOMETER_NUMBER m3;
+  DYSPOISSOMETER_NUMBER mask_count;
+  DYSPOISSOMETER_NUMBER mask_count_squared;
+  DYSPOISSOMETER_NUMBER mask_count0;
+  DYSPOISSOMETER_NUMBER mask_count1;
+
+  if(moment1_base->mask_count){
+    if(!moment0_base->mask_count){
+      moment0_base->m2=moment1_base->m2;
+      moment0_base->m3=moment1_base->m3;
+      moment0_base->m4=moment1_base->m4;
+      moment0_base->mask_count=moment1_base->mask_count;
+      moment0_base->mean=moment1_base->mean;
+    }else{
+      mask_count0=(DYSPOISSOMETER_NUMBER)(moment0_base->mask_count);
+      mask_count1=(DYSPOISSOMETER_NUMBER)(moment1_base->mask_count);
+      mask_count=mask_count0+mask_count1;
+      mask_count_squared=mask_count*mask_count;
+      delta=moment1_base->mean-moment0_base->mean;
+      delta_squared=delta*delta;
+      m2=moment0_base->m2;
+      m3=moment0_base->m3;
+      moment0_base->m4+=moment1_base->m4+((delta_squared*delta_squared*mask_count0*mask_count1*((mask_count0*mask_count0)-(mask_count0*mask_count1)+(mask_count1*mask_count1)))/(mask_count_squared*mask_count));
+      moment0_base->m4+=(6.0f*delta_squared*((mask_count0*mask_count0*moment1_base->m2)+(mask_count1*mask_count1*m2)))/mask_count_squared;
+      moment0_base->m4+=(4.0f*delta*((mask_count0*moment1_base->m3)-(mask_count1*m3)))/mask_count;
+      moment0_base->m3+=moment1_base->m3+((delta_squared*delta*mask_count0*mask_count1*(mask_count0-mask_count1))/mask_count_squared);
+      moment0_base->m3+=(3.0f*delta*((mask_count0*moment1_base->m2)-(mask_count1*m2)))/mask_count;
+      moment0_base->m2+=moment1_base->m2+((delta_squared*mask_count0*mask_count1)/mask_count);
+      moment0_base->mean+=(delta*mask_count1)/mask_count;
+      moment0_base->mask_count+=moment1_base->mask_count;
+    }
+  }
+  return;
+}
+
+void
+dyspoissometer_moment_accrue(dyspoissometer_moment_t *moment_base){
+/*
+Compute the mean and central moment sums of a mask list in a single pass over memory.
+
+In:
+
+  *moment_base contains the mask list parameters, namely mask_idx_max, mask_idx_min, sign_status, u16_list_base, u24_list_base, u32_list_base, and u8_list_base, all as defined in dyspoissometer_uint_list_stats_get():In.
+
+Out:
+
+  *moment_base contains the mask count, mean, and the sums of the 2nd, 3rd, and 4th powers of the deviations from the mean (m2, m3, and m4, respectively). The input fields are unchanged.
+*/
+  dyspoissometer_moment_t block;
+  i64 block_sum;
+  DYSPOISSOMETER_NUMBER delta;
+  DYSPOISSOMETER_NUMBER delta_squared;
+  i64 int_list_base[DYSPOISSOMETER_MOMENT_BLOCK_IDX_MAX+1];
+  u32 mask;
+  u8 mask_bits;
+  DYSPOISSOMETER_UINT mask_idx;
+  DYSPOISSOMETER_UINT mask_idx_max;
+  DYSPOISSOMETER_UINT mask_idx_max_block;
+  DYSPOISSOMETER_UINT mask_idx_min;
+  u8 sign_status;
+  u32 u32_block_base[DYSPOISSOMETER_MOMENT_BLOCK_IDX_MAX+1];
+  ULONG uint_idx;
+  ULONG uint_idx_max;
+
+  moment_base->m2=0.0f;
+  moment_base->m3=0.0f;
+  moment_base->m4=0.0f;
+  moment_base->mask_count=0;
+  moment_base->mean=0.0f;
+  mask_bits=U32_BITS;
+  if(moment_base->u8_list_base){
+    mask_bits=U8_BITS;
+  }else if(moment_base->u16_list_base){
+    mask_bits=U16_BITS;
+  }else if(moment_base->u24_list_base){
+    mask_bits=U24_BITS;
+  }
+  sign_status=(u8)(!!moment_base->sign_status);
+  mask_idx_max=moment_base->mask_idx_max;
+  mask_idx_min=moment_base->mask_idx_min;
+  do{
+/*
+Process the list in blocks small enough to remain in the L1 cache. First unpack each block to signed integers and find their exact sum, which gives the exact block mean (to the precision of DYSPOISSOMETER_NUMBER). Then make a second pass over the block, which is cheap because it's cached, to sum the powers of the deviations from that mean. Finally, merge the block into the running totals. Compared to making 2 passes over the whole list, this saves a memory sweep and tends to be more accurate, because block deviations are small.
+*/
+    mask_idx_max_block=mask_idx_max;
+    if(DYSPOISSOMETER_MOMENT_BLOCK_IDX_MAX<(DYSPOISSOMETER_UINT)(mask_idx_max-mask_idx_min)){
+      mask_idx_max_block=(DYSPOISSOMETER_UINT)(mask_idx_min+DYSPOISSOMETER_MOMENT_BLOCK_IDX_MAX);
+    }
+    uint_idx_max=(ULONG)(mask_idx_max_block-mask_idx_min);
+    mask_idx=mask_idx_min;
+    uint_idx=0;
+    if(moment_base->u8_list_base){
+      do{
+        int_list_base[uint_idx]=moment_base->u8_list_base[mask_idx];
+        mask_idx++;
+      }while((uint_idx++)!=uint_idx_max);
+    }else if(moment_base->u16_list_base){
+      do{
+        int_list_base[uint_idx]=moment_base->u16_list_base[mask_idx];
+        mask_idx++;
+      }while((uint_idx++)!=uint_idx_max);
+    }else if(moment_base->u24_list_base){
+      dyspoissometer_u24_list_unpack(mask_idx_max_block, mask_idx_min, moment_base->u24_list_base, u32_block_base);
+      do{
+        int_list_base[uint_idx]=u32_block_base[uint_idx];
+      }while((uint_idx++)!=uint_idx_max);
+    }else{
+      do{
+        int_list_base[uint_idx]=moment_base->u32_list_base[mask_idx];
+        mask_idx++;
+      }while((uint_idx++)!=uint_idx_max);
+    }
+    block_sum=0;
+    uint_idx=0;
+    do{
+/*
+If sign_status is set, then subtract (2^mask_bits) from masks with their high bit set, in order to obtain their signed values.
+*/
+      mask=(u32)(int_list_base[uint_idx]);
+      int_list_base[uint_idx]-=(i64)((u64)((mask>>(mask_bits-1))&sign_status)<<mask_bits);
+      block_sum+=int_list_base[uint_idx];
+    }while((uint_idx++)!=uint_idx_max);
+    block.m2=0.0f;
+    block.m3=0.0f;
+    block.m4=0.0f;
+    block.mask_count=(u64)(uint_idx_max)+1;
+    block.mean=(DYSPOISSOMETER_NUMBER)(block_sum)/(DYSPOISSOMETER_NUMBER)(block.mask_count);
+    uint_idx=0;
+    do{
+      delta=(DYSPOISSOMETER_NUMBER)(int_list_base[uint_idx])-block.mean;
+      delta_squared=delta*delta;
+      block.m2+=delta_squared;
+      block.m3+=delta_squared*delta;
+      block.m4+=delta_squared*delta_squared;
+    }while((uint_idx++)!=uint_idx_max);
+    dyspoissometer_moment_merge(moment_base, &block);
+    mask_idx_min=(DYSPOISSOMETER_UINT)(mask_idx_max_block+1);
+  }while(mask_idx_max_block!=mask_idx_max);
+  return;
+}
+
+void *
+dyspoissometer_moment_thread_run(void *moment_base){
+/*
+Thread entry point for dyspoissometer_uint_list_stats_get().
+
+In:
+
+  moment_base is a (dyspoissometer_moment_t *) as defined for dyspoissometer_moment_accrue():In.
+
+Out:
+
+  Returns NULL.
+
+  *moment_base is as defined in dyspoissometer_moment_accrue():Out.
+*/
+  dyspoissometer_moment_accrue((dyspoissometer_moment_t *)(moment_base));
+  return NULL;
+}
+
+dyspoissometer_moment_t *
+dyspoissometer_moment_list_malloc(u32 moment_idx_max){
+/*
+Allocate a list of undefined moment accumulators.
+
+In:
+
+  moment_idx_max is the number of accumulators to allocate, less one.
+
+Out:
+
+  Returns NULL on failure, else the base of (moment_idx_max+1) undefined (dyspoissometer_moment_t)s, which should eventually be freed via dyspoissometer_free().
+*/
+  dyspoissometer_moment_t *list_base;
+  ULONG list_size;
+  ULONG moment_count;
+
+  list_base=NULL;
+  moment_count=(ULONG)((ULONG)(moment_idx_max)+1);
+  if(moment_count){
+    list_size=(ULONG)(moment_count*sizeof(dyspoissometer_moment_t));
+    if((list_size/sizeof(dyspoissometer_moment_t))==moment_count){
+      list_base=DEBUG_MALLOC_PARANOID(list_size);
+    }
+  }
+  return list_base;
+}
+
+DYSPOISSOMETER_NUMBER
+dyspoissometer_moment_stats_get(dyspoissometer_moment_t *moment_base, DYSPOISSOMETER_NUMBER *stat_kurtosis_base, DYSPOISSOMETER_NUMBER *stat_sigma_base, DYSPOISSOMETER_NUMBER *stat_variance_base){
+/*
+Derive the statistics reported by dyspoissometer_uint_list_stats_get() from accrued moments.
+
+In:
+
+  *moment_base is as defined in dyspoissometer_moment_accrue():Out, with a nonzero mask count, or the result of merging several such accumulators via dyspoissometer_moment_merge(). Only its mask count, moments, sign_status, and which of its list bases are non(NULL) matter.
+
+  *stat_kurtosis_base is undefined.
+
+  *stat_sigma_base is undefined.
+
+  *stat_variance_base is undefined.
+
+Out:
+
+  Returns the mean as defined in dyspoissometer_uint_list_stats_get():Out.
+
+  *stat_kurtosis_base, *stat_sigma_base, and *stat_variance_base are as defined in dyspoissometer_uint_list_stats_get():Out.
+*/
+  DYSPOISSOMETER_NUMBER mask_count;
+  DYSPOISSOMETER_NUMBER stat_kurtosis;
+  DYSPOISSOMETER_NUMBER stat_mean;
+  i64 stat_mean_max;
+  i64 stat_mean_min;
+  DYSPOISSOMETER_NUMBER stat_sigma;
+  DYSPOISSOMETER_NUMBER stat_variance;
+
+/*
+Clamp the mean to the range of the mask format, as dyspoissometer_uint_list_mean_get() does.
+*/
+  stat_mean_max=U32_MAX;
+  if(moment_base->u8_list_base){
+    stat_mean_max=U8_MAX;
+  }else if(moment_base->u16_list_base){
+    stat_mean_max=U16_MAX;
+  }else if(moment_base->u24_list_base){
+    stat_mean_max=U24_MAX;
+  }
+  stat_mean_min=0;
+  if(moment_base->sign_status){
+    stat_mean_max>>=1;
+    stat_mean_min=-stat_mean_max-1;
+  }
+  stat_mean=moment_base->mean;
+  if(stat_mean<stat_mean_min){
+    stat_mean=(DYSPOISSOMETER_NUMBER)(stat_mean_min);
+  }else if(stat_mean_max<stat_mean){
+    stat_mean=(DYSPOISSOMETER_NUMBER)(stat_mean_max);
+  }
+  mask_count=(DYSPOISSOMETER_NUMBER)(moment_base->mask_count);
+  stat_kurtosis=moment_base->m4*mask_count/(moment_base->m2*moment_base->m2);
+  stat_variance=moment_base->m2/mask_count;
+  stat_sigma=SQRT(stat_variance);
+  *stat_kurtosis_base=stat_kurtosis;
+  *stat_sigma_base=stat_sigma;
+  *stat_variance_base=stat_variance;
+  return stat_mean;
+}
+
+DYSPOISSOMETER_NUMBER
+dyspoissometer_uint_list_stats_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u8 sign_status, DYSPOISSOMETER_NUMBER *stat_kurtosis_base, DYSPOISSOMETER_NUMBER *stat_sigma_base, DYSPOISSOMETER_NUMBER *stat_variance_base, u16 *u16_list_base, u8 *u24_list_base, u32 *u32_list_base, u8 *u8_list_base){
+/*
+Get the mean, variance, standard deviation, and kurtosis of a mask list consisting of (un)signed integers. The list is read only once, in blocks via dyspoissometer_moment_accrue(). Long lists are split across threads, unless DEBUG is defined.
+
+In:
+
+  mask_idx_max is the number of masks whose mean to compute, less (mask_idx_min+1). On [mask_idx_min, DYSPOISSOMETER_UINT_MAX-1].
+
+  mask_idx_min is the index of the first mask in the list whose mean to compute. On [0, mask_idx_max].
+
+  sign_status is one if the list of so-called uints actually consists of (signed) ints, else zero. (As far as the compiler is concerned, they're uints in either case so we don't get into signed overflow badness.)
+
+  *stat_kurtosis_base is undefined.
+
+  *stat_sigma_base is undefined.
+
+  *stat_variance_base is undefined.
+
+  Exactly one of the following must be non(NULL):
+
+    u16_list_base is the base of a list of (mask_idx_max+1) (u16)s on [0, mask_max].
+
+    u24_list_base is the base of a list of (mask_idx_max+1) (u24)s on [0, mask_max]. Note that their alignment is U8_SIZE, not U32_SIZE.
+
+    u32_list_base is the base of a list of (mask_idx_max+1) (u32)s on [0, mask_max].
+
+    u8_list_base is the base of a list of (mask_idx_max+1) (u8)s on [0, mask_max].
+
+Out:
+
+  Returns the mean of the mask list, guaranteed to be at least the minimum and at most the maximum (un)signed integer representable as a mask of the same format as in the nonnull input list. However, the mean is rational and generally not an integer. It may also be less than the minimum or greater than the maximum mask in the list due to numerical error.
+
+  *stat_kurtosis_base is the kurtosis of the list. Bessel's correction is not applied.
+
+  *stat_sigma_base is the standard deviation of the list. Bessel's correction is not applied.
+
+  *stat_variance_base is the variance of the list. Bessel's correction is not applied.
+*/
+  dyspoissometer_moment_t moment;
+  dyspoissometer_moment_t *moment_base;
+  u32 moment_idx;
+  u32 moment_idx_max;
+  dyspoissometer_moment_t *moment_list_base;
+  u64 mask_count;
+  u64 mask_count_part;
+  DYSPOISSOMETER_UINT mask_idx_min_next;
+  DYSPOISSOMETER_NUMBER stat_mean;
+  u32 thread_count;
+  pthread_t *thread_list_base;
+  u8 *thread_status_list_base;
+
+  moment.mask_idx_max=mask_idx_max;
+  moment.mask_idx_min=mask_idx_min;
+  moment.sign_status=sign_status;
+  moment.u16_list_base=u16_list_base;
+  moment.u24_list_base=u24_list_base;
+  moment.u32_list_base=u32_list_base;
+  moment.u8_list_base=u8_list_base;
+  mask_count=((u64)(mask_idx_max)-mask_idx_min)+1;
+  thread_count=1;
+  if(DYSPOISSOMETER_MOMENT_THREAD_MASK_COUNT_MIN<=mask_count){
+    thread_count=dyspoissometer_cpu_count_get();
+    thread_count=(u32)(MIN(thread_count, mask_count/DYSPOISSOMETER_MOMENT_THREAD_MASK_COUNT_MIN));
+  }
+  moment_idx_max=thread_count-1;
+  moment_list_base=NULL;
+  thread_list_base=NULL;
+  thread_status_list_base=NULL;
+  if(moment_idx_max){
+    moment_list_base=dyspoissometer_moment_list_malloc(moment_idx_max);
+    thread_list_base=DEBUG_MALLOC_PARANOID((ULONG)(thread_count*sizeof(pthread_t)));
+    thread_status_list_base=DEBUG_MALLOC_PARANOID((ULONG)(thread_count));
+  }
+  if(moment_list_base&&thread_list_base&&thread_status_list_base){
+/*
+Split the list into contiguous parts of roughly equal size, one per thread, with the last part absorbing the remainder. Run part zero on this thread and all others in their own threads. If a thread cannot be created, then run its part on this thread as well. Then merge the parts in order, which is deterministic regardless of thread timing.
+*/
+    mask_count_part=mask_count/thread_count;
+    mask_idx_min_next=mask_idx_min;
+    moment_idx=0;
+    do{
+      moment_base=&moment_list_base[moment_idx];
+      *moment_base=moment;
+      moment_base->mask_idx_min=mask_idx_min_next;
+      if(moment_idx!=moment_idx_max){
+        moment_base->mask_idx_max=(DYSPOISSOMETER_UINT)(mask_idx_min_next+mask_count_part-1);
+        mask_idx_min_next=(DYSPOISSOMETER_UINT)(moment_base->mask_idx_max+1);
+      }
+      thread_status_list_base[moment_idx]=0;
+#ifndef DEBUG
+      if(moment_idx){
+        thread_status_list_base[moment_idx]=!pthread_create(&thread_list_base[moment_idx], NULL, dyspoissometer_moment_thread_run, moment_base);
+      }
+#endif
+    }while((moment_idx++)!=moment_idx_max);
+    moment_idx=0;
+    do{
+      if(!thread_status_list_base[moment_idx]){
+        dyspoissometer_moment_accrue(&moment_list_base[moment_idx]);
+      }
+    }while((moment_idx++)!=moment_idx_max);
+    moment_idx=0;
+    do{
+      if(thread_status_list_base[moment_idx]){
+        pthread_join(thread_list_base[moment_idx], NULL);
+      }
+    }while((moment_idx++)!=moment_idx_max);
+    moment.mask_count=0;
+    moment_idx=0;
+    do{
+      dyspoissometer_moment_merge(&moment, &moment_list_base[moment_idx]);
+    }while((moment_idx++)!=moment_idx_max);
+  }else{
+    dyspoissometer_moment_accrue(&moment);
+  }
+  dyspoissometer_free(thread_status_list_base);
+  dyspoissometer_free(thread_list_base);
+  dyspoissometer_free(moment_list_base);
+  stat_mean=dyspoissometer_moment_stats_get(&moment, stat_kurtosis_base, stat_sigma_base, stat_variance_base);
+  return stat_mean;
+}
+
+DYSPOISSOMETER_NUMBER
+dyspoissometer_u16_list_logfreedom_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u16 mask_max, u16 *u16_list_base){
+/*
+Get the logfreedom of a list of u16 masks.
+
+In:
+
+  mask_idx_max is as defined in dyspoissometer_uint_list_logfreedom_get().
+
+  mask_idx_min is as defined in dyspoissometer_uint_list_logfreedom_get().
+
+  mask_max is as defined in dyspoissometer_uint_list_logfreedom_get(), except that it's a u16.
+
+  u16_list_base is as defined in dyspoissometer_uint_list_logfreedom_get().
+
+Out:
+
+  Return value is as defined in dyspoissometer_uint_list_logfreedom_get().
+*/
+  DYSPOISSOMETER_NUMBER logfreedom;
+
+  logfreedom=dyspoissometer_uint_list_logfreedom_get(mask_idx_max, mask_idx_min, mask_max, u16_list_base, NULL, NULL, NULL);
+  return logfreedom;
+}
+
+DYSPOISSOMETER_NUMBER
+dyspoissometer_u16_list_mean_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u8 sign_status, u16 *u16_list_base){
+/*
+Get the mean of a list of u16 or i16 masks.
+
+In:
+
+  mask_idx_max is as defined in dyspoissometer_uint_list_mean_get().
+
+  mask_idx_min is as defined in dyspoissometer_uint_list_mean_get().
+
+  sign_status is as defined in dyspoissometer_uint_list_mean_get().
+
+  u16_list_base is as defined in dyspoissometer_uint_list_mean_get().
+
+Out:
+
+  Return value is as defined in dyspoissometer_uint_list_mean_get().
+*/
+  DYSPOISSOMETER_NUMBER mean;
+
+  mean=dyspoissometer_uint_list_mean_get(mask_idx_max, mask_idx_min, sign_status, u16_list_base, NULL, NULL, NULL);
+  return mean;
+}
+
+DYSPOISSOMETER_NUMBER
+dyspoissometer_u16_list_stats_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u8 sign_status, DYSPOISSOMETER_NUMBER *stat_kurtosis_base, DYSPOISSOMETER_NUMBER *stat_sigma_base, DYSPOISSOMETER_NUMBER *stat_variance_base, u16 *u16_list_base){
+/*
+Get the mean, variance, standard deviation, and kurtosis of a list consisting of u16 or i16 masks.
+
+In:
+
+  mask_idx_max is as defined in dyspoissometer_uint_list_stats_get().
+
+  mask_idx_min is as defined in dyspoissometer_uint_list_stats_get().
+
+  sign_status is as defined in dyspoissometer_uint_list_stats_get().
+
+  *stat_kurtosis_base is as undefined.
+
+  *stat_sigma_base is as undefined.
+
+  *stat_variance_base is as undefined.
+
+  u16_list_base is as defined in dyspoissometer_uint_list_stats_get().
+
+Out:
+
+  Return value is as defined in dyspoissometer_uint_list_stats_get().
+
+  *stat_kurtosis_base is as defined in dyspoissometer_uint_list_stats_get().
+
+  *stat_sigma_base is as defined in dyspoissometer_uint_list_stats_get().
+
+  *stat_variance_base is as defined in dyspoissometer_uint_list_stats_get().
+*/
+  DYSPOISSOMETER_NUMBER stat_mean;
+
+  stat_mean=dyspoissometer_uint_list_stats_get(mask_idx_max, mask_idx_min, sign_status, stat_kurtosis_base, stat_sigma_base, stat_variance_base, u16_list_base, NULL, NULL, NULL);
+  return stat_mean;
+}
+
+DYSPOISSOMETER_NUMBER
+dyspoissometer_u24_list_logfreedom_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u32 mask_max, u8 *u24_list_base){
+/*
+Get the logfreedom of a list of u24 masks. This function is provided as a convenient compromise between u16 and u32, which affords rich statistics without having to deal with the annoyance of bit packing.
+
+In:
+
+  mask_idx_max is as defined in dyspoissometer_uint_list_logfreedom_get().
+
+  mask_idx_min is as defined in dyspoissometer_uint_list_logfreedom_get().
+
+  mask_max is as defined in dyspoissometer_uint_list_logfreedom_get(). On [0, U24_MAX].
+
+  u24_list_base is as defined in dyspoissometer_uint_list_logfreedom_get().
+
+Out:
+
+  Return value is as defined in dyspoissometer_uint_list_logfreedom_get().
+*/
+  DYSPOISSOMETER_NUMBER logfreedom;
+
+  logfreedom=dyspoissometer_uint_list_logfreedom_get(mask_idx_max, mask_idx_min, mask_max, NULL, u24_list_base, NULL, NULL);
+  return logfreedom;
+}
+
+DYSPOISSOMETER_NUMBER
+dyspoissometer_u24_list_mean_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u8 sign_status, u8 *u24_list_base){
+/*
+Get the mean of a list of u24 or i24 masks. This function is provided as a convenient compromise between u16 and u32, which affords rich statistics without having to deal with the annoyance of bit packing.
+
+In:
+
+  mask_idx_max is as defined in dyspoissometer_uint_list_mean_get().
+
+  mask_idx_min is as defined in dyspoissometer_uint_list_mean_get().
+
+  sign_status is as defined in dyspoissometer_uint_list_mean_get().
+
+  u24_list_base is as defined in dyspoissometer_uint_list_mean_get().
+
+Out:
+
+  Return value is as defined in dyspoissometer_uint_list_mean_get().
+*/
+  DYSPOISSOMETER_NUMBER mean;
+
+  mean=dyspoissometer_uint_list_mean_get(mask_idx_max, mask_idx_min, sign_status, NULL, u24_list_base, NULL, NULL);
+  return mean;
+}
+
+DYSPOISSOMETER_NUMBER
+dyspoissometer_u24_list_stats_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u8 sign_status, DYSPOISSOMETER_NUMBER *stat_kurtosis_base, DYSPOISSOMETER_NUMBER *stat_sigma_base, DYSPOISSOMETER_NUMBER *stat_variance_base, u8 *u24_list_base){
+/*
+Get the mean, variance, standard deviation, and kurtosis of a mask list consisting of u24 or i24 masks. This function is provided as a convenient compromise between u16 and u32, which affords rich statistics without having to deal with the annoyance of bit packing.
+
+In:
+
+  mask_idx_max is as defined in dyspoissometer_uint_list_stats_get().
+
+  mask_idx_min is as defined in dyspoissometer_uint_list_stats_get().
+
+  sign_status is as defined in dyspoissometer_uint_list_stats_get().
+
+  *stat_kurtosis_base is as undefined.
+
+  *stat_sigma_base is as undefined.
+
+  *stat_variance_base is as undefined.
+
+  u24_list_base is as defined in dyspoissometer_uint_list_stats_get().
+
+Out:
+
+  Return value is as defined in dyspoissometer_uint_list_stats_get().
+
+  *stat_kurtosis_base is as defined in dyspoissometer_uint_list_stats_get().
+
+  *stat_sigma_base is as defined in dyspoissometer_uint_list_stats_get().
+
+  *stat_variance_base is as defined in dyspoissometer_uint_list_stats_get().
+*/
+  DYSPOISSOMETER_NUMBER stat_mean;
+
+  stat_mean=dyspoissometer_uint_list_stats_get(mask_idx_max, mask_idx_min, sign_status, stat_kurtosis_base, stat_sigma_base, stat_variance_base, NULL, u24_list_base, NULL, NULL);
+  return stat_mean;
+}
+
+DYSPOISSOMETER_NUMBER
+dyspoissometer_u32_list_logfreedom_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u32 mask_max, u32 *u32_list_base){
+/*
+Get the logfreedom of a list of u32 masks.
+
+In:
+
+  mask_idx_max is as defined in dyspoissometer_uint_list_logfreedom_get().
+
+  mask_idx_min is as defined in dyspoissometer_uint_list_logfreedom_get().
+
+  mask_max is as defined in dyspoissometer_uint_list_logfreedom_get().
+
+  u32_list_base is as defined in dyspoissometer_uint_list_logfreedom_get().
+
+Out:
+
+  Return value is as defined in dyspoissometer_uint_list_logfreedom_get().
+*/
+  DYSPOISSOMETER_NUMBER logfreedom;
+
+  logfreedom=dyspoissometer_uint_list_logfreedom_get(mask_idx_max, mask_idx_min, mask_max, NULL, NULL, u32_list_base, NULL);
+  return logfreedom;
+}
+
+DYSPOISSOMETER_NUMBER
+dyspoissometer_u32_list_mean_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u8 sign_status, u32 *u32_list_base){
+/*
+Get the mean of a list of u32 or i32 masks.
+
+In:
+
+  mask_idx_max is as defined in dyspoissometer_uint_list_mean_get().
+
+  mask_idx_min is as defined in dyspoissometer_uint_list_mean_get().
+
+  sign_status is as defined in dyspoissometer_uint_list_mean_get().
+
+  u32_list_base is as defined in dyspoissometer_uint_list_mean_get().
+
+Out:
+
+  Return value is as defined in dyspoissometer_uint_list_mean_get().
+*/
+  DYSPOISSOMETER_NUMBER mean;
+
+  mean=dyspoissometer_uint_list_mean_get(mask_idx_max, mask_idx_min, sign_status, NULL, NULL, u32_list_base, NULL);
+  return mean;
+}
+
+DYSPOISSOMETER_NUMBER
+dyspoissometer_u32_list_stats_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u8 sign_status, DYSPOISSOMETER_NUMBER *stat_kurtosis_base, DYSPOISSOMETER_NUMBER *stat_sigma_base, DYSPOISSOMETER_NUMBER *stat_variance_base, u32 *u32_list_base){
+/*
+Get the mean, variance, standard deviation, and kurtosis of a mask list consisting of u32 or i32 masks.
+
+In:
+
+  mask_idx_max is as defined in dyspoissometer_uint_list_stats_get().
+
+  mask_idx_min is as defined in dyspoissometer_uint_list_stats_get().
+
+  sign_status is as defined in dyspoissometer_uint_list_stats_get().
+
+  *stat_kurtosis_base is as undefined.
+
+  *stat_sigma_base is as undefined.
+
+  *stat_variance_base is as undefined.
+
+  u32_list_base is as defined in dyspoissometer_uint_list_stats_get().
+
+Out:
+
+  Return value is as defined in dyspoissometer_uint_list_stats_get().
+
+  *stat_kurtosis_base is as defined in dyspoissometer_uint_list_stats_get().
+
+  *stat_sigma_base is as defined in dyspoissometer_uint_list_stats_get().
+
+  *stat_variance_base is as defined in dyspoissometer_uint_list_stats_get().
+*/
+  DYSPOISSOMETER_NUMBER stat_mean;
+
+  stat_mean=dyspoissometer_uint_list_stats_get(mask_idx_max, mask_idx_min, sign_status, stat_kurtosis_base, stat_sigma_base, stat_variance_base, NULL, NULL, u32_list_base, NULL);
+  return stat_mean;
+}
+
+DYSPOISSOMETER_NUMBER
+dyspoissometer_u8_list_logfreedom_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u8 mask_max, u8 *u8_list_base){
+/*
+Get the logfreedom of a list of u8 masks.
+
+In:
+
+  mask_idx_max is as defined in dyspoissometer_uint_list_logfreedom_get().
+
+  mask_idx_min is as defined in dyspoissometer_uint_list_logfreedom_get().
+
+  mask_max is as defined in dyspoissometer_uint_list_logfreedom_get(), except that it's a u8.
+
+  u8_list_base is as defined in dyspoissometer_uint_list_logfreedom_get().
+
+Out:
+
+  Return value is as defined in dyspoissometer_uint_list_logfreedom_get().
+*/
+  DYSPOISSOMETER_NUMBER logfreedom;
+
+  logfreedom=dyspoissometer_uint_list_logfreedom_get(mask_idx_max, mask_idx_min, mask_max, NULL, NULL, NULL, u8_list_base);
+  return logfreedom;
+}
+
+DYSPOISSOMETER_NUMBER
+dyspoissometer_u8_list_mean_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u8 sign_status, u8 *u8_list_base){
+/*
+Get the mean of a list of u8 or i8 masks.
+
+In:
+
+  mask_idx_max is as defined in dyspoissometer_uint_list_mean_get().
+
+  mask_idx_min is as defined in dyspoissometer_uint_list_mean_get().
+
+  sign_status is as defined in dyspoissometer_uint_list_mean_get().
+
+  u8_list_base is as defined in dyspoissometer_uint_list_mean_get().
+
+Out:
+
+  Return value is as defined in dyspoissometer_uint_list_mean_get().
+*/
+  DYSPOISSOMETER_NUMBER mean;
+
+  mean=dyspoissometer_uint_list_mean_get(mask_idx_max, mask_idx_min, sign_status, NULL, NULL, NULL, u8_list_base);
+  return mean;
+}
+
+DYSPOISSOMETER_NUMBER
+dyspoissometer_u8_list_stats_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u8 sign_status, DYSPOISSOMETER_NUMBER *stat_kurtosis_base, DYSPOISSOMETER_NUMBER *stat_sigma_base, DYSPOISSOMETER_NUMBER *stat_variance_base, u8 *u8_list_base){
+/*
+Get the mean, variance, standard deviation, and kurtosis of a mask list consisting of u8 or i8 masks.
+
+In:
+
+  mask_idx_max is as defined in dyspoissometer_uint_list_stats_get().
+
+  mask_idx_min is as defined in dyspoissometer_uint_list_stats_get().
+
+  sign_status is as defined in dyspoissometer_uint_list_stats_get().
+
+  *stat_kurtosis_base is as undefined.
+
+  *stat_sigma_base is as undefined.
+
+  *stat_variance_base is as undefined.
+
+  u8_list_base is as defined in dyspoissometer_uint_list_stats_get().
+
+Out:
+
+  Return value is as defined in dyspoissometer_uint_list_stats_get().
+
+  *stat_kurtosis_base is as defined in dyspoissometer_uint_list_stats_get().
+
+  *stat_sigma_base is as defined in dyspoissometer_uint_list_stats_get().
+
+  *stat_variance_base is as defined in dyspoissometer_uint_list_stats_get().
+*/
+  DYSPOISSOMETER_NUMBER stat_mean;
+
+  stat_mean=dyspoissometer_uint_list_stats_get(mask_idx_max, mask_idx_min, sign_status, stat_kurtosis_base, stat_sigma_base, stat_variance_base, NULL, NULL, NULL, u8_list_base);
+  return stat_mean;
+}
+
+DYSPOISSOMETER_NUMBER
+dyspoissometer_kernel_density_expected_fast_get(DYSPOISSOMETER_UINT mask_idx_max){
+/*
+Find the expected value of kernel density in essentially constant time. Compared to dyspoissometer_kernel_density_expected_slow_get() with DYSPOISSOMETER_NUMBER_QUAD, the double precision result is within about 7E-16 relative error, and the quad precision result is within about 1E-31 for 1000 masks, growing to about 2E-26 for 10^7 masks, mostly due to rounding error in the reference itself. The slow function is worse in double precision, with relative error reaching about 2E-7 for 10^8 masks.
+
+See also: http://cognomicon.blogspot.com/2014/12/the-kernel-density-randomness-metric.html .
+
+In:
+
+  mask_idx_max is the mask count of the mask list, less one, on [0, DYSPOISSOMETER_UINT_MAX-1]. By the definition of kernel density, (mask_max==mask_idx_max) is implied.
+
+Out:
+
+  Returns the expected kernel density, guaranteed to be on [0.0, 1.0].
+*/
+  static const i64 series_numerator_list_base[DYSPOISSOMETER_KERNEL_DENSITY_SERIES_TERM_IDX_MAX+1]={-1LL, -4LL, 8LL, 16LL, -8992LL, -334144LL, 698752LL, 23349012224LL, -1357305243136LL, -6319924923392LL};
+  static const u64 series_denominator_list_base[DYSPOISSOMETER_KERNEL_DENSITY_SERIES_TERM_IDX_MAX+1]={3ULL, 135ULL, 2835ULL, 8505ULL, 12629925ULL, 492567075ULL, 1477701225ULL, 39565450299375ULL, 2255230667064375ULL, 6765692001193125ULL};
+  static const i64 series_sqrt_numerator_list_base[DYSPOISSOMETER_KERNEL_DENSITY_SERIES_TERM_IDX_MAX+1]={1LL, 1LL, 1LL, -139LL, -571LL, 163879LL, 5246819LL, -534703531LL, -4483131259LL, 432261921612371LL};
+  static const u64 series_sqrt_denominator_list_base[DYSPOISSOMETER_KERNEL_DENSITY_SERIES_TERM_IDX_MAX+1]={1ULL, 12ULL, 288ULL, 51840ULL, 2488320ULL, 209018880ULL, 75246796800ULL, 902961561600ULL, 86684309913600ULL, 514904800886784000ULL};
+  DYSPOISSOMETER_NUMBER density;
+  DYSPOISSOMETER_UINT mask_count;
+  DYSPOISSOMETER_NUMBER mask_count_reciprocal;
+  DYSPOISSOMETER_UINT mask_count_minus_period;
+  DYSPOISSOMETER_NUMBER series;
+  DYSPOISSOMETER_NUMBER series_sqrt;
+  DYSPOISSOMETER_NUMBER term;
+  u8 term_idx;
+/*
+The expected kernel density is Q(N)/N, where N is the mask count and Q() is Ramanujan's Q-function:
+
+  Q(N) = Σ(k = (0, N-1), (N-1)!/((N-k-1)!(N^k)))
+
+Below DYSPOISSOMETER_KERNEL_DENSITY_SERIES_MASK_COUNT_MIN, sum the terms directly. Each is the previous one times ((N-k)/N), so there is no need for EXP() or LOG_SUM(). The terms shrink monotonically, so N times the current term bounds what remains, and we can stop as soon as that no longer affects the sum.
+
+Otherwise, use the asymptotic expansion of Q(N), which follows from applying Laplace's method to Q(N) = ∫(x = (0, ∞), (e^(-x))((1+(x/N))^(N-1))):
+
+  Q(N)/N = sqrt(π/(2N))Σ(j, a(j)/(N^j)) + Σ(j, b(j)/(N^(j+1)))
+
+where a(j) are the coefficients of Stirling's series for N!, namely {1, 1/12, 1/288, -139/51840, ...}, and b(j) are {-1/3, -4/135, 8/2835, 16/8505, ...}. The magnitudes of both are under 10^(-3) for j on [3, 10], so truncating after (DYSPOISSOMETER_KERNEL_DENSITY_SERIES_TERM_IDX_MAX+1) terms leaves a relative error under (10^(-3))/(N^10), which is below the epsilon of even quad precision at the threshold.
+*/
+  mask_count=(DYSPOISSOMETER_UINT)(mask_idx_max+1);
+  if(mask_count<DYSPOISSOMETER_KERNEL_DENSITY_SERIES_MASK_COUNT_MIN){
+    density=1.0f;
+    mask_count_minus_period=mask_idx_max;
+    term=1.0f;
+    while(mask_count_minus_period){
+      term*=mask_count_minus_period;
+      term/=mask_count;
+      density+=term;
+      if(density==(density+(term*mask_count))){
+        break;
+      }
+      mask_count_minus_period--;
+    }
+    density/=mask_count;
+  }else{
+    mask_count_reciprocal=(DYSPOISSOMETER_NUMBER)(1.0f)/mask_count;
+    series=0.0f;
+    series_sqrt=0.0f;
+    term_idx=DYSPOISSOMETER_KERNEL_DENSITY_SERIES_TERM_IDX_MAX;
+    do{
+      series=(series*mask_count_reciprocal)+((DYSPOISSOMETER_NUMBER)(series_numerator_list_base[term_idx])/(DYSPOISSOMETER_NUMBER)(series_denominator_list_base[term_idx]));
+      series_sqrt=(series_sqrt*mask_count_reciprocal)+((DYSPOISSOMETER_NUMBER)(series_sqrt_numerator_list_base[term_idx])/(DYSPOISSOMETER_NUMBER)(series_sqrt_denominator_list_base[term_idx]));
+    }while(term_idx--);
+    density=(DYSPOISSOMETER_SQRT_HALF_PI*SQRT(mask_count_reciprocal)*series_sqrt)+(series*mask_count_reciprocal);
+  }
+/*
+Do some CYA for horrendous precision problems (and negative zero baloney) that shoudn't happen (but who knows, with C).
+*/
+  if(density<=0.0f){
+    density=0.0f;
+  }else if(1.0f<density){
+    density=1.0f;
+  }
+  return density;
+}
+
+DYSPOISSOMETER_NUMBER
+dyspoissometer_kernel_density_expected_slow_get(DYSPOISSOMETER_UINT mask_idx_max){
+/*
+Find the expected value of kernel density by summing the defining series with logarithmic terms, which takes time proportional to the square root of mask_idx_max at best. For all practical purposes, use dyspoissometer_kernel_density_expected_fast_get() instead; this function serves as a reference for it, but only with DYSPOISSOMETER_NUMBER_QUAD, because its logarithmic terms lose too much precision otherwise.
+
+In:
+
+  See dyspoissometer_kernel_density_expected_fast_get().
+
+Out:
+
+  See dyspoissometer_kernel_density_expected_fast_get().
+*/
+  DYSPOISSOMETER_NUMBER density;
+  DYSPOISSOMETER_UINT mask_count;
+  DYSPOISSOMETER_NUMBER mask_count_log;
+  DYSPOISSOMETER_UINT mask_count_minus_period;
+  DYSPOISSOMETER_NUMBER mask_idx_max_logsum;
+  DYSPOISSOMETER_UINT period_minus_1;
+  DYSPOISSOMETER_UINT period_minus_1_max;
+  DYSPOISSOMETER_UINT period_minus_1_min;
+  DYSPOISSOMETER_NUMBER term;
+
+  mask_idx_max_logsum=LOG_SUM(mask_idx_max);
+  density=0.0f;
+  mask_count=(DYSPOISSOMETER_UINT)(mask_idx_max+1);
+  mask_count_log=LOG(mask_count);
+  period_minus_1=0;
+  if(mask_idx_max){
+    period_minus_1_max=mask_idx_max;
+    period_minus_1_min=1;
+/*
+Binary search for the first nonzero term. Granted, it may still be too small to matter to the final output, but at least it saves us the vast majority of compute time with large mask counts.
+*/
+    while(period_minus_1_max!=period_minus_1_min){
+      period_minus_1=(DYSPOISSOMETER_UINT)(period_minus_1_max-((period_minus_1_max-period_minus_1_min)>>1));
+      mask_count_minus_period=(DYSPOISSOMETER_UINT)(mask_idx_max-period_minus_1);
+      term=EXP(mask_idx_max_logsum-LOG_SUM(mask_count_minus_period)-(period_minus_1*mask_count_log));
+      if(term!=0.0f){
+        period_minus_1_min=period_minus_1;
+      }else{
+        period_minus_1_max=(DYSPOISSOMETER_UINT)(period_minus_1-1);
+      }
+    }
+/*
+Use logarithmic summation from the smallest to largest magnitude term in order to maximize accuracy. Otherwise, this process is identical to dyspoissometer_kernel_density_expected_fast_get().
+*/
+    period_minus_1=period_minus_1_max;
+    mask_count_minus_period=(DYSPOISSOMETER_UINT)(mask_idx_max-period_minus_1);
+    do{
+      term=EXP(mask_idx_max_logsum-LOG_SUM(mask_count_minus_period)-(period_minus_1*mask_count_log));
+      density+=term;
+      mask_count_minus_period++;
+    }while(--period_minus_1);
+  }
+  density+=1.0f;
+  density/=mask_count;
+/*
+Do some CYA for horrendous precision problems (and negative zero baloney) that shoudn't happen (but who knows, with C).
+*/
+  if(density<=0.0f){
+    density=0.0f;
+  }else if(1.0f<density){
+    density=1.0f;
   }
-  return mean;
+  return density;
 }
 
-DYSPOISSOMETER_NUMBER
-dyspoissometer_uint_list_stats_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u8 sign_status, DYSPOISSOMETER_NUMBER *stat_kurtosis_base, DYSPOISSOMETER_NUMBER *stat_sigma_base, DYSPOISSOMETER_NUMBER *stat_variance_base, u16 *u16_list_base, u8 *u24_list_base, u32 *u32_list_base, u8 *u8_list_base){
+DYSPOISSOMETER_UINT
+dyspoissometer_kernel_size_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT *mask_list_base){
 /*
-Get the mean, variance, standard deviation, and kurtosis of a mask list consisting of (un)signed integers.
-
-In:
-
-  mask_idx_max is the number of masks whose mean to compute, less (mask_idx_min+1). On [mask_idx_min, DYSPOISSOMETER_UINT_MAX-1].
-
-  mask_idx_min is the index of the first mask in the list whose mean to compute. On [0, mask_idx_max].
-
-  sign_status is one if the list of so-called uints actually consists of (signed) ints, else zero. (As far as the compiler is concerned, they're uints in either case so we don't get into signed overflow badness.)
-
-  *stat_kurtosis_base is undefined.
-
-  *stat_sigma_base is undefined.
-
-  *stat_variance_base is undefined.
-
-  Exactly one of the following must be non(NULL):
+Find the kernel size of a mask set in linear time. For a slower but more obviously correct implementation, use dyspoissometer_kernel_size_slow_get() instead.
 
-    u16_list_base is the base of a list of (mask_idx_max+1) (u16)s on [0, mask_max].
+See also: http://cognomicon.blogspot.com/2014/12/measuring-kernel-density.html .
 
-    u24_list_base is the base of a list of (mask_idx_max+1) (u24)s on [0, mask_max]. Note that their alignment is U8_SIZE, not U32_SIZE.
+In:
 
-    u32_list_base is the base of a list of (mask_idx_max+1) (u32)s on [0, mask_max].
+  mask_idx_max is as defined in dyspoissometer_kernel_density_expected_fast_get().
 
-    u8_list_base is the base of a list of (mask_idx_max+1) (u8)s on [0, mask_max].
+  *mask_list_base contains (mask_idx_max+1) masks, each on [0, mask_idx_max].
 
 Out:
 
-  Returns the mean of the mask list, guaranteed to be at least the minimum and at most the maximum (un)signed integer representable as a mask of the same format as in the nonnull input list. However, the mean is rational and generally not an integer. It may also be less than the minimum or greater than the maximum mask in the list due to numerical error.
-
-  *stat_kurtosis_base is the kurtosis of the list. Bessel's correction is not applied.
-
-  *stat_sigma_base is the standard deviation of the list. Bessel's correction is not applied.
-
-  *stat_variance_base is the variance of the list. Bessel's correction is not applied.
+  Returns zero if we ran out of memory, else the kernel size of *mask_list_base, which is identical to the return value of dyspoissometer_kernel_size_slow_get().
 */
-  DYSPOISSOMETER_NUMBER delta;
-  DYSPOISSOMETER_NUMBER delta_squared;
-  u32 mask;
-  u64 mask_count;
+  DYSPOISSOMETER_UINT kernel_size;
+  DYSPOISSOMETER_UINT mask;
+  DYSPOISSOMETER_UINT mask_cycle;
   DYSPOISSOMETER_UINT mask_idx;
-  DYSPOISSOMETER_NUMBER stat_kurtosis;
-  DYSPOISSOMETER_NUMBER stat_mean;
-  DYSPOISSOMETER_NUMBER stat_sigma;
-  DYSPOISSOMETER_NUMBER stat_variance;
-  ULONG u8_idx;
+  DYSPOISSOMETER_UINT walk;
+  DYSPOISSOMETER_UINT *walk_list_base;
 
-  mask_idx=mask_idx_min;
-  stat_mean=dyspoissometer_uint_list_mean_get(mask_idx_max, mask_idx_min, sign_status, u16_list_base, u24_list_base, u32_list_base, u8_list_base);
-  stat_kurtosis=0.0f;
-  stat_variance=0.0f;
-  if(u8_list_base){
-    do{
-      mask=u8_list_base[mask_idx];
-      if(!sign_status){
-        delta=stat_mean-(DYSPOISSOMETER_NUMBER)(mask);
-      }else{
-        if(mask<=I8_MAX){
-          delta=stat_mean-(DYSPOISSOMETER_NUMBER)(mask);
-        }else{
-          delta=stat_mean+(u8)((~mask)+1);
-        }
-      }
-      delta_squared=delta*delta;
-      stat_variance+=delta_squared;
-      stat_kurtosis+=delta_squared*delta_squared;
-    }while((mask_idx++)!=mask_idx_max);
-  }else if(u16_list_base){
-    do{
-      mask=u16_list_base[mask_idx];
-      if(!sign_status){
-        delta=stat_mean-(DYSPOISSOMETER_NUMBER)(mask);
-      }else{
-        if(mask<=I16_MAX){
-          delta=stat_mean-(DYSPOISSOMETER_NUMBER)(mask);
-        }else{
-          delta=stat_mean+(u16)((~mask)+1);
-        }
-      }
-      delta_squared=delta*delta;
-      stat_variance+=delta_squared;
-      stat_kurtosis+=delta_squared*delta_squared;
-    }while((mask_idx++)!=mask_idx_max);
-  }else if(u24_list_base){
-    u8_idx=(ULONG)((ULONG)(mask_idx_min)*3);
-    do{
-      mask=(u32)((u32)(u24_list_base[u8_idx+2])<<U16_BITS)+(u16)((u16)(u24_list_base[u8_idx+1])<<U8_BITS)+u24_list_base[u8_idx];
-      u8_idx=(ULONG)(u8_idx+3);
-      if(!sign_status){
-        delta=stat_mean-(DYSPOISSOMETER_NUMBER)(mask);
-      }else{
-        if(mask<=I24_MAX){
-          delta=stat_mean-(DYSPOISSOMETER_NUMBER)(mask);
-        }else{
-          delta=stat_mean+(DYSPOISSOMETER_NUMBER)((u32)(((~mask)+1)&U24_MAX));
-        }
-      }
-      delta_squared=delta*delta;
-      stat_variance+=delta_squared;
-      stat_kurtosis+=delta_squared*delta_squared;
-    }while((mask_idx++)!=mask_idx_max);
-  }else{
+/*
+*mask_list_base is a functional graph, wherein each index points to the index given by its mask. Iterating it through itself eventually leaves only those indexes which lie on cycles, so the kernel size is just the number of such indexes. Find them by walking from each unvisited index, marking each index visited with a walk number unique to the starting index, until we hit an index which has already been visited. If that index was marked by the current walk, then we have discovered a new cycle, so walk it again to count its length. Otherwise, we merely ran into a tree or cycle which was discovered previously. Each index is visited at most twice, so this is O(mask_idx_max).
+*/
+  walk_list_base=dyspoissometer_uint_list_malloc_zero(mask_idx_max);
+  kernel_size=0;
+  if(walk_list_base){
+    mask_idx=0;
     do{
-      mask=u32_list_base[mask_idx];
-      if(!sign_status){
-        delta=stat_mean-(DYSPOISSOMETER_NUMBER)(mask);
-      }else{
-        if(mask<=I32_MAX){
-          delta=stat_mean-(DYSPOISSOMETER_NUMBER)(mask);
-        }else{
-          delta=stat_mean+(DYSPOISSOMETER_NUMBER)((u32)((~mask)+1));
+      if(!walk_list_base[mask_idx]){
+        walk=(DYSPOISSOMETER_UINT)(mask_idx+1);
+        mask=mask_idx;
+        do{
+          walk_list_base[mask]=walk;
+          mask=mask_list_base[mask];
+        }while(!walk_list_base[mask]);
+        if(walk_list_base[mask]==walk){
+          mask_cycle=mask;
+          do{
+            kernel_size++;
+            mask=mask_list_base[mask];
+          }while(mask!=mask_cycle);
         }
       }
-      delta_squared=delta*delta;
-      stat_variance+=delta_squared;
-      stat_kurtosis+=delta_squared*delta_squared;
     }while((mask_idx++)!=mask_idx_max);
   }
-  mask_count=((u64)(mask_idx_max)-mask_idx_min)+1;
-  stat_kurtosis*=(DYSPOISSOMETER_NUMBER)(mask_count)/(stat_variance*stat_variance);
-  stat_variance/=(DYSPOISSOMETER_NUMBER)(mask_count);
-  stat_sigma=SQRT(stat_variance);
-  *stat_kurtosis_base=stat_kurtosis;
-  *stat_sigma_base=stat_sigma;
-  *stat_variance_base=stat_variance;
-  return stat_mean;
+  dyspoissometer_free(walk_list_base);
+  return kernel_size;
 }
 
-DYSPOISSOMETER_NUMBER
-dyspoissometer_u16_list_logfreedom_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u16 mask_max, u16 *u16_list_base){
+DYSPOISSOMETER_UINT
+dyspoissometer_kernel_size_slow_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT *mask_list_base){
 /*
-Get the logfreedom of a list of u16 masks.
-
-In:
+Find the kernel size of a mask set by repeatedly squaring the mapping, which takes O(mask_idx_max*log(mask_idx_max)) time. This serves as a reference for dyspoissometer_kernel_size_get(), which is faster.
 
-  mask_idx_max is as defined in dyspoissometer_uint_list_logfreedom_get().
+See also: http://cognomicon.blogspot.com/2014/12/measuring-kernel-density.html .
 
-  mask_idx_min is as defined in dyspoissometer_uint_list_logfreedom_get().
+In:
 
-  mask_max is as defined in dyspoissometer_uint_list_logfreedom_get(), except that it's a u16.
+  mask_idx_max is as defined in dyspoissometer_kernel_density_expected_fast_get().
 
-  u16_list_base is as defined in dyspoissometer_uint_list_logfreedom_get().
+  *mask_list_base contains (mask_idx_max+1) masks, each on [0, mask_idx_max].
 
 Out:
 
-  Return value is as defined in dyspoissometer_uint_list_logfreedom_get().
+  Returns zero if we ran out of memory, else the kernel size of *mask_list_base. Notionally, the kernel size is just the number of unique integers remaining in the list after iterating its contents through the list itself (mask_idx_max+1) times.
 */
-  DYSPOISSOMETER_NUMBER logfreedom;
+  u8 bit_idx;
+  DYSPOISSOMETER_UINT bitmap_idx;
+  DYSPOISSOMETER_UINT bitmap_uint;
+  DYSPOISSOMETER_UINT bitmap_uint_count_minus_1;
+  DYSPOISSOMETER_UINT *bitmap0_base;
+  DYSPOISSOMETER_UINT *bitmap1_base;
+  DYSPOISSOMETER_UINT iteration;
+  DYSPOISSOMETER_UINT iteration_idx;
+  DYSPOISSOMETER_UINT *iteration_list0_base;
+  DYSPOISSOMETER_UINT *iteration_list1_base;
+  DYSPOISSOMETER_UINT kernel_size;
 
-  logfreedom=dyspoissometer_uint_list_logfreedom_get(mask_idx_max, mask_idx_min, mask_max, u16_list_base, NULL, NULL, NULL);
-  return logfreedom;
+  bitmap_uint_count_minus_1=mask_idx_max>>DYSPOISSOMETER_UINT_BITS_LOG2;
+  bitmap0_base=dyspoissometer_uint_list_malloc(bitmap_uint_count_minus_1);
+  bitmap1_base=dyspoissometer_uint_list_malloc(bitmap_uint_count_minus_1);
+  iteration_list0_base=dyspoissometer_uint_list_malloc(mask_idx_max);
+  iteration_list1_base=dyspoissometer_uint_list_malloc(mask_idx_max);
+  kernel_size=0;
+  if(bitmap0_base&&bitmap1_base&&iteration_list0_base&&iteration_list1_base){
+    dyspoissometer_uint_list_copy(mask_idx_max, 0, 0, mask_list_base, iteration_list0_base);
+    do{
+/*
+Iterate the list through itself via a double buffer until the bitmap of remaining integers is constant from one iteration to the next.
+*/
+      dyspoissometer_uint_list_zero(bitmap_uint_count_minus_1, bitmap0_base);
+      iteration_idx=0;
+      do{
+        iteration=iteration_list0_base[iteration_list0_base[iteration_idx]];
+        iteration_list1_base[iteration_idx]=iteration;
+        bitmap_idx=iteration>>DYSPOISSOMETER_UINT_BITS_LOG2;
+        bitmap_uint=(DYSPOISSOMETER_UINT)(bitmap0_base[bitmap_idx]|((DYSPOISSOMETER_UINT)(1)<<(iteration&DYSPOISSOMETER_UINT_BIT_MAX)));
+        bitmap0_base[bitmap_idx]=bitmap_uint;
+      }while((iteration_idx++)!=mask_idx_max);
+      dyspoissometer_uint_list_zero(bitmap_uint_count_minus_1, bitmap1_base);
+      iteration_idx=mask_idx_max;
+      do{
+        iteration=iteration_list1_base[iteration_list1_base[iteration_idx]];
+        iteration_list0_base[iteration_idx]=iteration;
+        bitmap_idx=iteration>>DYSPOISSOMETER_UINT_BITS_LOG2;
+        bitmap_uint=(DYSPOISSOMETER_UINT)(bitmap1_base[bitmap_idx]|((DYSPOISSOMETER_UINT)(1)<<(iteration&DYSPOISSOMETER_UINT_BIT_MAX)));
+        bitmap1_base[bitmap_idx]=bitmap_uint;
+      }while(iteration_idx--);
+      bitmap_idx=0;
+      do{
+        bitmap_uint=bitmap0_base[bitmap_idx]^bitmap1_base[bitmap_idx];
+      }while(((bitmap_idx++)!=bitmap_uint_count_minus_1)&&(!bitmap_uint));
+    }while(bitmap_uint);
+/*
+Count the ones in the bitmap, which equals the kernel size.
+*/
+    bitmap_idx=bitmap_uint_count_minus_1;
+    do{
+      bitmap_uint=bitmap0_base[bitmap_idx];
+      for(bit_idx=0; bit_idx<=DYSPOISSOMETER_UINT_BIT_MAX; bit_idx++){
+        kernel_size=(DYSPOISSOMETER_UINT)(kernel_size+(bitmap_uint&1));
+        bitmap_uint>>=1;
+      }
+    }while(bitmap_idx--);
+  }
+  dyspoissometer_free(iteration_list1_base);
+  dyspoissometer_free(iteration_list0_base);
+  dyspoissometer_free(bitmap1_base);
+  dyspoissometer_free(bitmap0_base);
+  return kernel_size;
 }
 
 DYSPOISSOMETER_NUMBER
-dyspoissometer_u16_list_mean_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u8 sign_status, u16 *u16_list_base){
+dyspoissometer_kernel_density_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT kernel_size){
 /*
-Get the mean of a list of u16 or i16 masks.
+Given a mask list size and its kernel size, compute its kernel density.
 
 In:
 
-  mask_idx_max is as defined in dyspoissometer_uint_list_mean_get().
-
-  mask_idx_min is as defined in dyspoissometer_uint_list_mean_get().
-
-  sign_status is as defined in dyspoissometer_uint_list_mean_get().
+  mask_idx_max is as defined in dyspoissometer_kernel_density_expected_fast_get().
 
-  u16_list_base is as defined in dyspoissometer_uint_list_mean_get().
+  kernel_size is the (nonzero) return value of dyspoissometer_kernel_size_get().
 
 Out:
 
-  Return value is as defined in dyspoissometer_uint_list_mean_get().
+  Returns the kernel density corresponding to the input parameters, guaranteed to be on [0.0, 1.0].
 */
-  DYSPOISSOMETER_NUMBER mean;
+  DYSPOISSOMETER_NUMBER density;
 
-  mean=dyspoissometer_uint_list_mean_get(mask_idx_max, mask_idx_min, sign_status, u16_list_base, NULL, NULL, NULL);
-  return mean;
+  density=(DYSPOISSOMETER_NUMBER)(kernel_size)/(DYSPOISSOMETER_UINT)(mask_idx_max+1);
+/*
+Do some CYA for horrendous precision problems (and negative zero baloney) that shoudn't happen (but who knows, with C).
+*/
+  if(density<=0.0f){
+    density=0.0f;
+  }else if(1.0f<density){
+    density=1.0f;
+  }
+  return density;
 }
 
 DYSPOISSOMETER_NUMBER
-dyspoissometer_u16_list_stats_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u8 sign_status, DYSPOISSOMETER_NUMBER *stat_kurtosis_base, DYSPOISSOMETER_NUMBER *stat_sigma_base, DYSPOISSOMETER_NUMBER *stat_variance_base, u16 *u16_list_base){
+dyspoissometer_kernel_skew_get(DYSPOISSOMETER_NUMBER kernel_density, DYSPOISSOMETER_NUMBER kernel_density_expected){
 /*
-Get the mean, variance, standard deviation, and kurtosis of a list consisting of u16 or i16 masks.
-
-In:
-
-  mask_idx_max is as defined in dyspoissometer_uint_list_stats_get().
-
-  mask_idx_min is as defined in dyspoissometer_uint_list_stats_get().
-
-  sign_status is as defined in dyspoissometer_uint_list_stats_get().
+Given the kernel size of a mask list and the statistical expectation thereof, compute kernel skew.
 
-  *stat_kurtosis_base is as undefined.
+See also: http://cognomicon.blogspot.com/2016/05/kernel-skew-normalized-randomness-metric.html .
 
-  *stat_sigma_base is as undefined.
+In:
 
-  *stat_variance_base is as undefined.
+  kernel_density is the return value of dyspoissometer_kernel_density_get().
 
-  u16_list_base is as defined in dyspoissometer_uint_list_stats_get().
+  kernel_density_expected is the corresponding return value of dyspoissometer_kernel_density_expected_fast_get() or dyspoissometer_kernel_density_expected_slow_get().
 
 Out:
 
-  Return value is as defined in dyspoissometer_uint_list_stats_get().
-
-  *stat_kurtosis_base is as defined in dyspoissometer_uint_list_stats_get().
-
-  *stat_sigma_base is as defined in dyspoissometer_uint_list_stats_get().
-
-  *stat_variance_base is as defined in dyspoissometer_uint_list_stats_get().
+  Returns the kernel skew corresponding to the input parameters, guaranteed to be on [0.0, 1.0].
 */
-  DYSPOISSOMETER_NUMBER stat_mean;
+  DYSPOISSOMETER_NUMBER skew;
 
-  stat_mean=dyspoissometer_uint_list_stats_get(mask_idx_max, mask_idx_min, sign_status, stat_kurtosis_base, stat_sigma_base, stat_variance_base, u16_list_base, NULL, NULL, NULL);
-  return stat_mean;
+  skew=0.5f;
+  if(kernel_density<=kernel_density_expected){
+    skew*=kernel_density/kernel_density_expected;
+  }else{
+    skew*=2.0f-(kernel_density_expected/kernel_density);
+  }
+/*
+Do some CYA for horrendous precision problems (and negative zero baloney) that shoudn't happen (but who knows, with C).
+*/
+  if(skew<=0.0f){
+    skew=0.0f;
+  }else if(1.0f<skew){
+    skew=1.0f;
+  }
+  return skew;
 }
 
 DYSPOISSOMETER_NUMBER
-dyspoissometer_u24_list_logfreedom_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u32 mask_max, u8 *u24_list_base){
+dyspoissometer_mibr_expected_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_max){
 /*
-Get the logfreedom of a list of u24 masks. This function is provided as a convenient compromise between u16 and u32, which affords rich statistics without having to deal with the annoyance of bit packing.
+Return the expected (average or mean) MIBR (EMIBR) for a given mask count and mask span.
+
+See also: http://dyspoissonism.blogspot.com/2016/06/mibr-randomness-metric-of-last-resort.html .
 
 In:
 
-  mask_idx_max is as defined in dyspoissometer_uint_list_logfreedom_get().
+  mask_idx_max is as defined in dyspoissometer_mibr_get().
 
-  mask_idx_min is as defined in dyspoissometer_uint_list_logfreedom_get().
+  mask_max is as defined in dyspoissometer_mibr_scan_get().
 
-  mask_max is as defined in dyspoissometer_uint_list_logfreedom_get(). On [0, U24_MAX].
+Out:
 
-  u24_list_base is as defined in dyspoissometer_uint_list_logfreedom_get().
+  Returns the EMIBR.
 
-Out:
+  Queries with large input values may take a long time. In such cases, and if and only if (mask_idx_max==max_max), the following approximation of EMIBR, appears to be accurate to within one unit, although it is not used by this function:
 
-  Return value is as defined in dyspoissometer_uint_list_logfreedom_get().
+  E=(((mask_max+1)*(pi/2))^0.5)-(4/3)
+
+  Note also that EMIBR is close to ((mask_max+1)*S0), where S0 is the expected kernel density. Their asymptotic ratio appears to be one.
 */
-  DYSPOISSOMETER_NUMBER logfreedom;
+  DYSPOISSOMETER_NUMBER mask_span;
+  DYSPOISSOMETER_NUMBER mask_span_recip;
+  DYSPOISSOMETER_UINT mibr;
+  DYSPOISSOMETER_NUMBER mibr_expected;
+  DYSPOISSOMETER_NUMBER mibr_expected_old;
+  DYSPOISSOMETER_UINT mibr_max;
+  DYSPOISSOMETER_NUMBER weight;
+  DYSPOISSOMETER_NUMBER weight_partial;
+  DYSPOISSOMETER_NUMBER weight_sum;
 
-  logfreedom=dyspoissometer_uint_list_logfreedom_get(mask_idx_max, mask_idx_min, mask_max, NULL, u24_list_base, NULL, NULL);
-  return logfreedom;
+  mibr_expected=0.0f;
+  if(mask_idx_max&&mask_max){
+    mask_span=(DYSPOISSOMETER_NUMBER)(mask_max)+1.0f;
+    mask_span_recip=1.0f/mask_span;
+    mibr=1;
+    mibr_max=MIN(mask_idx_max, mask_max);
+    weight_partial=mask_max*mask_span_recip*mask_span_recip;
+    weight_sum=mask_span_recip;
+    do{
+      mibr_expected_old=mibr_expected;
+      weight=((DYSPOISSOMETER_NUMBER)(mibr)+1.0f)*weight_partial;
+      mibr_expected+=mibr*weight;
+      weight_sum+=weight;
+      weight_partial*=(DYSPOISSOMETER_NUMBER)(mask_max-mibr)*mask_span_recip;
+    }while((mibr_expected!=mibr_expected_old)&&((mibr++)!=mibr_max));
+    mibr_expected+=mibr_max*(1.0f-weight_sum);
+    if(mibr_expected<=0.0f){
+      mibr_expected=0.0f;
+    }else if(mibr_max<mibr_expected){
+      mibr_expected=mibr_max;
+    }
+  }
+  return mibr_expected;
 }
 
-DYSPOISSOMETER_NUMBER
-dyspoissometer_u24_list_mean_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u8 sign_status, u8 *u24_list_base){
+void
+dyspoissometer_uint_idx_list_sort(DYSPOISSOMETER_UINT *idx_list_base0, DYSPOISSOMETER_UINT *idx_list_base1, DYSPOISSOMETER_UINT uint_idx_max, DYSPOISSOMETER_UINT *uint_list_base0, DYSPOISSOMETER_UINT *uint_list_base1){
 /*
-Get the mean of a list of u24 or i24 masks. This function is provided as a convenient compromise between u16 and u32, which affords rich statistics without having to deal with the annoyance of bit packing.
+Sort a list of (DYSPOISSOMETER_UINT)s ascending as though they were unsigned integers equal to their implementation-specific representations, using double buffering for speed. Perform the same permutation on their corresponding indexes. This is designed to permit sorting a list of variably sized strings via a list of scalars. Objects of equal value will remain in their original order regardless of sort direction.
 
 In:
 
-  mask_idx_max is as defined in dyspoissometer_uint_list_mean_get().
+  *idx_list_base0 contains (uint_idx_max+1) items, each corresponding to the respective DYSPOISSOMETER_UINT at uint_list_base0. For example, they might be the base indexes of strings whose hashes are at *uint_list_base0.
 
-  mask_idx_min is as defined in dyspoissometer_uint_list_mean_get().
+  *idx_list_base1 is undefined and writable for (uint_idx_max+1) items.
 
-  sign_status is as defined in dyspoissometer_uint_list_mean_get().
+  uint_idx_max is one less than the number of items in each list.
 
-  u24_list_base is as defined in dyspoissometer_uint_list_mean_get().
+  *uint_list_base0 contains (uint_idx_max+1) items to sort.
+
+  *uint_list_base1 is undefined and writable for (uint_idx_max+1) items.
 
 Out:
 
-  Return value is as defined in dyspoissometer_uint_list_mean_get().
-*/
-  DYSPOISSOMETER_NUMBER mean;
+  *idx_list_base0 is reordered according to the permutation of *uint_list_base0 relative to its input state.
 
-  mean=dyspoissometer_uint_list_mean_get(mask_idx_max, mask_idx_min, sign_status, NULL, u24_list_base, NULL, NULL);
-  return mean;
+  *idx_list_base1 is undefined. 
+
+  *uint_list_base0 is sorted ascending.
+
+  *uint_list_base1 is undefined. 
+*/
+  u8 continue_status;
+  DYSPOISSOMETER_UINT idx;
+  ULONG list_size;
+  DYSPOISSOMETER_UINT *idx_list_base2;
+  DYSPOISSOMETER_UINT uint;
+  DYSPOISSOMETER_UINT uint_idx_list_base[U8_SPAN];
+  DYSPOISSOMETER_UINT uint_idx0;
+  DYSPOISSOMETER_UINT uint_idx1;
+  DYSPOISSOMETER_UINT *uint_list_base2;
+  DYSPOISSOMETER_UINT uint_old;
+  DYSPOISSOMETER_UINT uint_u8;
+  DYSPOISSOMETER_UINT uint_u8_freq;
+  DYSPOISSOMETER_UINT uint_u8_idx;
+/*
+Perform a bytewise radix sort of *uint_list_base0.
+*/
+  uint_u8_idx=0;
+  do{
+/*
+*uint_idx_list_base will serve as a list of base indexes for all possible (u8)s. Zero it.
+*/
+    memset(uint_idx_list_base, 0, (size_t)(U8_SPAN*sizeof(DYSPOISSOMETER_UINT)));
+    continue_status=0;
+/*
+Count u8 frequencies and save them to *uint_idx_list_base. Move backwards to maximize cache hits in most cases.
+*/
+    uint_idx0=uint_idx_max;
+    uint_old=uint_list_base0[uint_idx_max];
+    do{
+      uint=uint_list_base0[uint_idx0];
+      continue_status=(u8)(continue_status|(uint_old<uint));
+      uint_u8=((unsigned char *)(&uint))[uint_u8_idx];
+      uint_old=uint;
+      uint_idx_list_base[uint_u8]++;
+    }while(uint_idx0--);
+    if(continue_status){
+/*
+Convert uint_idx_list_base from a list of frequencies of (u8)s to a list of preceding cummulative sums of frequencies of (u8)s. This will tell us how to sort this particular u8 lane.
+*/
+      uint_u8=0;
+      uint_idx0=0;
+      do{
+        uint_u8_freq=uint_idx_list_base[uint_u8];
+        uint_idx_list_base[uint_u8]=uint_idx0;
+        uint_idx0=(DYSPOISSOMETER_UINT)(uint_idx0+uint_u8_freq);
+      }while((uint_u8++)!=U8_MAX);
+/*
+Sort *idx_list_base1 and *uint_list_base1 ascending by the u8 lane designated by uint_u8_idx.
+*/
+      uint_idx0=0;
+      do{
+        idx=idx_list_base0[uint_idx0];
+        uint=uint_list_base0[uint_idx0];
+        uint_u8=((unsigned char *)(&uint))[uint_u8_idx];
+        uint_idx1=uint_idx_list_base[uint_u8];
+        idx_list_base1[uint_idx1]=idx;
+        uint_list_base1[uint_idx1]=uint;
+        uint_idx1++;
+        uint_idx_list_base[uint_u8]=uint_idx1;
+      }while((uint_idx0++)!=uint_idx_max);
+    }
+/*
+Swap list bases in order to accomplish double buffering.
+*/
+    idx_list_base2=idx_list_base0;
+    idx_list_base0=idx_list_base1;
+    idx_list_base1=idx_list_base2;
+    uint_list_base2=uint_list_base0;
+    uint_list_base0=uint_list_base1;
+    uint_list_base1=uint_list_base2;
+/*
+continue_status should always be zero when the items have been sorted. However, due to floating-point undefinedness, it might be one even though the objects have actually been sorted when viewed as unsigned integers (which we could not have done because it would have been an aliasing violation, hence our use of (unsigned char *)).
+*/
+    uint_u8_idx++;
+  }while(continue_status&&(uint_u8_idx!=sizeof(DYSPOISSOMETER_UINT)));
+  if((uint_u8_idx&1)^(!continue_status)){
+/*
+Copy the index and object lists back to what is, from the caller's perspective, idx_list_base0 and uint_list_base0, respectively.
+*/
+    list_size=(ULONG)(uint_idx_max);
+    list_size++;
+    list_size=(ULONG)(list_size*sizeof(DYSPOISSOMETER_UINT));
+    memcpy(idx_list_base0, idx_list_base1, (size_t)(list_size));
+    memcpy(uint_list_base0, uint_list_base1, (size_t)(list_size));
+  }
+  return;
 }
 
-DYSPOISSOMETER_NUMBER
-dyspoissometer_u24_list_stats_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u8 sign_status, DYSPOISSOMETER_NUMBER *stat_kurtosis_base, DYSPOISSOMETER_NUMBER *stat_sigma_base, DYSPOISSOMETER_NUMBER *stat_variance_base, u8 *u24_list_base){
+dyspoissometer_uint_idx_record_t *
+dyspoissometer_uint_idx_record_list_malloc(DYSPOISSOMETER_UINT record_idx_max){
 /*
-Get the mean, variance, standard deviation, and kurtosis of a mask list consisting of u24 or i24 masks. This function is provided as a convenient compromise between u16 and u32, which affords rich statistics without having to deal with the annoyance of bit packing.
+Allocate a list of undefined (index, DYSPOISSOMETER_UINT) records for use with dyspoissometer_uint_idx_list_record_sort().
 
 In:
 
-  mask_idx_max is as defined in dyspoissometer_uint_list_stats_get().
-
-  mask_idx_min is as defined in dyspoissometer_uint_list_stats_get().
-
-  sign_status is as defined in dyspoissometer_uint_list_stats_get().
-
-  *stat_kurtosis_base is as undefined.
-
-  *stat_sigma_base is as undefined.
-
-  *stat_variance_base is as undefined.
-
-  u24_list_base is as defined in dyspoissometer_uint_list_stats_get().
+  record_idx_max is the number of records to allocate, less one.
 
 Out:
 
-  Return value is as defined in dyspoissometer_uint_list_stats_get().
-
-  *stat_kurtosis_base is as defined in dyspoissometer_uint_list_stats_get().
-
-  *stat_sigma_base is as defined in dyspoissometer_uint_list_stats_get().
-
-  *stat_variance_base is as defined in dyspoissometer_uint_list_stats_get().
+  Returns NULL on failure, else the base of (record_idx_max+1) undefined (dyspoissometer_uint_idx_record_t)s, which should eventually be freed via dyspoissometer_free().
 */
-  DYSPOISSOMETER_NUMBER stat_mean;
+  dyspoissometer_uint_idx_record_t *list_base;
+  ULONG list_size;
+  ULONG record_count;
 
-  stat_mean=dyspoissometer_uint_list_stats_get(mask_idx_max, mask_idx_min, sign_status, stat_kurtosis_base, stat_sigma_base, stat_variance_base, NULL, u24_list_base, NULL, NULL);
-  return stat_mean;
+  list_base=NULL;
+  record_count=(ULONG)((ULONG)(record_idx_max)+1);
+  if(record_count){
+    list_size=(ULONG)(record_count*sizeof(dyspoissometer_uint_idx_record_t));
+    if((list_size/sizeof(dyspoissometer_uint_idx_record_t))==record_count){
+      list_base=DEBUG_MALLOC_PARANOID(list_size);
+    }
+  }
+  return list_base;
 }
 
-DYSPOISSOMETER_NUMBER
-dyspoissometer_u32_list_logfreedom_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u32 mask_max, u32 *u32_list_base){
+void
+dyspoissometer_uint_idx_list_record_sort(DYSPOISSOMETER_UINT *idx_list_base, dyspoissometer_uint_idx_record_t *record_list0_base, dyspoissometer_uint_idx_record_t *record_list1_base, DYSPOISSOMETER_UINT uint_idx_max, DYSPOISSOMETER_UINT *uint_list_base){
 /*
-Get the logfreedom of a list of u32 masks.
+Sort a list of (DYSPOISSOMETER_UINT)s ascending and perform the same permutation on their corresponding indexes, with the same result as dyspoissometer_uint_idx_list_sort(), but faster. Each index travels together with its DYSPOISSOMETER_UINT in a single record, so each radix pass scatters one stream instead of 2. (With 32-bit or narrower integers, a record is only 8 bytes, so it moves as a single u64.) The frequencies of all u8 lanes are counted in one pass, after which lanes which are constant throughout the list are skipped. The records are packed during the first scatter and unpacked during the last.
 
 In:
 
-  mask_idx_max is as defined in dyspoissometer_uint_list_logfreedom_get().
+  *idx_list_base contains (uint_idx_max+1) items, each corresponding to the respective DYSPOISSOMETER_UINT at uint_list_base.
 
-  mask_idx_min is as defined in dyspoissometer_uint_list_logfreedom_get().
+  *record_list0_base and *record_list1_base are undefined and writable for (uint_idx_max+1) items, as from dyspoissometer_uint_idx_record_list_malloc().
 
-  mask_max is as defined in dyspoissometer_uint_list_logfreedom_get().
+  uint_idx_max is one less than the number of items in each list.
 
-  u32_list_base is as defined in dyspoissometer_uint_list_logfreedom_get().
+  *uint_list_base contains (uint_idx_max+1) items to sort.
 
 Out:
 
-  Return value is as defined in dyspoissometer_uint_list_logfreedom_get().
+  *idx_list_base is reordered according to the permutation of *uint_list_base relative to its input state.
+
+  *record_list0_base and *record_list1_base are undefined.
+
+  *uint_list_base is sorted ascending.
 */
-  DYSPOISSOMETER_NUMBER logfreedom;
+  u8 continue_status;
+  u8 lane_mask;
+  dyspoissometer_uint_idx_record_t record;
+  DYSPOISSOMETER_UINT record_count;
+  dyspoissometer_uint_idx_record_t *record_list2_base;
+  DYSPOISSOMETER_UINT uint;
+  DYSPOISSOMETER_UINT *uint_idx_list_base;
+  DYSPOISSOMETER_UINT uint_idx_list_base_list[DYSPOISSOMETER_UINT_SIZE][U8_SPAN];
+  DYSPOISSOMETER_UINT uint_idx0;
+  DYSPOISSOMETER_UINT uint_idx1;
+  DYSPOISSOMETER_UINT uint_old;
+  DYSPOISSOMETER_UINT uint_u8;
+  DYSPOISSOMETER_UINT uint_u8_freq;
+  u8 uint_u8_idx;
+  u8 uint_u8_idx_max;
 
-  logfreedom=dyspoissometer_uint_list_logfreedom_get(mask_idx_max, mask_idx_min, mask_max, NULL, NULL, u32_list_base, NULL);
-  return logfreedom;
+  memset(uint_idx_list_base_list, 0, sizeof(uint_idx_list_base_list));
+/*
+Count the frequencies of (u8)s in every lane at once. Note whether the list is already sorted, in which case there's nothing more to do.
+*/
+  continue_status=0;
+  uint_idx0=0;
+  uint_old=uint_list_base[0];
+  do{
+    uint=uint_list_base[uint_idx0];
+    continue_status=(u8)(continue_status|(uint<uint_old));
+    uint_old=uint;
+    uint_u8_idx=0;
+    do{
+      uint_u8=(DYSPOISSOMETER_UINT)((uint>>(uint_u8_idx<<U8_BITS_LOG2))&U8_MAX);
+      uint_idx_list_base_list[uint_u8_idx][uint_u8]++;
+    }while((uint_u8_idx++)!=(DYSPOISSOMETER_UINT_SIZE-1));
+  }while((uint_idx0++)!=uint_idx_max);
+  if(continue_status){
+/*
+Set a bit in lane_mask for each lane which is not constant, i.e. for which a pass would not be an identity permutation. At least one must be set, because the list isn't sorted. uint_u8_idx_max is the last such lane.
+*/
+    lane_mask=0;
+    record_count=(DYSPOISSOMETER_UINT)(uint_idx_max+1);
+    uint=uint_list_base[0];
+    uint_u8_idx=0;
+    uint_u8_idx_max=0;
+    do{
+      uint_u8=(DYSPOISSOMETER_UINT)((uint>>(uint_u8_idx<<U8_BITS_LOG2))&U8_MAX);
+      if(uint_idx_list_base_list[uint_u8_idx][uint_u8]!=record_count){
+        lane_mask=(u8)(lane_mask|(1U<<uint_u8_idx));
+        uint_u8_idx_max=uint_u8_idx;
+      }
+    }while((uint_u8_idx++)!=(DYSPOISSOMETER_UINT_SIZE-1));
+    continue_status=0;
+    uint_u8_idx=0;
+    do{
+      if((lane_mask>>uint_u8_idx)&1){
+/*
+Convert *uint_idx_list_base from a list of frequencies of (u8)s to a list of preceding cummulative sums thereof. Then stably scatter by this lane: from the caller's lists to *record_list1_base on the first pass (continue_status is zero), from *record_list0_base back to the caller's lists on the last pass (unless it's also the first), and from *record_list0_base to *record_list1_base otherwise.
+*/
+        uint_idx_list_base=uint_idx_list_base_list[uint_u8_idx];
+        uint_u8=0;
+        uint_idx0=0;
+        do{
+          uint_u8_freq=uint_idx_list_base[uint_u8];
+          uint_idx_list_base[uint_u8]=uint_idx0;
+          uint_idx0=(DYSPOISSOMETER_UINT)(uint_idx0+uint_u8_freq);
+        }while((uint_u8++)!=U8_MAX);
+        uint_idx0=0;
+        if(!continue_status){
+          do{
+            uint=uint_list_base[uint_idx0];
+            record.idx=idx_list_base[uint_idx0];
+            record.uint=uint;
+            uint_u8=(DYSPOISSOMETER_UINT)((uint>>(uint_u8_idx<<U8_BITS_LOG2))&U8_MAX);
+            uint_idx1=uint_idx_list_base[uint_u8];
+            record_list1_base[uint_idx1]=record;
+            uint_idx_list_base[uint_u8]=(DYSPOISSOMETER_UINT)(uint_idx1+1);
+          }while((uint_idx0++)!=uint_idx_max);
+        }else if(uint_u8_idx!=uint_u8_idx_max){
+          do{
+            record=record_list0_base[uint_idx0];
+            uint_u8=(DYSPOISSOMETER_UINT)((record.uint>>(uint_u8_idx<<U8_BITS_LOG2))&U8_MAX);
+            uint_idx1=uint_idx_list_base[uint_u8];
+            record_list1_base[uint_idx1]=record;
+            uint_idx_list_base[uint_u8]=(DYSPOISSOMETER_UINT)(uint_idx1+1);
+          }while((uint_idx0++)!=uint_idx_max);
+        }else{
+          do{
+            record=record_list0_base[uint_idx0];
+            uint_u8=(DYSPOISSOMETER_UINT)((record.uint>>(uint_u8_idx<<U8_BITS_LOG2))&U8_MAX);
+            uint_idx1=uint_idx_list_base[uint_u8];
+            idx_list_base[uint_idx1]=record.idx;
+            uint_list_base[uint_idx1]=record.uint;
+            uint_idx_list_base[uint_u8]=(DYSPOISSOMETER_UINT)(uint_idx1+1);
+          }while((uint_idx0++)!=uint_idx_max);
+        }
+        record_list2_base=record_list0_base;
+        record_list0_base=record_list1_base;
+        record_list1_base=record_list2_base;
+        continue_status=(u8)(continue_status+1);
+      }
+    }while((uint_u8_idx++)!=uint_u8_idx_max);
+    if(continue_status==1){
+/*
+Only one lane needed sorting, so the records never made it back to the caller's lists. Unpack them.
+*/
+      uint_idx0=0;
+      do{
+        record=record_list0_base[uint_idx0];
+        idx_list_base[uint_idx0]=record.idx;
+        uint_list_base[uint_idx0]=record.uint;
+      }while((uint_idx0++)!=uint_idx_max);
+    }
+  }
+  return;
 }
 
-DYSPOISSOMETER_NUMBER
-dyspoissometer_u32_list_mean_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u8 sign_status, u32 *u32_list_base){
+u8
+dyspoissometer_mibr_scan_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT *mask_list_base, DYSPOISSOMETER_UINT mask_max, DYSPOISSOMETER_UINT *mibr_base){
 /*
-Get the mean of a list of u32 or i32 masks.
+Return the maximum index before repetition (MIBR) of a given mask list in linear time, exiting at the first repetition. For a sort-based implementation which does not require mask_max, but sorts the mask list, use dyspoissometer_mibr_get() instead.
+
+See also: http://dyspoissonism.blogspot.com/2016/06/mibr-randomness-metric-of-last-resort.html .
 
 In:
 
-  mask_idx_max is as defined in dyspoissometer_uint_list_mean_get().
+  mask_idx_max is the number of masks in the list, less one, AKA (Q - 1).
 
-  mask_idx_min is as defined in dyspoissometer_uint_list_mean_get().
+  *mask_list_base contains (mask_idx_max+1) masks, each on [0, mask_max].
 
-  sign_status is as defined in dyspoissometer_uint_list_mean_get().
+  mask_max is the maximum possible mask, AKA (Z - 1).
 
-  u32_list_base is as defined in dyspoissometer_uint_list_mean_get().
+  *mibr_base is undefined.
 
 Out:
 
-  Return value is as defined in dyspoissometer_uint_list_mean_get().
+  Returns one if we ran out of memory, else zero.
+
+  *mibr_base is the MIBR, identical to the output of dyspoissometer_mibr_get(), if the return value is zero, else undefined.
+
+  *mask_list_base is unchanged.
 */
-  DYSPOISSOMETER_NUMBER mean;
+  u64 bit_count;
+  DYSPOISSOMETER_UINT bitmap_idx;
+  DYSPOISSOMETER_UINT bitmap_idx_max;
+  DYSPOISSOMETER_UINT *bitmap_base;
+  DYSPOISSOMETER_UINT bitmap_mask;
+  DYSPOISSOMETER_UINT bitmap_uint;
+  u8 hash_bits;
+  DYSPOISSOMETER_UINT hash_idx;
+  DYSPOISSOMETER_UINT hash_idx_max;
+  DYSPOISSOMETER_UINT *hash_list_base;
+  DYSPOISSOMETER_UINT mask;
+  DYSPOISSOMETER_UINT mask_idx;
+  DYSPOISSOMETER_UINT mibr;
+  u8 status;
 
-  mean=dyspoissometer_uint_list_mean_get(mask_idx_max, mask_idx_min, sign_status, NULL, NULL, u32_list_base, NULL);
-  return mean;
+/*
+If a bitmap of all possible masks would be no larger than the mask list, then use it to record which masks have occurred. Otherwise, record them in an open-addressed hash table of at least twice as many slots as masks, so that probe sequences stay short, with a bitmap indicating which slots are occupied. Either way, stop at the first repetition.
+*/
+  hash_bits=0;
+  hash_idx_max=0;
+  hash_list_base=NULL;
+  bitmap_idx_max=mask_max>>DYSPOISSOMETER_UINT_BITS_LOG2;
+  if(mask_idx_max<bitmap_idx_max){
+    bit_count=(u64)(((u64)(mask_idx_max)+1)<<1);
+    do{
+      hash_bits++;
+    }while(((u64)(1)<<hash_bits)<bit_count);
+    hash_idx_max=(DYSPOISSOMETER_UINT)(((u64)(1)<<hash_bits)-1);
+    bitmap_idx_max=hash_idx_max>>DYSPOISSOMETER_UINT_BITS_LOG2;
+    hash_list_base=dyspoissometer_uint_list_malloc(hash_idx_max);
+  }
+  bitmap_base=dyspoissometer_uint_list_malloc_zero(bitmap_idx_max);
+  status=1;
+  if(bitmap_base&&((!hash_bits)||hash_list_base)){
+    mask_idx=0;
+    mibr=mask_idx_max;
+    do{
+      mask=mask_list_base[mask_idx];
+      if(!hash_bits){
+        bitmap_idx=mask>>DYSPOISSOMETER_UINT_BITS_LOG2;
+        bitmap_mask=(DYSPOISSOMETER_UINT)((DYSPOISSOMETER_UINT)(1)<<(mask&DYSPOISSOMETER_UINT_BIT_MAX));
+        bitmap_uint=bitmap_base[bitmap_idx];
+        if(bitmap_uint&bitmap_mask){
+          mibr=(DYSPOISSOMETER_UINT)(mask_idx-1);
+        }
+        bitmap_base[bitmap_idx]=(DYSPOISSOMETER_UINT)(bitmap_uint|bitmap_mask);
+      }else{
+/*
+Fibonacci hashing: take the high bits of the product of mask and (2^64) divided by the golden ratio. Then probe linearly until we find mask or an empty slot.
+*/
+        hash_idx=(DYSPOISSOMETER_UINT)((u64)((u64)(mask)*0x9E3779B97F4A7C15ULL)>>(U64_BITS-hash_bits));
+        while((bitmap_base[hash_idx>>DYSPOISSOMETER_UINT_BITS_LOG2]>>(hash_idx&DYSPOISSOMETER_UINT_BIT_MAX))&1){
+          if(hash_list_base[hash_idx]==mask){
+            mibr=(DYSPOISSOMETER_UINT)(mask_idx-1);
+            break;
+          }
+          hash_idx=(DYSPOISSOMETER_UINT)((hash_idx+1)&hash_idx_max);
+        }
+        if(mibr==mask_idx_max){
+          bitmap_idx=hash_idx>>DYSPOISSOMETER_UINT_BITS_LOG2;
+          bitmap_mask=(DYSPOISSOMETER_UINT)((DYSPOISSOMETER_UINT)(1)<<(hash_idx&DYSPOISSOMETER_UINT_BIT_MAX));
+          bitmap_base[bitmap_idx]=(DYSPOISSOMETER_UINT)(bitmap_base[bitmap_idx]|bitmap_mask);
+          hash_list_base[hash_idx]=mask;
+        }
+      }
+    }while((mibr==mask_idx_max)&&((mask_idx++)!=mask_idx_max));
+    status=0;
+    *mibr_base=mibr;
+  }
+  dyspoissometer_free(bitmap_base);
+  dyspoissometer_free(hash_list_base);
+  return status;
 }
 
-DYSPOISSOMETER_NUMBER
-dyspoissometer_u32_list_stats_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u8 sign_status, DYSPOISSOMETER_NUMBER *stat_kurtosis_base, DYSPOISSOMETER_NUMBER *stat_sigma_base, DYSPOISSOMETER_NUMBER *stat_variance_base, u32 *u32_list_base){
+u8
+dyspoissometer_mibr_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT *mask_list_base, DYSPOISSOMETER_UINT *mibr_base){
 /*
-Get the mean, variance, standard deviation, and kurtosis of a mask list consisting of u32 or i32 masks.
-
-In:
-
-  mask_idx_max is as defined in dyspoissometer_uint_list_stats_get().
-
-  mask_idx_min is as defined in dyspoissometer_uint_list_stats_get().
-
-  sign_status is as defined in dyspoissometer_uint_list_stats_get().
+Return the maximum index before repetition (MIBR) of a give mask list by stably sorting (mask, index) pairs. See dyspoissometer_mibr_scan_get() for a faster alternative which does not modify *mask_list_base.
 
-  *stat_kurtosis_base is as undefined.
+See also: http://dyspoissonism.blogspot.com/2016/06/mibr-randomness-metric-of-last-resort.html .
 
-  *stat_sigma_base is as undefined.
+In:
 
-  *stat_variance_base is as undefined.
+  mask_idx_max is the number of masks in the list, less one, AKA (Q - 1).
 
-  u32_list_base is as defined in dyspoissometer_uint_list_stats_get().
+  *mask_list_base contains (mask_idx_max+1) masks.
 
 Out:
 
-  Return value is as defined in dyspoissometer_uint_list_stats_get().
-
-  *stat_kurtosis_base is as defined in dyspoissometer_uint_list_stats_get().
+  Returns one if we ran out of memory, else zero.
 
-  *stat_sigma_base is as defined in dyspoissometer_uint_list_stats_get().
+  *mibr_base is the MIBR.
 
-  *stat_variance_base is as defined in dyspoissometer_uint_list_stats_get().
+  *mask_list_base has been sorted ascending.
 */
-  DYSPOISSOMETER_NUMBER stat_mean;
+  DYSPOISSOMETER_UINT ibr;
+  DYSPOISSOMETER_UINT mask;
+  DYSPOISSOMETER_UINT mask_idx;
+  DYSPOISSOMETER_UINT *mask_idx_list0_base;
+  DYSPOISSOMETER_UINT mask_old;
+  DYSPOISSOMETER_UINT mibr;
+  dyspoissometer_uint_idx_record_t *record_list0_base;
+  dyspoissometer_uint_idx_record_t *record_list1_base;
+  u8 status;
 
-  stat_mean=dyspoissometer_uint_list_stats_get(mask_idx_max, mask_idx_min, sign_status, stat_kurtosis_base, stat_sigma_base, stat_variance_base, NULL, NULL, u32_list_base, NULL);
-  return stat_mean;
+  mask_idx_list0_base=dyspoissometer_uint_list_malloc(mask_idx_max);
+  record_list0_base=dyspoissometer_uint_idx_record_list_malloc(mask_idx_max);
+  record_list1_base=dyspoissometer_uint_idx_record_list_malloc(mask_idx_max);
+  status=1;
+  if(mask_idx_list0_base&&record_list0_base&&record_list1_base){
+    mask_idx=0;
+    do{
+      mask_idx_list0_base[mask_idx]=mask_idx;
+    }while((mask_idx++)!=mask_idx_max);
+    dyspoissometer_uint_idx_list_record_sort(mask_idx_list0_base, record_list0_base, record_list1_base, mask_idx_max, mask_list_base);
+    mask_idx=0;
+    mibr=mask_idx_max;
+    if(mask_idx_max){
+      mask=mask_list_base[0];
+      mask_idx++;
+      do{
+        mask_old=mask;
+        mask=mask_list_base[mask_idx];
+        if(mask==mask_old){
+          ibr=(DYSPOISSOMETER_UINT)(mask_idx_list0_base[mask_idx]-1);
+          mibr=MIN(ibr, mibr);
+        }
+      }while((mask_idx++)!=mask_idx_max);
+    }
+    status=0;
+    *mibr_base=mibr;
+  }
+  dyspoissometer_free(record_list1_base);
+  dyspoissometer_free(record_list0_base);
+  dyspoissometer_free(mask_idx_list0_base);
+  return status;
 }
 
 DYSPOISSOMETER_NUMBER
-dyspoissometer_u8_list_logfreedom_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u8 mask_max, u8 *u8_list_base){
+dyspoissometer_skew_from_mibr_get(DYSPOISSOMETER_UINT mask_max, DYSPOISSOMETER_UINT mibr){
 /*
-Get the logfreedom of a list of u8 masks.
-
-In:
+Return the skew (K) for a given mask span and MIBR.
 
-  mask_idx_max is as defined in dyspoissometer_uint_list_logfreedom_get().
+See also: http://dyspoissonism.blogspot.com/2016/06/mibr-randomness-metric-of-last-resort.html .
 
-  mask_idx_min is as defined in dyspoissometer_uint_list_logfreedom_get().
+In:
 
-  mask_max is as defined in dyspoissometer_uint_list_logfreedom_get(), except that it's a u8.
+  mask_max is as defined in dyspoissometer_mibr_scan_get().
 
-  u8_list_base is as defined in dyspoissometer_uint_list_logfreedom_get().
+  mibr is the MIBR whose skew to evaluate, on [0, mask_max].
 
 Out:
 
-  Return value is as defined in dyspoissometer_uint_list_logfreedom_get().
+  Returns the MIBR skew.
 */
-  DYSPOISSOMETER_NUMBER logfreedom;
+  DYSPOISSOMETER_NUMBER skew;
 
-  logfreedom=dyspoissometer_uint_list_logfreedom_get(mask_idx_max, mask_idx_min, mask_max, NULL, NULL, NULL, u8_list_base);
-  return logfreedom;
+  skew=1.0f;
+  if(mask_max){
+    skew=EXP(LOG_SUM(mask_max)-LOG_SUM(mask_max-mibr)-(LOG_N_PLUS_1(mask_max)*mibr));
+    if(skew<=0.0f){
+      skew=0.0f;
+    }else if(1.0f<skew){
+      skew=1.0f;
+    }
+  }
+  return skew;
 }
 
-DYSPOISSOMETER_NUMBER
-dyspoissometer_u8_list_mean_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u8 sign_status, u8 *u8_list_base){
+DYSPOISSOMETER_UINT
+dyspoissometer_mibr_from_skew_get(DYSPOISSOMETER_UINT mask_max, DYSPOISSOMETER_NUMBER skew){
 /*
-Get the mean of a list of u8 or i8 masks.
-
-In:
-
-  mask_idx_max is as defined in dyspoissometer_uint_list_mean_get().
+Return the maximum MIBR whose skew is at least skew, or mask_max if no such MIBR exists.
 
-  mask_idx_min is as defined in dyspoissometer_uint_list_mean_get().
+See also: http://dyspoissonism.blogspot.com/2016/06/mibr-randomness-metric-of-last-resort.html .
 
-  sign_status is as defined in dyspoissometer_uint_list_mean_get().
+In:
 
-  u8_list_base is as defined in dyspoissometer_uint_list_mean_get().
+  mask_max is as defined in dyspoissometer_mibr_scan_get().
 
 Out:
 
-  Return value is as defined in dyspoissometer_uint_list_mean_get().
+  Returns the MIBR as specified in the summary.
 */
-  DYSPOISSOMETER_NUMBER mean;
+  DYSPOISSOMETER_UINT mibr;
+  DYSPOISSOMETER_UINT mibr_max;
+  DYSPOISSOMETER_UINT mibr_min;
+  DYSPOISSOMETER_NUMBER skew_mibr;
 
-  mean=dyspoissometer_uint_list_mean_get(mask_idx_max, mask_idx_min, sign_status, NULL, NULL, NULL, u8_list_base);
-  return mean;
+  mibr_max=mask_max;
+  if(mask_max){
+    mibr_min=0;
+    while(mibr_max!=mibr_min){
+      mibr=(DYSPOISSOMETER_UINT)(mibr_max-((mibr_max-mibr_min)>>1));
+      skew_mibr=dyspoissometer_skew_from_mibr_get(mask_max, mibr);
+      if(skew_mibr<skew){
+        mibr_max=(DYSPOISSOMETER_UINT)(mibr-1);
+      }else{
+        mibr_min=mibr;
+      }
+    }
+  }
+  return mibr_max;
 }
 
-DYSPOISSOMETER_NUMBER
-dyspoissometer_u8_list_stats_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u8 sign_status, DYSPOISSOMETER_NUMBER *stat_kurtosis_base, DYSPOISSOMETER_NUMBER *stat_sigma_base, DYSPOISSOMETER_NUMBER *stat_variance_base, u8 *u8_list_base){
+u8
+dyspoissometer_report_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, DYSPOISSOMETER_UINT mask_max, u8 metric_status, dyspoissometer_report_t *report_base, u8 sign_status, u16 *u16_list_base, u8 *u24_list_base, u32 *u32_list_base, u8 *u8_list_base){
 /*
-Get the mean, variance, standard deviation, and kurtosis of a mask list consisting of u8 or i8 masks.
+Compute any combination of Dyspoissometer metrics for one mask list. The list is swept once, a block at a time. Each block, while in the L1 cache, feeds the frequency list, the MIBR search, and the moment accumulator, so all metrics share one frequency list build.
 
 In:
 
-  mask_idx_max is as defined in dyspoissometer_uint_list_stats_get().
+  mask_idx_max is as defined in dyspoissometer_uint_list_logfreedom_get():In.
 
-  mask_idx_min is as defined in dyspoissometer_uint_list_stats_get().
+  mask_idx_min is as defined in dyspoissometer_uint_list_logfreedom_get():In.
 
-  sign_status is as defined in dyspoissometer_uint_list_stats_get().
+  mask_max is as defined in dyspoissometer_uint_list_logfreedom_get():In, but must fit in a DYSPOISSOMETER_UINT.
 
-  *stat_kurtosis_base is as undefined.
+  metric_status is the OR of any of the following, indicating which metrics to compute: DYSPOISSOMETER_REPORT_DYSPOISSONISM, DYSPOISSOMETER_REPORT_KERNEL, DYSPOISSOMETER_REPORT_LOGFREEDOM, DYSPOISSOMETER_REPORT_MIBR, and DYSPOISSOMETER_REPORT_STATS. DYSPOISSOMETER_REPORT_ALL requests all of them. If only DYSPOISSOMETER_REPORT_STATS is requested, then this is equivalent to dyspoissometer_uint_list_stats_get(), which may use multiple threads.
 
-  *stat_sigma_base is as undefined.
+  *report_base is undefined.
 
-  *stat_variance_base is as undefined.
+  sign_status is as defined in dyspoissometer_uint_list_stats_get():In. It only affects the statistics.
 
-  u8_list_base is as defined in dyspoissometer_uint_list_stats_get().
+  u16_list_base, u24_list_base, u32_list_base, and u8_list_base are as defined in dyspoissometer_uint_list_logfreedom_get():In. Exactly one must be non(NULL).
 
 Out:
 
-  Return value is as defined in dyspoissometer_uint_list_stats_get().
-
-  *stat_kurtosis_base is as defined in dyspoissometer_uint_list_stats_get().
-
-  *stat_sigma_base is as defined in dyspoissometer_uint_list_stats_get().
+  Returns one if we ran out of memory, else zero.
 
-  *stat_variance_base is as defined in dyspoissometer_uint_list_stats_get().
+  *report_base contains the requested metrics if the return value is zero, else undefined. report_base->metric_status is the subset of metric_status which was actually computed. It includes DYSPOISSOMETER_REPORT_LOGFREEDOM if DYSPOISSOMETER_REPORT_DYSPOISSONISM was requested. It excludes DYSPOISSOMETER_REPORT_KERNEL unless the masks can form a kernel, which requires that the mask count equal (mask_max+1). Fields of other metrics are undefined.
 */
+  u8 accrue_status;
+  DYSPOISSOMETER_UINT block_idx;
+  DYSPOISSOMETER_UINT block_idx_max;
+  DYSPOISSOMETER_UINT block_idx_min;
+  DYSPOISSOMETER_UINT freq;
+  DYSPOISSOMETER_UINT freq_idx_max;
+  DYSPOISSOMETER_UINT *freq_list0_base;
+  DYSPOISSOMETER_UINT *freq_list1_base;
+  DYSPOISSOMETER_UINT kernel_size;
+  u8 lane_idx_max;
+  DYSPOISSOMETER_NUMBER logfreedom;
+  DYSPOISSOMETER_UINT mask;
+  DYSPOISSOMETER_UINT mask_idx;
+  DYSPOISSOMETER_UINT mask_idx_max_block;
+  DYSPOISSOMETER_UINT mask_idx_max_relative;
+  DYSPOISSOMETER_UINT *mask_list_base;
+  DYSPOISSOMETER_UINT mibr;
+  u8 mibr_status;
+  dyspoissometer_moment_t moment;
+  dyspoissometer_moment_t moment_block;
+  u8 sparse_status;
+  DYSPOISSOMETER_NUMBER stat_kurtosis;
   DYSPOISSOMETER_NUMBER stat_mean;
+  DYSPOISSOMETER_NUMBER stat_sigma;
+  DYSPOISSOMETER_NUMBER stat_variance;
+  u8 status;
+  DYSPOISSOMETER_UINT uint_block_base[DYSPOISSOMETER_U24_BLOCK_IDX_MAX+1];
+  DYSPOISSOMETER_UINT *uint_list_base;
 
-  stat_mean=dyspoissometer_uint_list_stats_get(mask_idx_max, mask_idx_min, sign_status, stat_kurtosis_base, stat_sigma_base, stat_variance_base, NULL, NULL, NULL, u8_list_base);
-  return stat_mean;
-}
-
-DYSPOISSOMETER_NUMBER
-dyspoissometer_kernel_density_expected_fast_get(DYSPOISSOMETER_UINT mask_idx_max){
+  mask_idx_max_relative=(DYSPOISSOMETER_UINT)(mask_idx_max-mask_idx_min);
+  if(metric_status&DYSPOISSOMETER_REPORT_DYSPOISSONISM){
+    metric_status|=DYSPOISSOMETER_REPORT_LOGFREEDOM;
+  }
+  if(mask_max!=mask_idx_max_relative){
+    metric_status&=(u8)(~DYSPOISSOMETER_REPORT_KERNEL);
+  }
+  metric_status&=DYSPOISSOMETER_REPORT_ALL;
+  report_base->metric_status=metric_status;
+  if(metric_status==DYSPOISSOMETER_REPORT_STATS){
+    stat_mean=dyspoissometer_uint_list_stats_get(mask_idx_max, mask_idx_min, sign_status, &stat_kurtosis, &stat_sigma, &stat_variance, u16_list_base, u24_list_base, u32_list_base, u8_list_base);
+    report_base->stat_kurtosis=stat_kurtosis;
+    report_base->stat_mean=stat_mean;
+    report_base->stat_sigma=stat_sigma;
+    report_base->stat_variance=stat_variance;
+    return 0;
+  }
 /*
-Find the expected value of kernel density. For maximum accuracy at high mask_idx_max, use dyspoissometer_kernel_density_expected_slow_get() instead.
-
-See also: http://cognomicon.blogspot.com/2014/12/the-kernel-density-randomness-metric.html .
-
-In:
-
-  mask_idx_max is the mask count of the mask list, less one, on [0, DYSPOISSOMETER_UINT_MAX-1]. By the definition of kernel density, (mask_max==mask_idx_max) is implied.
-
-Out:
-
-  Returns the expected kernel density, guaranteed to be on [0.0, 1.0].
-*/
-  DYSPOISSOMETER_NUMBER density;
-  DYSPOISSOMETER_NUMBER density_old;
-  DYSPOISSOMETER_UINT mask_count;
-  DYSPOISSOMETER_NUMBER mask_count_log;
-  DYSPOISSOMETER_UINT mask_count_minus_period;
-  DYSPOISSOMETER_NUMBER mask_idx_max_logsum;
-  DYSPOISSOMETER_UINT period_minus_1;
-  DYSPOISSOMETER_NUMBER term;
+The kernel, the sparse frequency count, and MIBR without a dense frequency list all need the whole list as (DYSPOISSOMETER_UINT)s. Otherwise, just unpack a block at a time.
+*/
+  sparse_status=(mask_idx_max_relative<(mask_max>>DYSPOISSOMETER_FREQ_SPARSE_SPAN_SHIFT));
+  freq_list0_base=NULL;
+  freq_list1_base=NULL;
+  mask_list_base=NULL;
+  status=0;
+  if((metric_status&DYSPOISSOMETER_REPORT_KERNEL)||((metric_status&(DYSPOISSOMETER_REPORT_LOGFREEDOM|DYSPOISSOMETER_REPORT_MIBR))&&sparse_status)||((metric_status&DYSPOISSOMETER_REPORT_MIBR)&&!(metric_status&DYSPOISSOMETER_REPORT_LOGFREEDOM))){
+    mask_list_base=dyspoissometer_uint_list_malloc(mask_idx_max_relative);
+    status=!mask_list_base;
+    if(mask_list_base){
+      dyspoissometer_uint_list_unpack(mask_idx_max, mask_idx_min, u16_list_base, u24_list_base, u32_list_base, u8_list_base, mask_list_base);
+    }
+  }
+  if((!status)&&(metric_status&DYSPOISSOMETER_REPORT_KERNEL)){
+    kernel_size=dyspoissometer_kernel_size_get(mask_idx_max_relative, mask_list_base);
+    status=!kernel_size;
+    report_base->kernel_size=kernel_size;
+    if(kernel_size){
+      report_base->kernel_density=dyspoissometer_kernel_density_get(mask_idx_max_relative, kernel_size);
+      report_base->kernel_density_expected=dyspoissometer_kernel_density_expected_fast_get(mask_idx_max_relative);
+      report_base->kernel_skew=dyspoissometer_kernel_skew_get(report_base->kernel_density, report_base->kernel_density_expected);
+    }
+  }
+  if((!status)&&(metric_status&DYSPOISSOMETER_REPORT_LOGFREEDOM)&&!sparse_status){
+    freq_list0_base=dyspoissometer_freq_list_lane_malloc_zero(0, &lane_idx_max, mask_idx_max_relative, mask_max);
+    if(!freq_list0_base){
+      freq_list0_base=dyspoissometer_uint_list_malloc_zero(mask_max);
+    }
+    freq_list1_base=dyspoissometer_uint_list_malloc(mask_max);
+    status=!(freq_list0_base&&freq_list1_base);
+  }
+  mibr=mask_idx_max_relative;
+  mibr_status=(freq_list0_base&&(metric_status&DYSPOISSOMETER_REPORT_MIBR));
+  moment.mask_count=0;
+  if((!status)&&(freq_list0_base||(metric_status&DYSPOISSOMETER_REPORT_STATS))){
+    moment.sign_status=sign_status;
+    moment.u16_list_base=u16_list_base;
+    moment.u24_list_base=u24_list_base;
+    moment.u32_list_base=u32_list_base;
+    moment.u8_list_base=u8_list_base;
+    moment_block=moment;
+    mask_idx=mask_idx_min;
+    do{
+      mask_idx_max_block=mask_idx_max;
+      if(DYSPOISSOMETER_U24_BLOCK_IDX_MAX<(DYSPOISSOMETER_UINT)(mask_idx_max-mask_idx)){
+        mask_idx_max_block=(DYSPOISSOMETER_UINT)(mask_idx+DYSPOISSOMETER_U24_BLOCK_IDX_MAX);
+      }
+      if(freq_list0_base){
+        block_idx_max=(DYSPOISSOMETER_UINT)(mask_idx_max_block-mask_idx);
+        if(mask_list_base){
+          uint_list_base=&mask_list_base[(DYSPOISSOMETER_UINT)(mask_idx-mask_idx_min)];
+        }else{
+          dyspoissometer_uint_list_unpack(mask_idx_max_block, mask_idx, u16_list_base, u24_list_base, u32_list_base, u8_list_base, uint_block_base);
+          uint_list_base=uint_block_base;
+        }
+        accrue_status=1;
+        block_idx_min=0;
+        if(mibr_status){
 /*
-Use logarithmic summation to evaluate the expected value of kernel density. Continue evaluating terms until either we run out of them, or they become so small as to not make any difference to the final output. (This is slightly inaccurate because many such negligible terms could sum to a nonnegligible term. We account for that possibility in dyspoissometer_kernel_density_expected_slow_get().)
+Until a mask repeats, accrue masks in order onto the first lane, checking each one's previous frequency. This yields the MIBR as a byproduct of building the frequency list.
 */
-  mask_idx_max_logsum=LOG_SUM(mask_idx_max);
-  density=0.0f;
-  mask_count=(DYSPOISSOMETER_UINT)(mask_idx_max+1);
-  mask_count_log=LOG(mask_count);
-  period_minus_1=0;
-  if(mask_idx_max){
-    period_minus_1=1;
-    mask_count_minus_period=(DYSPOISSOMETER_UINT)(mask_idx_max-period_minus_1);
-    do{
-      term=EXP(mask_idx_max_logsum-LOG_SUM(mask_count_minus_period)-(period_minus_1*mask_count_log));
-      density_old=density;
-      density+=term;
-      mask_count_minus_period--;
-    }while(((period_minus_1++)!=mask_idx_max)&&(density!=density_old));
+          block_idx=0;
+          do{
+            mask=uint_list_base[block_idx];
+            freq=freq_list0_base[mask];
+            freq_list0_base[mask]=(DYSPOISSOMETER_UINT)(freq+1);
+            if(freq){
+              mibr=(DYSPOISSOMETER_UINT)(mask_idx-mask_idx_min+block_idx-1);
+              mibr_status=0;
+              break;
+            }
+          }while((block_idx++)!=block_idx_max);
+          accrue_status=(!mibr_status)&&(block_idx!=block_idx_max);
+          block_idx_min=(DYSPOISSOMETER_UINT)(block_idx+1);
+        }
+        if(accrue_status){
+          dyspoissometer_freq_list_accrue(freq_list0_base, lane_idx_max, block_idx_max, block_idx_min, mask_max, NULL, NULL, NULL, NULL, uint_list_base);
+        }
+      }
+      if(metric_status&DYSPOISSOMETER_REPORT_STATS){
+        moment_block.mask_idx_max=mask_idx_max_block;
+        moment_block.mask_idx_min=mask_idx;
+        dyspoissometer_moment_accrue(&moment_block);
+        dyspoissometer_moment_merge(&moment, &moment_block);
+      }
+      mask_idx=(DYSPOISSOMETER_UINT)(mask_idx_max_block+1);
+    }while(mask_idx_max_block!=mask_idx_max);
+    if(freq_list0_base){
+      dyspoissometer_freq_list_merge(freq_list0_base, lane_idx_max, mask_max);
+      logfreedom=dyspoissometer_logfreedom_sparse_get(freq_list0_base, freq_list1_base, mask_max);
+      report_base->logfreedom=logfreedom;
+    }
+    if(metric_status&DYSPOISSOMETER_REPORT_STATS){
+      stat_mean=dyspoissometer_moment_stats_get(&moment, &stat_kurtosis, &stat_sigma, &stat_variance);
+      report_base->stat_kurtosis=stat_kurtosis;
+      report_base->stat_mean=stat_mean;
+      report_base->stat_sigma=stat_sigma;
+      report_base->stat_variance=stat_variance;
+    }
   }
-  density+=1.0f;
-  density/=mask_count;
+  dyspoissometer_free(freq_list1_base);
+  dyspoissometer_free(freq_list0_base);
+  if((!status)&&(metric_status&DYSPOISSOMETER_REPORT_MIBR)){
+    if(mask_list_base&&!(metric_status&DYSPOISSOMETER_REPORT_LOGFREEDOM&&!sparse_status)){
+      status=dyspoissometer_mibr_scan_get(mask_idx_max_relative, mask_list_base, mask_max, &mibr);
+    }
+    report_base->mibr=mibr;
+    report_base->mibr_skew=dyspoissometer_skew_from_mibr_get(mask_max, mibr);
+  }
+  if((!status)&&(metric_status&DYSPOISSOMETER_REPORT_LOGFREEDOM)&&sparse_status){
 /*
-Do some CYA for horrendous precision problems (and negative zero baloney) that shoudn't happen (but who knows, with C).
+The mask span is too large for a dense frequency list, so count frequencies by sorting our own copy of the masks, as dyspoissometer_uint_list_logfreedom_get() does. The mask order is no longer needed.
 */
-  if(density<=0.0f){
-    density=0.0f;
-  }else if(1.0f<density){
-    density=1.0f;
+    freq_list1_base=dyspoissometer_uint_list_malloc(mask_idx_max_relative);
+    status=!freq_list1_base;
+    if(freq_list1_base){
+      freq_idx_max=dyspoissometer_freq_list_sparse_get(mask_idx_max_relative, mask_list_base, freq_list1_base);
+      logfreedom=dyspoissometer_logfreedom_nonzero_get(freq_idx_max, mask_list_base, freq_list1_base, mask_idx_max_relative, mask_max);
+      report_base->logfreedom=logfreedom;
+    }
+    dyspoissometer_free(freq_list1_base);
   }
-  return density;
+  if((!status)&&(metric_status&DYSPOISSOMETER_REPORT_DYSPOISSONISM)){
+    report_base->dyspoissonism=dyspoissometer_dyspoissonism_get(report_base->logfreedom, mask_idx_max_relative, mask_max);
+  }
+  dyspoissometer_free(mask_list_base);
+  return status;
 }
 
-DYSPOISSOMETER_NUMBER
-dyspoissometer_kernel_density_expected_slow_get(DYSPOISSOMETER_UINT mask_idx_max){
+u8
+dyspoissometer_baseline_compare(dyspoissometer_baseline_t *baseline0_base, dyspoissometer_baseline_t *baseline1_base){
 /*
-Find the expected value of kernel density using maximum accuracy at high mask_idx_max. For most practical purposes, use dyspoissometer_kernel_density_expected_fast_get() instead.
+Compare the keys of 2 baselines.
 
 In:
 
-  See dyspoissometer_kernel_density_expected_fast_get().
+  *baseline0_base is a dyspoissometer_baseline_t.
+
+  *baseline1_base is a dyspoissometer_baseline_t.
 
 Out:
 
-  See dyspoissometer_kernel_density_expected_fast_get().
+  Returns zero if the keys are equal, else one. The logfreedom fields are ignored.
 */
-  DYSPOISSOMETER_NUMBER density;
-  DYSPOISSOMETER_UINT mask_count;
-  DYSPOISSOMETER_NUMBER mask_count_log;
-  DYSPOISSOMETER_UINT mask_count_minus_period;
-  DYSPOISSOMETER_NUMBER mask_idx_max_logsum;
-  DYSPOISSOMETER_UINT period_minus_1;
-  DYSPOISSOMETER_UINT period_minus_1_max;
-  DYSPOISSOMETER_UINT period_minus_1_min;
-  DYSPOISSOMETER_NUMBER term;
+  u8 status;
 
-  mask_idx_max_logsum=LOG_SUM(mask_idx_max);
-  density=0.0f;
-  mask_count=(DYSPOISSOMETER_UINT)(mask_idx_max+1);
-  mask_count_log=LOG(mask_count);
-  period_minus_1=0;
-  if(mask_idx_max){
-    period_minus_1_max=mask_idx_max;
-    period_minus_1_min=1;
-/*
-Binary search for the first nonzero term. Granted, it may still be too small to matter to the final output, but at least it saves us the vast majority of compute time with large mask counts.
-*/
-    while(period_minus_1_max!=period_minus_1_min){
-      period_minus_1=(DYSPOISSOMETER_UINT)(period_minus_1_max-((period_minus_1_max-period_minus_1_min)>>1));
-      mask_count_minus_period=(DYSPOISSOMETER_UINT)(mask_idx_max-period_minus_1);
-      term=EXP(mask_idx_max_logsum-LOG_SUM(mask_count_minus_period)-(period_minus_1*mask_count_log));
-      if(term!=0.0f){
-        period_minus_1_min=period_minus_1;
-      }else{
-        period_minus_1_max=(DYSPOISSOMETER_UINT)(period_minus_1-1);
-      }
-    }
-/*
-Use logarithmic summation from the smallest to largest magnitude term in order to maximize accuracy. Otherwise, this process is identical to dyspoissometer_kernel_density_expected_fast_get().
-*/
-    period_minus_1=period_minus_1_max;
-    mask_count_minus_period=(DYSPOISSOMETER_UINT)(mask_idx_max-period_minus_1);
-    do{
-      term=EXP(mask_idx_max_logsum-LOG_SUM(mask_count_minus_period)-(period_minus_1*mask_count_log));
-      density+=term;
-      mask_count_minus_period++;
-    }while(--period_minus_1);
-  }
-  density+=1.0f;
-  density/=mask_count;
-/*
-Do some CYA for horrendous precision problems (and negative zero baloney) that shoudn't happen (but who knows, with C).
-*/
-  if(density<=0.0f){
-    density=0.0f;
-  }else if(1.0f<density){
-    density=1.0f;
-  }
-  return density;
+  status=(baseline0_base->iteration_max!=baseline1_base->iteration_max);
+  status=(u8)(status|(baseline0_base->kind!=baseline1_base->kind));
+  status=(u8)(status|(baseline0_base->mask_idx_max!=baseline1_base->mask_idx_max));
+  status=(u8)(status|(baseline0_base->mask_max!=baseline1_base->mask_max));
+  status=(u8)(status|(baseline0_base->precision!=baseline1_base->precision));
+  return status;
 }
 
-DYSPOISSOMETER_UINT
-dyspoissometer_kernel_size_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT *mask_list_base){
+void
+dyspoissometer_baseline_pack(dyspoissometer_baseline_t *baseline_base, u8 *record_base){
 /*
-Find the kernel size of a mask set.
-
-See also: http://cognomicon.blogspot.com/2014/12/measuring-kernel-density.html .
+Serialize a baseline to a record of a baseline file.
 
 In:
 
-  mask_idx_max is as defined in dyspoissometer_kernel_density_expected_fast_get().
+  *baseline_base is the baseline to serialize.
 
-  *mask_list_base contains (mask_idx_max+1) masks, each on [0, mask_idx_max].
+  *record_base is writable for DYSPOISSOMETER_BASELINE_RECORD_SIZE bytes.
 
 Out:
 
-  Returns zero if we ran out of memory, else the kernel size of *mask_list_base. Notionally, the kernel size is just the number of unique integers remaining in the list after iterating its contents through the list itself (mask_idx_max+1) times.
-*/
-  u8 bit_idx;
-  DYSPOISSOMETER_UINT bitmap_idx;
-  DYSPOISSOMETER_UINT bitmap_uint;
-  DYSPOISSOMETER_UINT bitmap_uint_count_minus_1;
-  DYSPOISSOMETER_UINT *bitmap0_base;
-  DYSPOISSOMETER_UINT *bitmap1_base;
-  DYSPOISSOMETER_UINT iteration;
-  DYSPOISSOMETER_UINT iteration_idx;
-  DYSPOISSOMETER_UINT *iteration_list0_base;
-  DYSPOISSOMETER_UINT *iteration_list1_base;
-  DYSPOISSOMETER_UINT kernel_size;
-
-  bitmap_uint_count_minus_1=mask_idx_max>>DYSPOISSOMETER_UINT_BITS_LOG2;
-  bitmap0_base=dyspoissometer_uint_list_malloc(bitmap_uint_count_minus_1);
-  bitmap1_base=dyspoissometer_uint_list_malloc(bitmap_uint_count_minus_1);
-  iteration_list0_base=dyspoissometer_uint_list_malloc(mask_idx_max);
-  iteration_list1_base=dyspoissometer_uint_list_malloc(mask_idx_max);
-  kernel_size=0;
-  if(bitmap0_base&&bitmap1_base&&iteration_list0_base&&iteration_list1_base){
-    dyspoissometer_uint_list_copy(mask_idx_max, 0, 0, mask_list_base, iteration_list0_base);
-    do{
-/*
-Iterate the list through itself via a double buffer until the bitmap of remaining integers is constant from one iteration to the next.
+  *record_base contains the fields of *baseline_base as defined in DYSPOISSOMETER_BASELINE_RECORD_SIZE.
 */
-      dyspoissometer_uint_list_zero(bitmap_uint_count_minus_1, bitmap0_base);
-      iteration_idx=0;
-      do{
-        iteration=iteration_list0_base[iteration_list0_base[iteration_idx]];
-        iteration_list1_base[iteration_idx]=iteration;
-        bitmap_idx=iteration>>DYSPOISSOMETER_UINT_BITS_LOG2;
-        bitmap_uint=(DYSPOISSOMETER_UINT)(bitmap0_base[bitmap_idx]|((DYSPOISSOMETER_UINT)(1)<<(iteration&DYSPOISSOMETER_UINT_BIT_MAX)));
-        bitmap0_base[bitmap_idx]=bitmap_uint;
-      }while((iteration_idx++)!=mask_idx_max);
-      dyspoissometer_uint_list_zero(bitmap_uint_count_minus_1, bitmap1_base);
-      iteration_idx=mask_idx_max;
-      do{
-        iteration=iteration_list1_base[iteration_list1_base[iteration_idx]];
-        iteration_list0_base[iteration_idx]=iteration;
-        bitmap_idx=iteration>>DYSPOISSOMETER_UINT_BITS_LOG2;
-        bitmap_uint=(DYSPOISSOMETER_UINT)(bitmap1_base[bitmap_idx]|((DYSPOISSOMETER_UINT)(1)<<(iteration&DYSPOISSOMETER_UINT_BIT_MAX)));
-        bitmap1_base[bitmap_idx]=bitmap_uint;
-      }while(iteration_idx--);
-      bitmap_idx=0;
-      do{
-        bitmap_uint=bitmap0_base[bitmap_idx]^bitmap1_base[bitmap_idx];
-      }while(((bitmap_idx++)!=bitmap_uint_count_minus_1)&&(!bitmap_uint));
-    }while(bitmap_uint);
 /*
-Count the ones in the bitmap, which equals the kernel size.
+Copy each field individually so that the record never contains padding or any other bytes which weren't explicitly written.
 */
-    bitmap_idx=bitmap_uint_count_minus_1;
-    do{
-      bitmap_uint=bitmap0_base[bitmap_idx];
-      for(bit_idx=0; bit_idx<=DYSPOISSOMETER_UINT_BIT_MAX; bit_idx++){
-        kernel_size=(DYSPOISSOMETER_UINT)(kernel_size+(bitmap_uint&1));
-        bitmap_uint>>=1;
-      }
-    }while(bitmap_idx--);
-  }
-  dyspoissometer_free(iteration_list1_base);
-  dyspoissometer_free(iteration_list0_base);
-  dyspoissometer_free(bitmap1_base);
-  dyspoissometer_free(bitmap0_base);
-  return kernel_size;
+  memcpy(&record_base[0], &baseline_base->logfreedom, (size_t)(U64_SIZE));
+  memcpy(&record_base[U64_SIZE], &baseline_base->iteration_max, (size_t)(U64_SIZE));
+  memcpy(&record_base[U64_SIZE<<1], &baseline_base->mask_idx_max, (size_t)(U64_SIZE));
+  memcpy(&record_base[U64_SIZE*3], &baseline_base->mask_max, (size_t)(U64_SIZE));
+  record_base[U64_SIZE<<2]=baseline_base->kind;
+  record_base[(U64_SIZE<<2)+1]=baseline_base->precision;
+  return;
 }
 
-DYSPOISSOMETER_NUMBER
-dyspoissometer_kernel_density_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT kernel_size){
+void
+dyspoissometer_baseline_unpack(dyspoissometer_baseline_t *baseline_base, u8 *record_base){
 /*
-Given a mask list size and its kernel size, compute its kernel density.
+Deserialize a baseline from a record of a baseline file.
 
 In:
 
-  mask_idx_max is as defined in dyspoissometer_kernel_density_expected_fast_get().
+  *baseline_base is undefined.
 
-  kernel_size is the (nonzero) return value of dyspoissometer_kernel_size_get().
+  *record_base is a record as defined in DYSPOISSOMETER_BASELINE_RECORD_SIZE.
 
 Out:
 
-  Returns the kernel density corresponding to the input parameters, guaranteed to be on [0.0, 1.0].
+  *baseline_base is the baseline at record_base.
 */
-  DYSPOISSOMETER_NUMBER density;
+  memcpy(&baseline_base->logfreedom, &record_base[0], (size_t)(U64_SIZE));
+  memcpy(&baseline_base->iteration_max, &record_base[U64_SIZE], (size_t)(U64_SIZE));
+  memcpy(&baseline_base->mask_idx_max, &record_base[U64_SIZE<<1], (size_t)(U64_SIZE));
+  memcpy(&baseline_base->mask_max, &record_base[U64_SIZE*3], (size_t)(U64_SIZE));
+  baseline_base->kind=record_base[U64_SIZE<<2];
+  baseline_base->precision=record_base[(U64_SIZE<<2)+1];
+  return;
+}
 
-  density=(DYSPOISSOMETER_NUMBER)(kernel_size)/(DYSPOISSOMETER_UINT)(mask_idx_max+1);
+u8
+dyspoissometer_baseline_find(dyspoissometer_baseline_t *baseline_base, char *filename_base){
 /*
-Do some CYA for horrendous precision problems (and negative zero baloney) that shoudn't happen (but who knows, with C).
-*/
-  if(density<=0.0f){
-    density=0.0f;
-  }else if(1.0f<density){
-    density=1.0f;
+Look up a memoized median or maximum logfreedom, first among the builtin baselines, then in a baseline file.
+
+In:
+
+  *baseline_base contains the key to find. Its logfreedom is ignored.
+
+  filename_base is NULL to search only the builtin baselines, else the zero-terminated name of a baseline file as written by dyspoissometer_baseline_save(). A missing file, or one with the wrong DYSPOISSOMETER_BASELINE_MAGIC or DYSPOISSOMETER_BASELINE_VERSION, is treated as empty.
+
+Out:
+
+  Returns zero if the key was found, else one.
+
+  baseline_base->logfreedom is the memoized logfreedom if the return value is zero, else unchanged.
+*/
+/*
+The builtin baselines cover mask lists of (2^N) masks with a mask span of (2^N) or (2^16), for N on [8, 20] (or [8, 15] with DYSPOISSOMETER_NUMBER_FLOAT), computed from a random seed of one at the iteration_max values given by DYSPOISSOMETER_BASELINE_*_ITERATION_MAX.
+*/
+  static const dyspoissometer_baseline_t baseline_builtin_list_base[]={
+    {1.4110381249930954E+03, 0x3FFU, 0xFFU, 0xFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 0U},
+    {1.4127752513903820E+03, 0xFFFFFU, 0xFFU, 0xFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 0U},
+    {3.1837239214892534E+03, 0x3FFU, 0x1FFU, 0x1FFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 0U},
+    {3.1857634258394628E+03, 0xFFFFFU, 0x1FFU, 0x1FFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 0U},
+    {7.0855522634798581E+03, 0x3FFU, 0x3FFU, 0x3FFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 0U},
+    {7.0878668989797125E+03, 0xFFFFFU, 0x3FFU, 0x3FFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 0U},
+    {1.5601073305875858E+04, 0x3FFU, 0x7FFU, 0x7FFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 0U},
+    {1.5603343675183985E+04, 0xFFFFFU, 0x7FFU, 0x7FFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 0U},
+    {3.4053190802964869E+04, 0x3FFU, 0xFFFU, 0xFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 0U},
+    {3.4055828406579363E+04, 0xFFFFFU, 0xFFFU, 0xFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 0U},
+    {7.3798997001583601E+04, 0x3FFU, 0x1FFFU, 0x1FFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 0U},
+    {7.3801603801824516E+04, 0xFFFFFU, 0x1FFFU, 0x1FFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 0U},
+    {1.5897050344778071E+05, 0x3FFU, 0x3FFFU, 0x3FFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 0U},
+    {1.5897330459498172E+05, 0xFFFFFU, 0x3FFFU, 0x3FFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 0U},
+    {3.4067243835252814E+05, 0x3FFU, 0x7FFFU, 0x7FFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 0U},
+    {3.4067545056344580E+05, 0xFFFFFU, 0x7FFFU, 0x7FFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 0U},
+    {7.2679154448527377E+05, 0x3FFU, 0xFFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 0U},
+    {7.2679481852772343E+05, 0xFFFFFU, 0xFFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 0U},
+    {1.5444586760164283E+06, 0x3FFU, 0x1FFFFU, 0x1FFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 0U},
+    {1.5444619341029699E+06, 0xFFFFFU, 0x1FFFFU, 0x1FFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 0U},
+    {3.2706473329245760E+06, 0x3FFU, 0x3FFFFU, 0x3FFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 0U},
+    {3.2706509367558942E+06, 0xFFFFFU, 0x3FFFFU, 0x3FFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 0U},
+    {6.9047319873087630E+06, 0x3FFU, 0x7FFFFU, 0x7FFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 0U},
+    {6.9047356944778105E+06, 0xFFFFFU, 0x7FFFFU, 0x7FFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 0U},
+    {1.4536312602111576E+07, 0x3FFU, 0xFFFFFU, 0xFFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 0U},
+    {1.4536316472711703E+07, 0xFFFFFU, 0xFFFFFU, 0xFFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 0U},
+    {2.8386321562019898E+03, 0x3FFU, 0xFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 0U},
+    {2.8386321562019898E+03, 0xFFFFFU, 0xFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 0U},
+    {5.6769574378081543E+03, 0x3FFU, 0x1FFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 0U},
+    {5.6769594158959044E+03, 0xFFFFFU, 0x1FFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 0U},
+    {1.1354393196719153E+04, 0x3FFU, 0x3FFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 0U},
+    {1.1354540758791180E+04, 0xFFFFFU, 0x3FFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 0U},
+    {2.2709640478614856E+04, 0x3FFU, 0x7FFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 0U},
+    {2.2710113309792778E+04, 0xFFFFFU, 0x7FFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 0U},
+    {4.5420692671640500E+04, 0x3FFU, 0xFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 0U},
+    {4.5421440374876918E+04, 0xFFFFFU, 0xFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 0U},
+    {9.0844259232430995E+04, 0x3FFU, 0x1FFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 0U},
+    {9.0845343895591286E+04, 0xFFFFFU, 0x1FFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 0U},
+    {1.8169266812675860E+05, 0x3FFU, 0x3FFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 0U},
+    {1.8169424475731188E+05, 0xFFFFFU, 0x3FFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 0U},
+    {3.6339141555654514E+05, 0x3FFU, 0x7FFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 0U},
+    {3.6339354283053731E+05, 0xFFFFFU, 0x7FFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 0U},
+    {1.4535959099688616E+06, 0x3FFU, 0x1FFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 0U},
+    {1.4536006107952651E+06, 0xFFFFFU, 0x1FFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 0U},
+    {2.9072102415303723E+06, 0x3FFU, 0x3FFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 0U},
+    {2.9072172116201157E+06, 0xFFFFFU, 0x3FFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 0U},
+    {5.8144492745439019E+06, 0x3FFU, 0x7FFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 0U},
+    {5.8144601332996106E+06, 0xFFFFFU, 0x7FFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 0U},
+    {1.1628948375493111E+07, 0x3FFU, 0xFFFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 0U},
+    {1.1628964848820886E+07, 0xFFFFFU, 0xFFFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 0U},
+    {1.4110381249930952E+03, 0x3FFU, 0xFFU, 0xFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 1U},
+    {1.4127752513903820E+03, 0xFFFFFU, 0xFFU, 0xFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 1U},
+    {3.1837239214892543E+03, 0x3FFU, 0x1FFU, 0x1FFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 1U},
+    {3.1857634258394637E+03, 0xFFFFFU, 0x1FFU, 0x1FFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 1U},
+    {7.0855522634798599E+03, 0x3FFU, 0x3FFU, 0x3FFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 1U},
+    {7.0878668989797134E+03, 0xFFFFFU, 0x3FFU, 0x3FFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 1U},
+    {1.5601073305875861E+04, 0x3FFU, 0x7FFU, 0x7FFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 1U},
+    {1.5603343675183984E+04, 0xFFFFFU, 0x7FFU, 0x7FFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 1U},
+    {3.4053190802964877E+04, 0x3FFU, 0xFFFU, 0xFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 1U},
+    {3.4055828406579370E+04, 0xFFFFFU, 0xFFFU, 0xFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 1U},
+    {7.3798997001583601E+04, 0x3FFU, 0x1FFFU, 0x1FFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 1U},
+    {7.3801603801824531E+04, 0xFFFFFU, 0x1FFFU, 0x1FFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 1U},
+    {1.5897050344778073E+05, 0x3FFU, 0x3FFFU, 0x3FFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 1U},
+    {1.5897330459498169E+05, 0xFFFFFU, 0x3FFFU, 0x3FFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 1U},
+    {3.4067243835252838E+05, 0x3FFU, 0x7FFFU, 0x7FFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 1U},
+    {3.4067545056344592E+05, 0xFFFFFU, 0x7FFFU, 0x7FFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 1U},
+    {7.2679154448527412E+05, 0x3FFU, 0xFFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 1U},
+    {7.2679481852772366E+05, 0xFFFFFU, 0xFFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 1U},
+    {1.5444586760164280E+06, 0x3FFU, 0x1FFFFU, 0x1FFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 1U},
+    {1.5444619341029699E+06, 0xFFFFFU, 0x1FFFFU, 0x1FFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 1U},
+    {3.2706473329245746E+06, 0x3FFU, 0x3FFFFU, 0x3FFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 1U},
+    {3.2706509367558942E+06, 0xFFFFFU, 0x3FFFFU, 0x3FFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 1U},
+    {6.9047319873087611E+06, 0x3FFU, 0x7FFFFU, 0x7FFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 1U},
+    {6.9047356944778115E+06, 0xFFFFFU, 0x7FFFFU, 0x7FFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 1U},
+    {1.4536312602111582E+07, 0x3FFU, 0xFFFFFU, 0xFFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 1U},
+    {1.4536316472711708E+07, 0xFFFFFU, 0xFFFFFU, 0xFFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 1U},
+    {2.8386321562021039E+03, 0x3FFU, 0xFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 1U},
+    {2.8386321562021039E+03, 0xFFFFFU, 0xFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 1U},
+    {5.6769574378082762E+03, 0x3FFU, 0x1FFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 1U},
+    {5.6769594158958644E+03, 0xFFFFFU, 0x1FFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 1U},
+    {1.1354393196719117E+04, 0x3FFU, 0x3FFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 1U},
+    {1.1354540758791263E+04, 0xFFFFFU, 0x3FFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 1U},
+    {2.2709640478614951E+04, 0x3FFU, 0x7FFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 1U},
+    {2.2710113309792825E+04, 0xFFFFFU, 0x7FFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 1U},
+    {4.5420692671640543E+04, 0x3FFU, 0xFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 1U},
+    {4.5421440374877071E+04, 0xFFFFFU, 0xFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 1U},
+    {9.0844259232431185E+04, 0x3FFU, 0x1FFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 1U},
+    {9.0845343895591330E+04, 0xFFFFFU, 0x1FFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 1U},
+    {1.8169266812675865E+05, 0x3FFU, 0x3FFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 1U},
+    {1.8169424475731206E+05, 0xFFFFFU, 0x3FFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 1U},
+    {3.6339141555654525E+05, 0x3FFU, 0x7FFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 1U},
+    {3.6339354283053748E+05, 0xFFFFFU, 0x7FFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 1U},
+    {1.4535959099688614E+06, 0x3FFU, 0x1FFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 1U},
+    {1.4536006107952653E+06, 0xFFFFFU, 0x1FFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 1U},
+    {2.9072102415303728E+06, 0x3FFU, 0x3FFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 1U},
+    {2.9072172116201152E+06, 0xFFFFFU, 0x3FFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 1U},
+    {5.8144492745439010E+06, 0x3FFU, 0x7FFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 1U},
+    {5.8144601332996106E+06, 0xFFFFFU, 0x7FFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 1U},
+    {1.1628948375493117E+07, 0x3FFU, 0xFFFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 1U},
+    {1.1628964848758884E+07, 0xFFFFFU, 0xFFFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 1U},
+    {1.4110382080078125E+03, 0x3FFU, 0xFFU, 0xFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 2U},
+    {1.4127752685546875E+03, 0xFFFFFU, 0xFFU, 0xFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 2U},
+    {3.1837241210937500E+03, 0x3FFU, 0x1FFU, 0x1FFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 2U},
+    {3.1857631835937500E+03, 0xFFFFFU, 0x1FFU, 0x1FFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 2U},
+    {7.0855517578125000E+03, 0x3FFU, 0x3FFU, 0x3FFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 2U},
+    {7.0878666992187500E+03, 0xFFFFFU, 0x3FFU, 0x3FFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 2U},
+    {1.5601074218750000E+04, 0x3FFU, 0x7FFU, 0x7FFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 2U},
+    {1.5603342773437500E+04, 0xFFFFFU, 0x7FFU, 0x7FFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 2U},
+    {3.4053187500000000E+04, 0x3FFU, 0xFFFU, 0xFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 2U},
+    {3.4055824218750000E+04, 0xFFFFFU, 0xFFFU, 0xFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 2U},
+    {7.3798992187500000E+04, 0x3FFU, 0x1FFFU, 0x1FFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 2U},
+    {7.3801609375000000E+04, 0xFFFFFU, 0x1FFFU, 0x1FFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 2U},
+    {1.5897053125000000E+05, 0x3FFU, 0x3FFFU, 0x3FFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 2U},
+    {1.5897331250000000E+05, 0xFFFFFU, 0x3FFFU, 0x3FFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 2U},
+    {3.4067234375000000E+05, 0x3FFU, 0x7FFFU, 0x7FFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 2U},
+    {3.4067534375000000E+05, 0xFFFFFU, 0x7FFFU, 0x7FFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 2U},
+    {2.8386250000000000E+03, 0x3FFU, 0xFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 2U},
+    {2.8386250000000000E+03, 0xFFFFFU, 0xFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 2U},
+    {5.6770000000000000E+03, 0x3FFU, 0x1FFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 2U},
+    {5.6769765625000000E+03, 0xFFFFFU, 0x1FFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 2U},
+    {1.1354375000000000E+04, 0x3FFU, 0x3FFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 2U},
+    {1.1354489257812500E+04, 0xFFFFFU, 0x3FFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 2U},
+    {2.2709625000000000E+04, 0x3FFU, 0x7FFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 2U},
+    {2.2710156250000000E+04, 0xFFFFFU, 0x7FFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 2U},
+    {4.5420625000000000E+04, 0x3FFU, 0xFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 2U},
+    {4.5421433593750000E+04, 0xFFFFFU, 0xFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 2U},
+    {9.0844250000000000E+04, 0x3FFU, 0x1FFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 2U},
+    {9.0845382812500000E+04, 0xFFFFFU, 0x1FFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 2U},
+    {1.8169278125000000E+05, 0x3FFU, 0x3FFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 2U},
+    {1.8169434375000000E+05, 0xFFFFFU, 0x3FFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 2U},
+    {3.6339137500000000E+05, 0x3FFU, 0x7FFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 2U},
+    {3.6339346875000000E+05, 0xFFFFFU, 0x7FFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 2U},
+    {1.4110381249930952E+03, 0x3FFU, 0xFFU, 0xFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 3U},
+    {1.4127752513903820E+03, 0xFFFFFU, 0xFFU, 0xFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 3U},
+    {3.1837239214892543E+03, 0x3FFU, 0x1FFU, 0x1FFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 3U},
+    {3.1857634258394637E+03, 0xFFFFFU, 0x1FFU, 0x1FFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 3U},
+    {7.0855522634798599E+03, 0x3FFU, 0x3FFU, 0x3FFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 3U},
+    {7.0878668989797134E+03, 0xFFFFFU, 0x3FFU, 0x3FFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 3U},
+    {1.5601073305875861E+04, 0x3FFU, 0x7FFU, 0x7FFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 3U},
+    {1.5603343675183984E+04, 0xFFFFFU, 0x7FFU, 0x7FFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 3U},
+    {3.4053190802964877E+04, 0x3FFU, 0xFFFU, 0xFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 3U},
+    {3.4055828406579370E+04, 0xFFFFFU, 0xFFFU, 0xFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 3U},
+    {7.3798997001583601E+04, 0x3FFU, 0x1FFFU, 0x1FFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 3U},
+    {7.3801603801824531E+04, 0xFFFFFU, 0x1FFFU, 0x1FFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 3U},
+    {1.5897050344778073E+05, 0x3FFU, 0x3FFFU, 0x3FFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 3U},
+    {1.5897330459498169E+05, 0xFFFFFU, 0x3FFFU, 0x3FFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 3U},
+    {3.4067243835252838E+05, 0x3FFU, 0x7FFFU, 0x7FFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 3U},
+    {3.4067545056344592E+05, 0xFFFFFU, 0x7FFFU, 0x7FFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 3U},
+    {7.2679154448527412E+05, 0x3FFU, 0xFFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 3U},
+    {7.2679481852772366E+05, 0xFFFFFU, 0xFFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 3U},
+    {1.5444586760164280E+06, 0x3FFU, 0x1FFFFU, 0x1FFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 3U},
+    {1.5444619341029699E+06, 0xFFFFFU, 0x1FFFFU, 0x1FFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 3U},
+    {3.2706473329245746E+06, 0x3FFU, 0x3FFFFU, 0x3FFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 3U},
+    {3.2706509367558942E+06, 0xFFFFFU, 0x3FFFFU, 0x3FFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 3U},
+    {6.9047319873087611E+06, 0x3FFU, 0x7FFFFU, 0x7FFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 3U},
+    {6.9047356944778115E+06, 0xFFFFFU, 0x7FFFFU, 0x7FFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 3U},
+    {1.4536312602111582E+07, 0x3FFU, 0xFFFFFU, 0xFFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 3U},
+    {1.4536316472711708E+07, 0xFFFFFU, 0xFFFFFU, 0xFFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 3U},
+    {2.8386321562021039E+03, 0x3FFU, 0xFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 3U},
+    {2.8386321562021039E+03, 0xFFFFFU, 0xFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 3U},
+    {5.6769574378082762E+03, 0x3FFU, 0x1FFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 3U},
+    {5.6769594158958644E+03, 0xFFFFFU, 0x1FFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 3U},
+    {1.1354393196719117E+04, 0x3FFU, 0x3FFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 3U},
+    {1.1354540758791263E+04, 0xFFFFFU, 0x3FFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 3U},
+    {2.2709640478614951E+04, 0x3FFU, 0x7FFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 3U},
+    {2.2710113309792825E+04, 0xFFFFFU, 0x7FFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 3U},
+    {4.5420692671640543E+04, 0x3FFU, 0xFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 3U},
+    {4.5421440374877071E+04, 0xFFFFFU, 0xFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 3U},
+    {9.0844259232431185E+04, 0x3FFU, 0x1FFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 3U},
+    {9.0845343895591330E+04, 0xFFFFFU, 0x1FFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 3U},
+    {1.8169266812675865E+05, 0x3FFU, 0x3FFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 3U},
+    {1.8169424475731206E+05, 0xFFFFFU, 0x3FFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 3U},
+    {3.6339141555654525E+05, 0x3FFU, 0x7FFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 3U},
+    {3.6339354283053748E+05, 0xFFFFFU, 0x7FFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 3U},
+    {1.4535959099688614E+06, 0x3FFU, 0x1FFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 3U},
+    {1.4536006107952653E+06, 0xFFFFFU, 0x1FFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 3U},
+    {2.9072102415303728E+06, 0x3FFU, 0x3FFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 3U},
+    {2.9072172116201152E+06, 0xFFFFFU, 0x3FFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 3U},
+    {5.8144492745439010E+06, 0x3FFU, 0x7FFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 3U},
+    {5.8144601332996106E+06, 0xFFFFFU, 0x7FFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 3U},
+    {1.1628948375493117E+07, 0x3FFU, 0xFFFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MEDIAN, 3U},
+    {1.1628964848758884E+07, 0xFFFFFU, 0xFFFFFU, 0xFFFFU, DYSPOISSOMETER_BASELINE_KIND_MAX, 3U},
+  };
+  dyspoissometer_baseline_t baseline;
+  u64 baseline_idx;
+  u64 baseline_idx_max;
+  FILE *handle;
+  u64 header_list_base[2];
+  u8 record_base[DYSPOISSOMETER_BASELINE_RECORD_SIZE];
+  u8 status;
+
+  status=1;
+  baseline_idx=0;
+  baseline_idx_max=(u64)((sizeof(baseline_builtin_list_base)/sizeof(dyspoissometer_baseline_t))-1);
+  do{
+    baseline=baseline_builtin_list_base[baseline_idx];
+    status=dyspoissometer_baseline_compare(&baseline, baseline_base);
+  }while(status&&((baseline_idx++)!=baseline_idx_max));
+  if(status&&filename_base){
+    handle=fopen(filename_base, "rb");
+    if(handle){
+      if((fread(header_list_base, (size_t)(U64_SIZE), (size_t)(2), handle)==2)&&(header_list_base[0]==DYSPOISSOMETER_BASELINE_MAGIC)&&(header_list_base[1]==DYSPOISSOMETER_BASELINE_VERSION)){
+        do{
+          if(fread(record_base, (size_t)(DYSPOISSOMETER_BASELINE_RECORD_SIZE), (size_t)(1), handle)!=1){
+            break;
+          }
+          dyspoissometer_baseline_unpack(&baseline, record_base);
+          status=dyspoissometer_baseline_compare(&baseline, baseline_base);
+        }while(status);
+      }
+      fclose(handle);
+    }
   }
-  return density;
+  if(!status){
+    baseline_base->logfreedom=baseline.logfreedom;
+  }
+  return status;
 }
 
-DYSPOISSOMETER_NUMBER
-dyspoissometer_kernel_skew_get(DYSPOISSOMETER_NUMBER kernel_density, DYSPOISSOMETER_NUMBER kernel_density_expected){
+u8
+dyspoissometer_baseline_save(dyspoissometer_baseline_t *baseline_base, char *filename_base){
 /*
-Given the kernel size of a mask list and the statistical expectation thereof, compute kernel skew.
-
-See also: http://cognomicon.blogspot.com/2016/05/kernel-skew-normalized-randomness-metric.html .
+Append a baseline to a baseline file, creating the file if it doesn't exist.
 
 In:
 
-  kernel_density is the return value of dyspoissometer_kernel_density_get().
+  *baseline_base is the baseline to save.
 
-  kernel_density_expected is the corresponding return value of dyspoissometer_kernel_density_expected_fast_get() or dyspoissometer_kernel_density_expected_slow_get().
+  filename_base is the zero-terminated name of the baseline file.
 
 Out:
 
-  Returns the kernel skew corresponding to the input parameters, guaranteed to be on [0.0, 1.0].
+  Returns one if the file could not be created, had the wrong DYSPOISSOMETER_BASELINE_MAGIC or DYSPOISSOMETER_BASELINE_VERSION, or could not be written; else zero.
 */
-  DYSPOISSOMETER_NUMBER skew;
+  FILE *handle;
+  u64 header_list_base[2];
+  size_t header_u64_count;
+  u8 record_base[DYSPOISSOMETER_BASELINE_RECORD_SIZE];
+  u8 status;
 
-  skew=0.5f;
-  if(kernel_density<=kernel_density_expected){
-    skew*=kernel_density/kernel_density_expected;
-  }else{
-    skew*=2.0f-(kernel_density_expected/kernel_density);
-  }
-/*
-Do some CYA for horrendous precision problems (and negative zero baloney) that shoudn't happen (but who knows, with C).
-*/
-  if(skew<=0.0f){
-    skew=0.0f;
-  }else if(1.0f<skew){
-    skew=1.0f;
+  status=1;
+  handle=fopen(filename_base, "a+b");
+  if(handle){
+    status=!!fseek(handle, 0, SEEK_SET);
+    if(!status){
+      header_u64_count=fread(header_list_base, (size_t)(U64_SIZE), (size_t)(2), handle);
+      status=!!fseek(handle, 0, SEEK_END);
+      if(!header_u64_count){
+        header_list_base[0]=DYSPOISSOMETER_BASELINE_MAGIC;
+        header_list_base[1]=DYSPOISSOMETER_BASELINE_VERSION;
+        status=(u8)(status|(fwrite(header_list_base, (size_t)(U64_SIZE), (size_t)(2), handle)!=2));
+      }else{
+        status=(u8)(status|(header_u64_count!=2)|(header_list_base[0]!=DYSPOISSOMETER_BASELINE_MAGIC)|(header_list_base[1]!=DYSPOISSOMETER_BASELINE_VERSION));
+      }
+      if(!status){
+        dyspoissometer_baseline_pack(baseline_base, record_base);
+        status=(fwrite(record_base, (size_t)(DYSPOISSOMETER_BASELINE_RECORD_SIZE), (size_t)(1), handle)!=1);
+      }
+    }
+    status=(u8)(status|!!fclose(handle));
   }
-  return skew;
+  return status;
 }
 
 DYSPOISSOMETER_NUMBER
-dyspoissometer_mibr_expected_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_max){
+dyspoissometer_logfreedom_median_cached_get(char *filename_base, DYSPOISSOMETER_UINT iteration_max, DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_max, u64 *random_seed_base){
 /*
-Return the expected (average or mean) MIBR (EMIBR) for a given mask count and mask span.
-
-See also: http://dyspoissonism.blogspot.com/2016/06/mibr-randomness-metric-of-last-resort.html .
+Memoize dyspoissometer_logfreedom_median_get() using the builtin baselines and a baseline file.
 
 In:
 
-  mask_idx_max is as defined in dyspoissometer_mibr_get().
+  filename_base is as defined in dyspoissometer_baseline_find():In.
 
-  mask_max is as defined in dyspoissometer_mibr_get().
+  iteration_max is as defined in dyspoissometer_logfreedom_median_get():In.
 
-Out:
+  mask_idx_max is as defined in dyspoissometer_logfreedom_median_get():In.
 
-  Returns the EMIBR.
+  mask_max is as defined in dyspoissometer_logfreedom_median_get():In.
 
-  Queries with large input values may take a long time. In such cases, and if and only if (mask_idx_max==max_max), the following approximation of EMIBR, appears to be accurate to within one unit, although it is not used by this function:
+  *random_seed_base is as defined in dyspoissometer_logfreedom_median_get():In.
 
-  E=(((mask_max+1)*(pi/2))^0.5)-(4/3)
+Out:
 
-  Note also that EMIBR is close to ((mask_max+1)*S0), where S0 is the expected kernel density. Their asymptotic ratio appears to be one.
+  Returns as defined in dyspoissometer_logfreedom_median_get():Out. If the result was memoized, then it's returned immediately, with only the precision of a double. Otherwise it's computed and, on success, appended to the baseline file (if filename_base is not NULL) on a best effort basis.
+
+  *random_seed_base is unchanged if the result was memoized, else as defined in dyspoissometer_logfreedom_median_get():Out.
 */
-  DYSPOISSOMETER_NUMBER mask_span;
-  DYSPOISSOMETER_NUMBER mask_span_recip;
-  DYSPOISSOMETER_UINT mibr;
-  DYSPOISSOMETER_NUMBER mibr_expected;
-  DYSPOISSOMETER_NUMBER mibr_expected_old;
-  DYSPOISSOMETER_UINT mibr_max;
-  DYSPOISSOMETER_NUMBER weight;
-  DYSPOISSOMETER_NUMBER weight_partial;
-  DYSPOISSOMETER_NUMBER weight_sum;
+  dyspoissometer_baseline_t baseline;
+  DYSPOISSOMETER_NUMBER logfreedom;
 
-  mibr_expected=0.0f;
-  if(mask_idx_max&&mask_max){
-    mask_span=(DYSPOISSOMETER_NUMBER)(mask_max)+1.0f;
-    mask_span_recip=1.0f/mask_span;
-    mibr=1;
-    mibr_max=MIN(mask_idx_max, mask_max);
-    weight_partial=mask_max*mask_span_recip*mask_span_recip;
-    weight_sum=mask_span_recip;
-    do{
-      mibr_expected_old=mibr_expected;
-      weight=((DYSPOISSOMETER_NUMBER)(mibr)+1.0f)*weight_partial;
-      mibr_expected+=mibr*weight;
-      weight_sum+=weight;
-      weight_partial*=(DYSPOISSOMETER_NUMBER)(mask_max-mibr)*mask_span_recip;
-    }while((mibr_expected!=mibr_expected_old)&&((mibr++)!=mibr_max));
-    mibr_expected+=mibr_max*(1.0f-weight_sum);
-    if(mibr_expected<=0.0f){
-      mibr_expected=0.0f;
-    }else if(mibr_max<mibr_expected){
-      mibr_expected=mibr_max;
+  baseline.iteration_max=iteration_max;
+  baseline.kind=DYSPOISSOMETER_BASELINE_KIND_MEDIAN;
+  baseline.mask_idx_max=mask_idx_max;
+  baseline.mask_max=mask_max;
+  baseline.precision=DYSPOISSOMETER_NUMBER_PRECISION;
+  if(!dyspoissometer_baseline_find(&baseline, filename_base)){
+    logfreedom=(DYSPOISSOMETER_NUMBER)(baseline.logfreedom);
+  }else{
+    logfreedom=dyspoissometer_logfreedom_median_get(iteration_max, mask_idx_max, mask_max, random_seed_base);
+    if(filename_base&&(0.0f<=logfreedom)){
+      baseline.logfreedom=(double)(logfreedom);
+      dyspoissometer_baseline_save(&baseline, filename_base);
     }
   }
-  return mibr_expected;
+  return logfreedom;
 }
 
-void
-dyspoissometer_uint_idx_list_sort(DYSPOISSOMETER_UINT *idx_list_base0, DYSPOISSOMETER_UINT *idx_list_base1, DYSPOISSOMETER_UINT uint_idx_max, DYSPOISSOMETER_UINT *uint_list_base0, DYSPOISSOMETER_UINT *uint_list_base1){
+DYSPOISSOMETER_NUMBER
+dyspoissometer_logfreedom_max_cached_get(char *filename_base, u64 iteration_max, DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_max, u64 *random_seed_base){
 /*
-Sort a list of (DYSPOISSOMETER_UINT)s ascending as though they were unsigned integers equal to their implementation-specific representations, using double buffering for speed. Perform the same permutation on their corresponding indexes. This is designed to permit sorting a list of variably sized strings via a list of scalars. Objects of equal value will remain in their original order regardless of sort direction.
+Memoize dyspoissometer_logfreedom_max_get() using the builtin baselines and a baseline file.
 
 In:
 
-  *idx_list_base0 contains (uint_idx_max+1) items, each corresponding to the respective DYSPOISSOMETER_UINT at uint_list_base0. For example, they might be the base indexes of strings whose hashes are at *uint_list_base0.
+  filename_base is as defined in dyspoissometer_baseline_find():In.
 
-  *idx_list_base1 is undefined and writable for (uint_idx_max+1) items.
+  iteration_max is as defined in dyspoissometer_logfreedom_max_get():In.
 
-  uint_idx_max is one less than the number of items in each list.
+  mask_idx_max is as defined in dyspoissometer_logfreedom_max_get():In.
 
-  *uint_list_base0 contains (uint_idx_max+1) items to sort.
+  mask_max is as defined in dyspoissometer_logfreedom_max_get():In.
 
-  *uint_list_base1 is undefined and writable for (uint_idx_max+1) items.
+  *random_seed_base is as defined in dyspoissometer_logfreedom_max_get():In.
 
 Out:
 
-  *idx_list_base0 is reordered according to the permutation of *uint_list_base0 relative to its input state.
+  Returns as defined in dyspoissometer_logfreedom_max_get():Out, subject to the same memoization caveats as dyspoissometer_logfreedom_median_cached_get():Out.
 
-  *idx_list_base1 is undefined. 
+  *random_seed_base is unchanged if the result was memoized, else as defined in dyspoissometer_logfreedom_max_get():Out.
+*/
+  dyspoissometer_baseline_t baseline;
+  DYSPOISSOMETER_NUMBER logfreedom;
 
-  *uint_list_base0 is sorted ascending.
+  baseline.iteration_max=iteration_max;
+  baseline.kind=DYSPOISSOMETER_BASELINE_KIND_MAX;
+  baseline.mask_idx_max=mask_idx_max;
+  baseline.mask_max=mask_max;
+  baseline.precision=DYSPOISSOMETER_NUMBER_PRECISION;
+  if(!dyspoissometer_baseline_find(&baseline, filename_base)){
+    logfreedom=(DYSPOISSOMETER_NUMBER)(baseline.logfreedom);
+  }else{
+    logfreedom=dyspoissometer_logfreedom_max_get(iteration_max, mask_idx_max, mask_max, random_seed_base);
+    if(filename_base&&(0.0f<=logfreedom)){
+      baseline.logfreedom=(double)(logfreedom);
+      dyspoissometer_baseline_save(&baseline, filename_base);
+    }
+  }
+  return logfreedom;
+}
 
-  *uint_list_base1 is undefined. 
-*/
-  u8 continue_status;
-  DYSPOISSOMETER_UINT idx;
-  ULONG list_size;
-  DYSPOISSOMETER_UINT *idx_list_base2;
-  DYSPOISSOMETER_UINT uint;
-  DYSPOISSOMETER_UINT uint_idx_list_base[U8_SPAN];
-  DYSPOISSOMETER_UINT uint_idx0;
-  DYSPOISSOMETER_UINT uint_idx1;
-  DYSPOISSOMETER_UINT *uint_list_base2;
-  DYSPOISSOMETER_UINT uint_old;
-  DYSPOISSOMETER_UINT uint_u8;
-  DYSPOISSOMETER_UINT uint_u8_freq;
-  DYSPOISSOMETER_UINT uint_u8_idx;
-/*
-Perform a bytewise radix sort of *uint_list_base0.
-*/
-  uint_u8_idx=0;
-  do{
+u8
+dyspoissometer_window_init(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_max, dyspoissometer_window_t *window_base){
 /*
-*uint_idx_list_base will serve as a list of base indexes for all possible (u8)s. Zero it.
+Initialize a sliding window logfreedom tracker. It maintains the frequency and population lists of a mask list which changes by one mask at a time, along with its logfreedom, which it updates in constant time per change. This works because adding or removing a mask moves one frequency by one, which affects only 3 of the terms in the definition of logfreedom (4 while the mask count is changing). The caller owns the masks themselves, typically in a ring buffer, and reports each one entering or leaving the window.
+
+In:
+
+  mask_idx_max is the maximum number of masks which the window will contain, less one, on [0, DYSPOISSOMETER_UINT_MAX-1].
+
+  mask_max is the maximum possible mask, on [0, DYSPOISSOMETER_UINT_MAX-1].
+
+  *window_base is undefined.
+
+Out:
+
+  Returns one if we ran out of memory, else zero. In either case, *window_base must eventually be freed via dyspoissometer_window_free().
+
+  *window_base is ready for use by dyspoissometer_window_add(), and contains no masks.
 */
-    memset(uint_idx_list_base, 0, (size_t)(U8_SPAN*sizeof(DYSPOISSOMETER_UINT)));
-    continue_status=0;
+  DYSPOISSOMETER_UINT *freq_list_base;
+  DYSPOISSOMETER_UINT log_idx;
+  DYSPOISSOMETER_UINT log_idx_max;
+  u64 log_idx_max_u64;
+  DYSPOISSOMETER_NUMBER *log_list_base;
+  DYSPOISSOMETER_UINT *pop_list_base;
+  u8 status;
+
 /*
-Count u8 frequencies and save them to *uint_idx_list_base. Move backwards to maximize cache hits in most cases.
-*/
-    uint_idx0=uint_idx_max;
-    uint_old=uint_list_base0[uint_idx_max];
+Tabulate natural logs of integers up to the greater of the mask count and the mask span, subject to DYSPOISSOMETER_WINDOW_LOG_IDX_MAX, because LOG() is expensive. Those are the largest integers whose logs we will need.
+*/
+  log_idx_max_u64=(u64)(MAX(mask_idx_max, mask_max))+1;
+  log_idx_max_u64=MIN(log_idx_max_u64, DYSPOISSOMETER_WINDOW_LOG_IDX_MAX);
+  log_idx_max=(DYSPOISSOMETER_UINT)(log_idx_max_u64);
+  freq_list_base=dyspoissometer_uint_list_malloc_zero(mask_max);
+  log_list_base=dyspoissometer_number_list_malloc(log_idx_max);
+  pop_list_base=dyspoissometer_uint_list_malloc_zero((DYSPOISSOMETER_UINT)(mask_idx_max+1));
+  window_base->freq_list_base=freq_list_base;
+  window_base->freq_max=0;
+  window_base->log_idx_max=log_idx_max;
+  window_base->log_list_base=log_list_base;
+  window_base->logfreedom=0.0f;
+  window_base->mask_count=0;
+  window_base->mask_idx_max=mask_idx_max;
+  window_base->mask_max=mask_max;
+  window_base->pop_list_base=pop_list_base;
+  window_base->update_count=0;
+  status=!(freq_list_base&&log_list_base&&pop_list_base);
+  if(!status){
+    log_list_base[0]=0.0f;
+    log_idx=1;
     do{
-      uint=uint_list_base0[uint_idx0];
-      continue_status=(u8)(continue_status|(uint_old<uint));
-      uint_u8=((unsigned char *)(&uint))[uint_u8_idx];
-      uint_old=uint;
-      uint_idx_list_base[uint_u8]++;
-    }while(uint_idx0--);
-    if(continue_status){
-/*
-Convert uint_idx_list_base from a list of frequencies of (u8)s to a list of preceding cummulative sums of frequencies of (u8)s. This will tell us how to sort this particular u8 lane.
-*/
-      uint_u8=0;
-      uint_idx0=0;
-      do{
-        uint_u8_freq=uint_idx_list_base[uint_u8];
-        uint_idx_list_base[uint_u8]=uint_idx0;
-        uint_idx0=(DYSPOISSOMETER_UINT)(uint_idx0+uint_u8_freq);
-      }while((uint_u8++)!=U8_MAX);
+      log_list_base[log_idx]=LOG(log_idx);
+    }while((log_idx++)!=log_idx_max);
 /*
-Sort *idx_list_base1 and *uint_list_base1 ascending by the u8 lane designated by uint_u8_idx.
+Initially, all (mask_max+1) possible masks have frequency zero, and the logfreedom of an empty mask list is zero.
 */
-      uint_idx0=0;
-      do{
-        idx=idx_list_base0[uint_idx0];
-        uint=uint_list_base0[uint_idx0];
-        uint_u8=((unsigned char *)(&uint))[uint_u8_idx];
-        uint_idx1=uint_idx_list_base[uint_u8];
-        idx_list_base1[uint_idx1]=idx;
-        uint_list_base1[uint_idx1]=uint;
-        uint_idx1++;
-        uint_idx_list_base[uint_u8]=uint_idx1;
-      }while((uint_idx0++)!=uint_idx_max);
-    }
+    pop_list_base[0]=(DYSPOISSOMETER_UINT)(mask_max+1);
+  }
+  return status;
+}
+
+void
+dyspoissometer_window_free(dyspoissometer_window_t *window_base){
 /*
-Swap list bases in order to accomplish double buffering.
+Free all memory owned by a sliding window logfreedom tracker.
+
+In:
+
+  *window_base is as returned by dyspoissometer_window_init(), regardless of success.
+
+Out:
+
+  All lists owned by *window_base have been freed.
 */
-    idx_list_base2=idx_list_base0;
-    idx_list_base0=idx_list_base1;
-    idx_list_base1=idx_list_base2;
-    uint_list_base2=uint_list_base0;
-    uint_list_base0=uint_list_base1;
-    uint_list_base1=uint_list_base2;
+  dyspoissometer_free(window_base->pop_list_base);
+  dyspoissometer_free(window_base->log_list_base);
+  dyspoissometer_free(window_base->freq_list_base);
+  return;
+}
+
+DYSPOISSOMETER_NUMBER
+dyspoissometer_window_log_get(DYSPOISSOMETER_UINT log_idx_max, DYSPOISSOMETER_NUMBER *log_list_base, DYSPOISSOMETER_UINT n){
 /*
-continue_status should always be zero when the items have been sorted. However, due to floating-point undefinedness, it might be one even though the objects have actually been sorted when viewed as unsigned integers (which we could not have done because it would have been an aliasing violation, hence our use of (unsigned char *)).
+Get the natural log of a whole number on behalf of a sliding window logfreedom tracker.
+
+In:
+
+  log_idx_max is dyspoissometer_window_t.log_idx_max.
+
+  *log_list_base is dyspoissometer_window_t.log_list_base.
+
+  n is the whole number.
+
+Out:
+
+  Returns LOG(n), or zero if n is zero. If n exceeds log_idx_max, then the result is only accurate to double precision, because LOG() is very slow at quad precision and such large arguments can occur on every update, namely when a few masks dominate the window. The resulting error is purged on the next exact evaluation in dyspoissometer_window_logfreedom_get().
 */
-    uint_u8_idx++;
-  }while(continue_status&&(uint_u8_idx!=sizeof(DYSPOISSOMETER_UINT)));
-  if((uint_u8_idx&1)^(!continue_status)){
+  DYSPOISSOMETER_NUMBER log_n;
+
+  if(n<=log_idx_max){
+    log_n=log_list_base[n];
+  }else{
+    log_n=(DYSPOISSOMETER_NUMBER)(log((double)(n)));
+  }
+  return log_n;
+}
+
+void
+dyspoissometer_window_add(dyspoissometer_window_t *window_base, DYSPOISSOMETER_UINT mask){
 /*
-Copy the index and object lists back to what is, from the caller's perspective, idx_list_base0 and uint_list_base0, respectively.
+Add a mask to a sliding window logfreedom tracker.
+
+In:
+
+  *window_base is as returned by dyspoissometer_window_init() and contains at most window_base->mask_idx_max masks.
+
+  mask is the mask to add, on [0, window_base->mask_max].
+
+Out:
+
+  *window_base contains mask as well, with its logfreedom updated accordingly.
 */
-    list_size=(ULONG)(uint_idx_max);
-    list_size++;
-    list_size=(ULONG)(list_size*sizeof(DYSPOISSOMETER_UINT));
-    memcpy(idx_list_base0, idx_list_base1, (size_t)(list_size));
-    memcpy(uint_list_base0, uint_list_base1, (size_t)(list_size));
-  }
+  DYSPOISSOMETER_UINT freq;
+  DYSPOISSOMETER_UINT freq_plus_1;
+  DYSPOISSOMETER_UINT *freq_list_base;
+  DYSPOISSOMETER_UINT log_idx_max;
+  DYSPOISSOMETER_NUMBER *log_list_base;
+  DYSPOISSOMETER_NUMBER logfreedom;
+  DYSPOISSOMETER_UINT mask_count;
+  DYSPOISSOMETER_UINT pop0;
+  DYSPOISSOMETER_UINT pop1;
+  DYSPOISSOMETER_UINT *pop_list_base;
+
+  freq_list_base=window_base->freq_list_base;
+  log_idx_max=window_base->log_idx_max;
+  log_list_base=window_base->log_list_base;
+  logfreedom=window_base->logfreedom;
+  mask_count=(DYSPOISSOMETER_UINT)(window_base->mask_count+1);
+  pop_list_base=window_base->pop_list_base;
+  freq=freq_list_base[mask];
+  freq_plus_1=(DYSPOISSOMETER_UINT)(freq+1);
+  freq_list_base[mask]=freq_plus_1;
+  pop0=pop_list_base[freq];
+  pop1=(DYSPOISSOMETER_UINT)(pop_list_base[freq_plus_1]+1);
+  pop_list_base[freq]=(DYSPOISSOMETER_UINT)(pop0-1);
+  pop_list_base[freq_plus_1]=pop1;
+/*
+Moving one mask from frequency freq to freq_plus_1 changes LOG_SUM(H[freq]) by -LOG(H[freq]), LOG_SUM(H[freq_plus_1]) by LOG(H[freq_plus_1]), and the sum over all masks of LOG_SUM(frequency) by LOG(freq_plus_1). Here H[freq] is its value before the move, pop0, and H[freq_plus_1] is its value after the move, pop1. Logfreedom is LOG_SUM(Q)+LOG_SUM(Z), less the others. LOG_SUM(Q) changes as well, but window_base->logfreedom excludes it, so that sliding the window, which leaves Q unchanged, need not take its log twice.
+*/
+  logfreedom+=dyspoissometer_window_log_get(log_idx_max, log_list_base, pop0);
+  logfreedom-=dyspoissometer_window_log_get(log_idx_max, log_list_base, pop1);
+  logfreedom-=dyspoissometer_window_log_get(log_idx_max, log_list_base, freq_plus_1);
+  window_base->freq_max=MAX(window_base->freq_max, freq_plus_1);
+  window_base->logfreedom=logfreedom;
+  window_base->mask_count=mask_count;
+  window_base->update_count++;
   return;
 }
 
-u8
-dyspoissometer_mibr_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT *mask_list_base, DYSPOISSOMETER_UINT *mibr_base){
+void
+dyspoissometer_window_remove(dyspoissometer_window_t *window_base, DYSPOISSOMETER_UINT mask){
 /*
-Return the maximum index before repetition (MIBR) of a give mask list.
-
-See also: http://dyspoissonism.blogspot.com/2016/06/mibr-randomness-metric-of-last-resort.html .
+Remove a mask from a sliding window logfreedom tracker.
 
 In:
 
-  mask_idx_max is the number of masks in the list, less one, AKA (Q - 1).
+  *window_base is as returned by dyspoissometer_window_add() and contains mask.
 
-  mask_max is the maximum possible mask, AKA (Z - 1).
+  mask is the mask to remove.
 
 Out:
 
-  Returns zero on failure, else one.
-
-  *mibr_base is the MIBR.
+  *window_base no longer contains one instance of mask, and its logfreedom has been updated accordingly.
 */
-  DYSPOISSOMETER_UINT ibr;
-  DYSPOISSOMETER_UINT mask;
-  DYSPOISSOMETER_UINT mask_idx;
-  DYSPOISSOMETER_UINT *mask_idx_list0_base;
-  DYSPOISSOMETER_UINT *mask_idx_list1_base;
-  DYSPOISSOMETER_UINT *mask_list1_base;
-  DYSPOISSOMETER_UINT mask_old;
-  DYSPOISSOMETER_UINT mibr;
-  u8 status;
+  DYSPOISSOMETER_UINT freq;
+  DYSPOISSOMETER_UINT freq_minus_1;
+  DYSPOISSOMETER_UINT *freq_list_base;
+  DYSPOISSOMETER_UINT log_idx_max;
+  DYSPOISSOMETER_NUMBER *log_list_base;
+  DYSPOISSOMETER_NUMBER logfreedom;
+  DYSPOISSOMETER_UINT mask_count;
+  DYSPOISSOMETER_UINT pop0;
+  DYSPOISSOMETER_UINT pop1;
+  DYSPOISSOMETER_UINT *pop_list_base;
 
-  mask_idx_list0_base=dyspoissometer_uint_list_malloc(mask_idx_max);
-  mask_idx_list1_base=dyspoissometer_uint_list_malloc(mask_idx_max);
-  mask_list1_base=dyspoissometer_uint_list_malloc(mask_idx_max);
-  status=1;
-  if(mask_idx_list0_base&&mask_idx_list1_base&&mask_list1_base){
-    mask_idx=0;
-    do{
-      mask_idx_list0_base[mask_idx]=mask_idx;
-    }while((mask_idx++)!=mask_idx_max);
-    dyspoissometer_uint_idx_list_sort(mask_idx_list0_base, mask_idx_list1_base, mask_idx_max, mask_list_base, mask_list1_base);
-    mask_idx=0;
-    mibr=mask_idx_max;
-    if(mask_idx_max){
-      mask=mask_list_base[0];
-      mask_idx++;
-      do{
-        mask_old=mask;
-        mask=mask_list_base[mask_idx];
-        if(mask==mask_old){
-          ibr=(DYSPOISSOMETER_UINT)(mask_idx_list0_base[mask_idx]-1);
-          mibr=MIN(ibr, mibr);
-        }
-      }while((mask_idx++)!=mask_idx_max);
-    }
-    status=0;
-    *mibr_base=mibr;
+  freq_list_base=window_base->freq_list_base;
+  log_idx_max=window_base->log_idx_max;
+  log_list_base=window_base->log_list_base;
+  logfreedom=window_base->logfreedom;
+  mask_count=window_base->mask_count;
+  pop_list_base=window_base->pop_list_base;
+  freq=freq_list_base[mask];
+  freq_minus_1=(DYSPOISSOMETER_UINT)(freq-1);
+  freq_list_base[mask]=freq_minus_1;
+  pop0=(DYSPOISSOMETER_UINT)(pop_list_base[freq_minus_1]+1);
+  pop1=pop_list_base[freq];
+  pop_list_base[freq_minus_1]=pop0;
+  pop_list_base[freq]=(DYSPOISSOMETER_UINT)(pop1-1);
+/*
+This is the reverse of dyspoissometer_window_add(): LOG_SUM(H[freq_minus_1]) changes by LOG(H[freq_minus_1]) and LOG_SUM(H[freq]) by -LOG(H[freq]), where H[freq_minus_1] is its value after the move, pop0, and H[freq] is its value before the move, pop1. If freq was the maximum frequency and is now unpopulated, then the maximum frequency is now freq_minus_1, which is populated by mask.
+*/
+  logfreedom-=dyspoissometer_window_log_get(log_idx_max, log_list_base, pop0);
+  logfreedom+=dyspoissometer_window_log_get(log_idx_max, log_list_base, pop1);
+  logfreedom+=dyspoissometer_window_log_get(log_idx_max, log_list_base, freq);
+  if((freq==window_base->freq_max)&&(pop1==1)){
+    window_base->freq_max=freq_minus_1;
   }
-  dyspoissometer_free(mask_list1_base);
-  dyspoissometer_free(mask_idx_list1_base);
-  dyspoissometer_free(mask_idx_list0_base);
-  return status;
+  window_base->logfreedom=logfreedom;
+  window_base->mask_count=(DYSPOISSOMETER_UINT)(mask_count-1);
+  window_base->update_count++;
+  return;
 }
 
-DYSPOISSOMETER_NUMBER
-dyspoissometer_skew_from_mibr_get(DYSPOISSOMETER_UINT mask_max, DYSPOISSOMETER_UINT mibr){
+void
+dyspoissometer_window_slide(dyspoissometer_window_t *window_base, DYSPOISSOMETER_UINT mask_new, DYSPOISSOMETER_UINT mask_old){
 /*
-Return the skew (K) for a given mask span and MIBR.
-
-See also: http://dyspoissonism.blogspot.com/2016/06/mibr-randomness-metric-of-last-resort.html .
+Slide a window by one mask, i.e. replace one of its masks with another, keeping the mask count constant. This is equivalent to dyspoissometer_window_remove() followed by dyspoissometer_window_add(), but faster when the masks are equal, which is common with timedeltas.
 
 In:
 
-  mask_max is as defined in dyspoissometer_mibr_get().
+  *window_base is as returned by dyspoissometer_window_add() and contains mask_old.
 
-  mibr is the MIBR whose skew to evaluate, on [0, mask_max].
+  mask_new is the mask to add, on [0, window_base->mask_max].
+
+  mask_old is the mask to remove, typically the oldest one in the window.
 
 Out:
 
-  Returns the MIBR skew.
+  *window_base contains mask_new in place of one instance of mask_old.
 */
-  DYSPOISSOMETER_NUMBER skew;
-
-  skew=1.0f;
-  if(mask_max){
-    skew=EXP(LOG_SUM(mask_max)-LOG_SUM(mask_max-mibr)-(LOG_N_PLUS_1(mask_max)*mibr));
-    if(skew<=0.0f){
-      skew=0.0f;
-    }else if(1.0f<skew){
-      skew=1.0f;
-    }
+  if(mask_new!=mask_old){
+    dyspoissometer_window_remove(window_base, mask_old);
+    dyspoissometer_window_add(window_base, mask_new);
   }
-  return skew;
+  return;
 }
 
-DYSPOISSOMETER_UINT
-dyspoissometer_mibr_from_skew_get(DYSPOISSOMETER_UINT mask_max, DYSPOISSOMETER_NUMBER skew){
+DYSPOISSOMETER_NUMBER
+dyspoissometer_window_logfreedom_get(DYSPOISSOMETER_NUMBER *dyspoissonism_base, dyspoissometer_window_t *window_base){
 /*
-Return the maximum MIBR whose skew is at least skew, or mask_max if no such MIBR exists.
-
-See also: http://dyspoissonism.blogspot.com/2016/06/mibr-randomness-metric-of-last-resort.html .
+Get the logfreedom and dyspoissonism of the masks in a sliding window logfreedom tracker in constant time (amortized).
 
 In:
 
-  mask_max is as defined in dyspoissometer_mibr_get().
+  *dyspoissonism_base is undefined.
+
+  *window_base is as returned by dyspoissometer_window_init() or any function which modifies it.
 
 Out:
 
-  Returns the MIBR as specified in the summary.
+  Returns the logfreedom of the mask list in the window, guaranteed to be nonnegative.
+
+  *dyspoissonism_base is the corresponding dyspoissonism, or zero if the window is empty.
 */
-  DYSPOISSOMETER_UINT mibr;
-  DYSPOISSOMETER_UINT mibr_max;
-  DYSPOISSOMETER_UINT mibr_min;
-  DYSPOISSOMETER_NUMBER skew_mibr;
+  DYSPOISSOMETER_NUMBER dyspoissonism;
+  DYSPOISSOMETER_NUMBER logfreedom;
+  DYSPOISSOMETER_UINT mask_count;
 
-  mibr_max=mask_max;
-  if(mask_max){
-    mibr_min=0;
-    while(mibr_max!=mibr_min){
-      mibr=(DYSPOISSOMETER_UINT)(mibr_max-((mibr_max-mibr_min)>>1));
-      skew_mibr=dyspoissometer_skew_from_mibr_get(mask_max, mibr);
-      if(skew_mibr<skew){
-        mibr_max=(DYSPOISSOMETER_UINT)(mibr-1);
-      }else{
-        mibr_min=mibr;
-      }
+  dyspoissonism=0.0f;
+  logfreedom=0.0f;
+  mask_count=window_base->mask_count;
+  if(mask_count){
+/*
+window_base->logfreedom excludes LOG_SUM(Q), so add it back. Rounding error accumulates with every update. Once the number of updates since the last exact evaluation exceeds the window size, evaluate logfreedom from scratch. This costs time proportional to the maximum frequency, which is at most the window size, so it amortizes to a constant per update.
+*/
+    if(window_base->mask_idx_max<window_base->update_count){
+      logfreedom=dyspoissometer_logfreedom_dense_get((DYSPOISSOMETER_UINT)(window_base->freq_max-1), 0, (DYSPOISSOMETER_UINT)(mask_count-1), window_base->mask_max, window_base->pop_list_base);
+      window_base->logfreedom=logfreedom-LOG_SUM(mask_count);
+      window_base->update_count=0;
+    }else{
+      logfreedom=window_base->logfreedom+LOG_SUM(mask_count);
     }
+    logfreedom=MAX(logfreedom, 0.0f);
+    dyspoissonism=dyspoissometer_dyspoissonism_get(logfreedom, (DYSPOISSOMETER_UINT)(mask_count-1), window_base->mask_max);
   }
-  return mibr_max;
+  *dyspoissonism_base=dyspoissonism;
+  return logfreedom;
 }
@@ -23,9 +23,9 @@ License version 3 along with the Dyspoissometer Library (filename
 /*
 Dyspoissometer Constants
 */
-#if !(defined(DYSPOISSOMETER_NUMBER_QUAD)||defined(DYSPOISSOMETER_NUMBER_DOUBLE)||defined(DYSPOISSOMETER_NUMBER_FLOAT))
-  #error "You must select a numerical precision level. Use 'gcc -DDYSPOISSOMETER_NUMBER_QUAD', '-DDYSPOISSOMETER_NUMBER_DOUBLE', or 'DYSPOISSOMETER_NUMBER_FLOAT' for quad, double, or float floating precision, respectively. Quad, double, and float precision imply 64, 32, and 16 bits per integer, respectively."
-#elif (defined(DYSPOISSOMETER_NUMBER_QUAD)&&defined(DYSPOISSOMETER_NUMBER_DOUBLE))||(defined(DYSPOISSOMETER_NUMBER_QUAD)&&defined(DYSPOISSOMETER_NUMBER_FLOAT))||(defined(DYSPOISSOMETER_NUMBER_DOUBLE)&&defined(DYSPOISSOMETER_NUMBER_FLOAT))
+#if !(defined(DYSPOISSOMETER_NUMBER_QUAD)||defined(DYSPOISSOMETER_NUMBER_DD)||defined(DYSPOISSOMETER_NUMBER_DOUBLE)||defined(DYSPOISSOMETER_NUMBER_FLOAT))
+  #error "You must select a numerical precision level. Use 'gcc -DDYSPOISSOMETER_NUMBER_QUAD', '-DDYSPOISSOMETER_NUMBER_DD', '-DDYSPOISSOMETER_NUMBER_DOUBLE', or 'DYSPOISSOMETER_NUMBER_FLOAT' for quad, double-double, double, or float floating precision, respectively. Quad, double-double, double, and float precision imply 64, 32, 32, and 16 bits per integer, respectively."
+#elif (defined(DYSPOISSOMETER_NUMBER_QUAD)+defined(DYSPOISSOMETER_NUMBER_DD)+defined(DYSPOISSOMETER_NUMBER_DOUBLE)+defined(DYSPOISSOMETER_NUMBER_FLOAT))!=1
   #error "You have selected more than one numerical precision. Choose one only."
 #elif defined(DYSPOISSOMETER_NUMBER_QUAD)
   #define DYSPOISSOMETER_NUMBER __float128
@@ -52,7 +52,11 @@ LOG_SUM_N_PLUS_1() computes Σ(i = (1, n+1), ln i) in the same manner as LOG_SUM
   #define LOG_SUM_N_PLUS_1(n) lgammaq((__float128)(n)+2.0f)
   #define ROUND(n) roundq((__float128)(n))
   #define SQRT(n) sqrtq((__float128)(n))
-#elif defined(DYSPOISSOMETER_NUMBER_DOUBLE)
+  #define DYSPOISSOMETER_SQRT_HALF_PI 1.2533141373155002512078826424055226Q
+#elif defined(DYSPOISSOMETER_NUMBER_DD)||defined(DYSPOISSOMETER_NUMBER_DOUBLE)
+/*
+Double-double precision stores numbers as doubles, but computes logfreedom from frequency lists, and dyspoissonism therefrom, using double-double arithmetic with a mantissa of about 106 bits: dyspoissometer_dd_add() and friends, including the double-double counterparts of EXP(), LOG(), LOG_SUM(), and SQRT(), namely dyspoissometer_dd_exp(), dyspoissometer_dd_log(), dyspoissometer_dd_log_sum_get(), and dyspoissometer_dd_sqrt(). The result is then rounded once to double. Thus dyspoissometer_logfreedom_sparse_get() and dyspoissometer_u64_freq_list_logfreedom_get() are nearly as accurate as with DYSPOISSOMETER_NUMBER_QUAD, relative to the precision of a double, without the cost of software emulation of __float128. All other functions compute in ordinary double precision, so the macros below are those of the double build. (A double-double SQRT() of a double would gain nothing anyway, because sqrt() is correctly rounded.) Integers are 32 bits, as with double precision.
+*/
   #define DYSPOISSOMETER_NUMBER double
   #define DYSPOISSOMETER_NUMBER_SIZE 8U
   #define DYSPOISSOMETER_NUMBER_SIZE_LOG2 3U
@@ -71,6 +75,7 @@ LOG_SUM_N_PLUS_1() computes Σ(i = (1, n+1), ln i) in the same manner as LOG_SUM
   #define LOG_SUM_N_PLUS_1(n) lgamma((double)(n)+2.0f)
   #define ROUND(n) round((double)(n))
   #define SQRT(n) sqrt((double)(n))
+  #define DYSPOISSOMETER_SQRT_HALF_PI 1.2533141373155002512
 #else
   #define DYSPOISSOMETER_NUMBER float
   #define DYSPOISSOMETER_NUMBER_SIZE 4U
@@ -90,18 +95,268 @@ LOG_SUM_N_PLUS_1() computes Σ(i = (1, n+1), ln i) in the same manner as LOG_SUM
   #define LOG_SUM_N_PLUS_1(n) lgammaf((float)(n)+2.0f)
   #define ROUND(n) roundf((float)(n))
   #define SQRT(n) sqrtf((float)(n))
+  #define DYSPOISSOMETER_SQRT_HALF_PI 1.2533141373155002512f
+#endif
+/*
+DYSPOISSOMETER_NUMBER_PRECISION identifies the precision of this build with the corresponding DYSPOISSOMETER_PRECISION_* value in dyspoissometer_any.h. It keeps baselines computed by different builds apart; see dyspoissometer_baseline_t.
+*/
+#if defined(DYSPOISSOMETER_NUMBER_QUAD)
+  #define DYSPOISSOMETER_NUMBER_PRECISION 0U
+#elif defined(DYSPOISSOMETER_NUMBER_DOUBLE)
+  #define DYSPOISSOMETER_NUMBER_PRECISION 1U
+#elif defined(DYSPOISSOMETER_NUMBER_FLOAT)
+  #define DYSPOISSOMETER_NUMBER_PRECISION 2U
+#else
+  #define DYSPOISSOMETER_NUMBER_PRECISION 3U
+#endif
+/*
+DYSPOISSOMETER_NUMBER_KEY_* describe the order-preserving integer keys which dyspoissometer_number_list_sort() radix sorts in lieu of (DYSPOISSOMETER_NUMBER)s. A key consists of (DYSPOISSOMETER_NUMBER_KEY_WORD_IDX_MAX+1) little-endian words of DYSPOISSOMETER_NUMBER_KEY_WORD_BITS bits each, the last of which contains the sign bit, DYSPOISSOMETER_NUMBER_KEY_WORD_SIGN. Each word is split into DYSPOISSOMETER_NUMBER_KEY_WORD_DIGIT_COUNT digits of DYSPOISSOMETER_NUMBER_KEY_DIGIT_BITS bits (the most significant of which may be narrower). Compared to bytes, 11-bit digits need about (3/4) as many passes, while the histograms for a double still fit in a typical L1 data cache.
+*/
+#ifdef DYSPOISSOMETER_NUMBER_QUAD
+  #define DYSPOISSOMETER_NUMBER_KEY_WORD u64
+  #define DYSPOISSOMETER_NUMBER_KEY_WORD_BITS U64_BITS
+  #define DYSPOISSOMETER_NUMBER_KEY_WORD_IDX_MAX 1U
+  #define DYSPOISSOMETER_NUMBER_KEY_WORD_SIGN (1ULL<<U64_BIT_MAX)
+#elif defined(DYSPOISSOMETER_NUMBER_DD)||defined(DYSPOISSOMETER_NUMBER_DOUBLE)
+  #define DYSPOISSOMETER_NUMBER_KEY_WORD u64
+  #define DYSPOISSOMETER_NUMBER_KEY_WORD_BITS U64_BITS
+  #define DYSPOISSOMETER_NUMBER_KEY_WORD_IDX_MAX 0U
+  #define DYSPOISSOMETER_NUMBER_KEY_WORD_SIGN (1ULL<<U64_BIT_MAX)
+#else
+  #define DYSPOISSOMETER_NUMBER_KEY_WORD u32
+  #define DYSPOISSOMETER_NUMBER_KEY_WORD_BITS U32_BITS
+  #define DYSPOISSOMETER_NUMBER_KEY_WORD_IDX_MAX 0U
+  #define DYSPOISSOMETER_NUMBER_KEY_WORD_SIGN (1U<<U32_BIT_MAX)
 #endif
+#define DYSPOISSOMETER_NUMBER_KEY_DIGIT_BITS 11U
+#define DYSPOISSOMETER_NUMBER_KEY_DIGIT_MAX ((1U<<DYSPOISSOMETER_NUMBER_KEY_DIGIT_BITS)-1)
+#define DYSPOISSOMETER_NUMBER_KEY_DIGIT_SPAN (1U<<DYSPOISSOMETER_NUMBER_KEY_DIGIT_BITS)
+#define DYSPOISSOMETER_NUMBER_KEY_WORD_DIGIT_COUNT ((DYSPOISSOMETER_NUMBER_KEY_WORD_BITS+DYSPOISSOMETER_NUMBER_KEY_DIGIT_BITS-1)/DYSPOISSOMETER_NUMBER_KEY_DIGIT_BITS)
+#define DYSPOISSOMETER_NUMBER_KEY_DIGIT_COUNT (DYSPOISSOMETER_NUMBER_KEY_WORD_DIGIT_COUNT*(DYSPOISSOMETER_NUMBER_KEY_WORD_IDX_MAX+1))
+/*
+DYSPOISSOMETER_KERNEL_DENSITY_SERIES_MASK_COUNT_MIN is the minimum mask count at which dyspoissometer_kernel_density_expected_fast_get() uses an asymptotic series instead of direct summation. DYSPOISSOMETER_KERNEL_DENSITY_SERIES_TERM_IDX_MAX is the number of terms, less one, in each of the 2 parts of that series. Together, they keep the truncation error below the epsilon of quad precision.
+*/
+#define DYSPOISSOMETER_KERNEL_DENSITY_SERIES_MASK_COUNT_MIN 0x800U
+#define DYSPOISSOMETER_KERNEL_DENSITY_SERIES_TERM_IDX_MAX 9U
 /*
 DYSPOISSOMETER_MARSAGLIA_A is the largest A value which one can use with a 64-bit Marsaglia oscillator (for pseudorandom number generation) based on Sophie Germain primes. See the tables at https://en.wikipedia.org/wiki/Multiply-with-carry .
 */
 #define DYSPOISSOMETER_MARSAGLIA_A (U32_MAX-177U)
+/*
+DYSPOISSOMETER_MARSAGLIA_M is the prime modulus associated with DYSPOISSOMETER_MARSAGLIA_A. Stepping the oscillator is equivalent to multiplying its state by DYSPOISSOMETER_MARSAGLIA_A modulo DYSPOISSOMETER_MARSAGLIA_M, which is what makes jumping ahead possible.
+*/
+#define DYSPOISSOMETER_MARSAGLIA_M ((((u64)(DYSPOISSOMETER_MARSAGLIA_A))<<U32_BITS)-1U)
+/*
+DYSPOISSOMETER_MARSAGLIA_LANE_IDX_MAX is the number of independent oscillators, less one, which dyspoissometer_mask_list_pseudorandom_get() steps in lockstep in order to hide multiplication latency. DYSPOISSOMETER_MARSAGLIA_LANE_COUNT_LOG2 is its log2 after adding one. DYSPOISSOMETER_MARSAGLIA_LANE_MASK_COUNT_MIN is the minimum number of masks per lane which justifies the cost of jumping the lanes ahead.
+*/
+#define DYSPOISSOMETER_MARSAGLIA_LANE_COUNT_LOG2 3U
+#define DYSPOISSOMETER_MARSAGLIA_LANE_IDX_MAX ((1U<<DYSPOISSOMETER_MARSAGLIA_LANE_COUNT_LOG2)-1)
+#define DYSPOISSOMETER_MARSAGLIA_LANE_MASK_COUNT_MIN 0x40U
+/*
+DYSPOISSOMETER_CHAIN_EPOCH_ITERATION_COUNT is the number of iterations which each chain performs in dyspoissometer_logfreedom_max_parallel_get() before the best population list is shared among all chains. Smaller values waste time on thread management and reduce diversity among the chains; larger values waste time on chains which have wandered off into unproductive regions.
+*/
+#define DYSPOISSOMETER_CHAIN_EPOCH_ITERATION_COUNT 0x10000U
+/*
+dyspoissometer_chain_t is the state of a single instance of the gradient riding process used by dyspoissometer_logfreedom_max_get(), which allows that process to be suspended, resumed, and run in parallel. All population indexes are relative to freq_min for the current list, or freq_min_best for the best list. pop_idx_max and pop_idx_max_best are (freq_max-freq_min) and (freq_max_best-freq_min_best), respectively. iteration_count_minus_1 is only used to pass a parameter to dyspoissometer_chain_thread_run().
+*/
+TYPEDEF_START
+  DYSPOISSOMETER_NUMBER logfreedom_delta_sum;
+  u64 iteration;
+  u64 iteration_count_minus_1;
+  u64 iteration_last_change;
+  u64 marsaglia_p;
+  DYSPOISSOMETER_UINT *pop_list_base;
+  DYSPOISSOMETER_UINT *pop_list_best_base;
+  DYSPOISSOMETER_UINT freq_max;
+  DYSPOISSOMETER_UINT freq_max_best;
+  DYSPOISSOMETER_UINT freq_min;
+  DYSPOISSOMETER_UINT freq_min_best;
+  DYSPOISSOMETER_UINT mask_idx_max;
+  DYSPOISSOMETER_UINT mask_max;
+  DYSPOISSOMETER_UINT pop_idx_max;
+  DYSPOISSOMETER_UINT pop_idx_max_best;
+  DYSPOISSOMETER_UINT pop_nonzero_idx_max;
+  DYSPOISSOMETER_UINT pop_nonzero_idx_max_best;
+  DYSPOISSOMETER_UINT pop_nonzero_idx_min;
+  DYSPOISSOMETER_UINT pop_nonzero_idx_min_best;
+  DYSPOISSOMETER_UINT pop_nonzero_idx_span;
+  u8 overflow_status;
+TYPEDEF_END(dyspoissometer_chain_t)
+/*
+DYSPOISSOMETER_FREQ_SPARSE_SPAN_SHIFT determines when dyspoissometer_uint_list_logfreedom_get() counts frequencies by sorting instead of with a dense frequency list: this happens when (mask_max>>DYSPOISSOMETER_FREQ_SPARSE_SPAN_SHIFT) exceeds the mask count, less one.
+*/
+#define DYSPOISSOMETER_FREQ_SPARSE_SPAN_SHIFT 2U
+/*
+DYSPOISSOMETER_U24_BLOCK_IDX_MAX is the number of u24 masks, less one, which are unpacked to (u32)s at a time by dyspoissometer_u24_list_unpack() on behalf of the frequency and mean kernels. The unpacked block should fit comfortably in the L1 cache.
+*/
+#define DYSPOISSOMETER_U24_BLOCK_IDX_MAX 0x3FFU
+/*
+DYSPOISSOMETER_MOMENT_BLOCK_IDX_MAX is the number of masks, less one, which dyspoissometer_moment_accrue() unpacks into a local buffer at a time. The buffer must fit comfortably in the L1 cache, because it's read twice.
+*/
+#define DYSPOISSOMETER_MOMENT_BLOCK_IDX_MAX 0x3FFU
+/*
+DYSPOISSOMETER_MOMENT_THREAD_MASK_COUNT_MIN is the minimum number of masks per thread in dyspoissometer_uint_list_stats_get(). Below this, thread creation costs more than it saves.
+*/
+#define DYSPOISSOMETER_MOMENT_THREAD_MASK_COUNT_MIN 0x100000U
+/*
+dyspoissometer_moment_t is the state of a partial computation of the mean and central moment sums of a mask list, which allows parts of the list to be processed independently and then merged. m2, m3, and m4 are the sums of the 2nd, 3rd, and 4th powers, respectively, of the deviations of the masks from mean. The remaining fields describe the part of the list in question, as defined in dyspoissometer_uint_list_stats_get():In.
+*/
+TYPEDEF_START
+  DYSPOISSOMETER_NUMBER m2;
+  DYSPOISSOMETER_NUMBER m3;
+  DYSPOISSOMETER_NUMBER m4;
+  DYSPOISSOMETER_NUMBER mean;
+  u64 mask_count;
+  u16 *u16_list_base;
+  u8 *u24_list_base;
+  u32 *u32_list_base;
+  u8 *u8_list_base;
+  DYSPOISSOMETER_UINT mask_idx_max;
+  DYSPOISSOMETER_UINT mask_idx_min;
+  u8 sign_status;
+TYPEDEF_END(dyspoissometer_moment_t)
+/*
+DYSPOISSOMETER_REPORT_* are the metric flags for dyspoissometer_report_get().
+*/
+#define DYSPOISSOMETER_REPORT_DYSPOISSONISM (1U<<0)
+#define DYSPOISSOMETER_REPORT_KERNEL (1U<<1)
+#define DYSPOISSOMETER_REPORT_LOGFREEDOM (1U<<2)
+#define DYSPOISSOMETER_REPORT_MIBR (1U<<3)
+#define DYSPOISSOMETER_REPORT_STATS (1U<<4)
+#define DYSPOISSOMETER_REPORT_ALL ((DYSPOISSOMETER_REPORT_STATS<<1)-1)
+/*
+dyspoissometer_report_t is the output of dyspoissometer_report_get(). metric_status indicates which of the other fields are defined: dyspoissonism for DYSPOISSOMETER_REPORT_DYSPOISSONISM; kernel_density, kernel_density_expected, kernel_size, and kernel_skew for DYSPOISSOMETER_REPORT_KERNEL; logfreedom for DYSPOISSOMETER_REPORT_LOGFREEDOM; mibr and mibr_skew for DYSPOISSOMETER_REPORT_MIBR; and stat_kurtosis, stat_mean, stat_sigma, and stat_variance for DYSPOISSOMETER_REPORT_STATS.
+*/
+TYPEDEF_START
+  DYSPOISSOMETER_NUMBER dyspoissonism;
+  DYSPOISSOMETER_NUMBER kernel_density;
+  DYSPOISSOMETER_NUMBER kernel_density_expected;
+  DYSPOISSOMETER_NUMBER kernel_skew;
+  DYSPOISSOMETER_NUMBER logfreedom;
+  DYSPOISSOMETER_NUMBER mibr_skew;
+  DYSPOISSOMETER_NUMBER stat_kurtosis;
+  DYSPOISSOMETER_NUMBER stat_mean;
+  DYSPOISSOMETER_NUMBER stat_sigma;
+  DYSPOISSOMETER_NUMBER stat_variance;
+  DYSPOISSOMETER_UINT kernel_size;
+  DYSPOISSOMETER_UINT mibr;
+  u8 metric_status;
+TYPEDEF_END(dyspoissometer_report_t)
+/*
+DYSPOISSOMETER_BASELINE_KIND_* identify what a dyspoissometer_baseline_t describes: the result of dyspoissometer_logfreedom_median_get() or dyspoissometer_logfreedom_max_get(), respectively.
+*/
+#define DYSPOISSOMETER_BASELINE_KIND_MEDIAN 0U
+#define DYSPOISSOMETER_BASELINE_KIND_MAX 1U
+/*
+DYSPOISSOMETER_BASELINE_MAGIC and DYSPOISSOMETER_BASELINE_VERSION are the 2 (u64)s at the start of a baseline file, as written by dyspoissometer_baseline_save(). The former is "DYSPBASE" in little endian. The latter must change whenever dyspoissometer_baseline_t does. The rest of the file is a list of records of DYSPOISSOMETER_BASELINE_RECORD_SIZE bytes.
+*/
+#define DYSPOISSOMETER_BASELINE_MAGIC 0x4553414250535944ULL
+#define DYSPOISSOMETER_BASELINE_VERSION 1U
+/*
+DYSPOISSOMETER_BASELINE_RECORD_SIZE is the size of a record in a baseline file, as written by dyspoissometer_baseline_pack(). A record consists of the fields of a dyspoissometer_baseline_t in the order logfreedom, iteration_max, mask_idx_max, mask_max, kind, and precision, with no padding, in native byte order, so the file is only portable among machines of the same endianness.
+*/
+#define DYSPOISSOMETER_BASELINE_RECORD_SIZE ((U64_SIZE<<2)+2)
+/*
+DYSPOISSOMETER_BASELINE_MEDIAN_ITERATION_MAX and DYSPOISSOMETER_BASELINE_MAX_ITERATION_MAX are the iteration_max values at which dyspoissometer_baseline_find() has builtin baselines for the median and maximum logfreedom, respectively, all computed from a random seed of one.
+*/
+#define DYSPOISSOMETER_BASELINE_MEDIAN_ITERATION_MAX 0x3FFU
+#define DYSPOISSOMETER_BASELINE_MAX_ITERATION_MAX 0xFFFFFU
+/*
+dyspoissometer_baseline_t is a memoized median or maximum logfreedom. iteration_max, mask_idx_max, mask_max, kind (DYSPOISSOMETER_BASELINE_KIND_*), and precision (DYSPOISSOMETER_NUMBER_PRECISION of the build which computed it) form the key; logfreedom is the value. The random seed is not part of the key, so the value is whichever one was computed first.
+*/
+TYPEDEF_START
+  double logfreedom;
+  u64 iteration_max;
+  u64 mask_idx_max;
+  u64 mask_max;
+  u8 kind;
+  u8 precision;
+TYPEDEF_END(dyspoissometer_baseline_t)
+/*
+DYSPOISSOMETER_QUANTILE_LEVEL_COUNT is the number of compaction levels in a dyspoissometer_quantile_t, which is enough to absorb U64_MAX samples.
+*/
+#define DYSPOISSOMETER_QUANTILE_LEVEL_COUNT U64_BITS
+/*
+dyspoissometer_quantile_t is the state of a streaming quantile estimator; see dyspoissometer_quantile_init(). Bit N of level_status_mask is set if level_list_base_list[N] contains a sorted buffer, each item of which represents (1<<N) samples. Bit N of level_parity_mask determines whether the next merge at level N keeps even or odd items. rank_error_max is the sum of the weights of all merges so far.
+*/
+TYPEDEF_START
+  u64 level_parity_mask;
+  u64 level_status_mask;
+  u64 rank_error_max;
+  u64 sample_count;
+  DYSPOISSOMETER_NUMBER *carry_list_base;
+  DYSPOISSOMETER_NUMBER *input_list_base;
+  DYSPOISSOMETER_NUMBER *level_list_base_list[DYSPOISSOMETER_QUANTILE_LEVEL_COUNT];
+  DYSPOISSOMETER_NUMBER *scratch_list_base;
+  DYSPOISSOMETER_UINT buffer_idx_max;
+  DYSPOISSOMETER_UINT input_count;
+TYPEDEF_END(dyspoissometer_quantile_t)
+/*
+DYSPOISSOMETER_WINDOW_LOG_IDX_MAX is the largest integer whose natural log is tabulated by dyspoissometer_window_init(); logs of larger integers are computed on demand.
+*/
+#define DYSPOISSOMETER_WINDOW_LOG_IDX_MAX 0x1FFFFU
+/*
+dyspoissometer_window_t is the state of a sliding window logfreedom tracker; see dyspoissometer_window_init(). freq_list_base and pop_list_base are the frequency list of the (mask_count) masks in the window, and its population list (including the population of frequency zero). freq_max is the maximum frequency. logfreedom is the logfreedom of the window, less LOG_SUM(mask_count). It is maintained incrementally, so it accumulates rounding error until the next exact evaluation, which occurs once update_count exceeds mask_idx_max. log_list_base contains the natural logs of integers on [0, log_idx_max] (where LOG(0) is taken to be zero).
+*/
+TYPEDEF_START
+  DYSPOISSOMETER_NUMBER logfreedom;
+  u64 update_count;
+  DYSPOISSOMETER_UINT *freq_list_base;
+  DYSPOISSOMETER_NUMBER *log_list_base;
+  DYSPOISSOMETER_UINT *pop_list_base;
+  DYSPOISSOMETER_UINT freq_max;
+  DYSPOISSOMETER_UINT log_idx_max;
+  DYSPOISSOMETER_UINT mask_count;
+  DYSPOISSOMETER_UINT mask_idx_max;
+  DYSPOISSOMETER_UINT mask_max;
+TYPEDEF_END(dyspoissometer_window_t)
+/*
+DYSPOISSOMETER_FREQ_LANE_COUNT_LOG2 is log2 of the number of interleaved sub-histograms ("lanes") used by dyspoissometer_freq_list_accrue() when dyspoissometer_freq_list_lane_malloc_zero() deems them profitable. DYSPOISSOMETER_FREQ_LANE_IDX_MAX is the number of lanes, less one. DYSPOISSOMETER_FREQ_LANE_MASK_MAX is the maximum mask_max for which lanes will be used with bursty data, beyond which they would tend to thrash the cache. (With 16-bit integers, it's further limited so that the size of all lanes fits in a DYSPOISSOMETER_UINT.) DYSPOISSOMETER_FREQ_LANE_SIZE_MAX is the maximum size of all lanes, in bytes, for which lanes will be used with data which is not known to be bursty, which should be about the size of the L1 data cache.
+*/
+#define DYSPOISSOMETER_FREQ_LANE_COUNT_LOG2 2U
+#define DYSPOISSOMETER_FREQ_LANE_IDX_MAX ((1U<<DYSPOISSOMETER_FREQ_LANE_COUNT_LOG2)-1)
+#if DYSPOISSOMETER_UINT_BITS==16
+  #define DYSPOISSOMETER_FREQ_LANE_MASK_MAX 0x3FFEU
+#else
+  #define DYSPOISSOMETER_FREQ_LANE_MASK_MAX 0xFFFFU
+#endif
+#define DYSPOISSOMETER_FREQ_LANE_SIZE_MAX 0x8000U
+/*
+dyspoissometer_dd_t is a double-double number, the unevaluated sum of hi and lo, where (|lo|<=(ulp(hi)/2)). It's used by dyspoissometer_dd_*() regardless of precision, but is most important when DYSPOISSOMETER_NUMBER_DD is defined.
+*/
+TYPEDEF_START
+  double hi;
+  double lo;
+TYPEDEF_END(dyspoissometer_dd_t)
+/*
+DYSPOISSOMETER_DD_HALF_LOG_2PI_* and DYSPOISSOMETER_DD_LOG_2_* are the high and low parts of (ln(2*pi)/2) and (ln 2), respectively, as double-doubles.
+*/
+#define DYSPOISSOMETER_DD_HALF_LOG_2PI_HI 0.9189385332046728
+#define DYSPOISSOMETER_DD_HALF_LOG_2PI_LO (-3.8782941580672414e-17)
+#define DYSPOISSOMETER_DD_LOG_2_HI 0.6931471805599453
+#define DYSPOISSOMETER_DD_LOG_2_LO 2.3190468138462996e-17
+/*
+DYSPOISSOMETER_DD_LOG_SUM_STIRLING_MIN is the least n for which dyspoissometer_dd_log_sum_get() uses Stirling's series instead of taking the log of a directly computed factorial. It must not exceed 170, above which the factorial would overflow a double. At 100, the first omitted term of the series is less than 10^(-31).
+*/
+#define DYSPOISSOMETER_DD_LOG_SUM_STIRLING_MIN 100U
+/*
+dyspoissometer_uint_idx_record_t is a DYSPOISSOMETER_UINT packed together with its index, for sorting by dyspoissometer_uint_idx_list_record_sort().
+*/
+TYPEDEF_START
+  DYSPOISSOMETER_UINT idx;
+  DYSPOISSOMETER_UINT uint;
+TYPEDEF_END(dyspoissometer_uint_idx_record_t)
 #ifdef DYSPOISSOMETER_NUMBER_QUAD
   #define DEBUG_NUMBER(name_base, value) DEBUG_QUAD(name_base, value)
   #define DEBUG_NUMBER_LIST(context_string_base, quad_count, quad_list_base) DEBUG_QUAD_LIST(context_string_base, quad_count, quad_list_base)
-#elif defined(DYSPOISSOMETER_NUMBER_DOUBLE)
+#elif defined(DYSPOISSOMETER_NUMBER_DD)||defined(DYSPOISSOMETER_NUMBER_DOUBLE)
   #define DEBUG_NUMBER(name_base, value) DEBUG_DOUBLE(name_base, value)
   #define DEBUG_NUMBER_LIST(context_string_base, double_count, double_list_base) DEBUG_DOUBLE_LIST(context_string_base, double_count, double_list_base)
 #else
   #define DEBUG_NUMBER(name_base, value) DEBUG_FLOAT(name_base, value)
   #define DEBUG_NUMBER_LIST(context_string_base, float_count, float_list_base) DEBUG_FLOAT_LIST(context_string_base, float_count, float_list_base)
 #endif
+#include "dyspoissometer_proto.h"
+#ifdef DYSPOISSOMETER_PREFIX
+  #include "dyspoissometer_prefix.h"
+#endif
@@ -0,0 +1,245 @@
+/*
+Dyspoissometer
+Copyright 2016 Russell Leidich
+http://dyspoissonism.blogspot.com
+
+This collection of files constitutes the Dyspoissometer Library. (This is a
+library in the abstact sense; it's not intended to compile to a ".lib"
+file.)
+
+The Dyspoissometer Library is free software: you can redistribute it and/or
+modify it under the terms of the GNU Limited General Public License as
+published by the Free Software Foundation, version 3.
+
+The Dyspoissometer Library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+Limited General Public License version 3 for more details.
+
+You should have received a copy of the GNU Limited General Public
+License version 3 along with the Dyspoissometer Library (filename
+"COPYING"). If not, see http://www.gnu.org/licenses/ .
+*/
+/*
+Runtime precision selection for Dyspoissometer. This file is linked with 4 builds of dyspoissometer.c, all with DYSPOISSOMETER_PREFIX defined, and one each of DYSPOISSOMETER_NUMBER_QUAD, DYSPOISSOMETER_NUMBER_DOUBLE, DYSPOISSOMETER_NUMBER_FLOAT, and DYSPOISSOMETER_NUMBER_DD. (See "make dyspoissometer_any".) The functions herein select among them at runtime, taking integer arguments as (u64)s and returning (double)s, so that callers need not be compiled for any particular precision. Integer arguments which do not fit into the DYSPOISSOMETER_UINT of the selected precision cause an error return.
+*/
+#include "flag.h"
+#include "flag_dyspoissometer.h"
+#include <quadmath.h>
+#include <stdint.h>
+#include "constant.h"
+#include "dyspoissometer_any.h"
+#include "dyspoissometer_proto.h"
+#include "dyspoissometer_any_xtrn.h"
+/*
+The precision-specific functions we need, as renamed by dyspoissometer_prefix.h. We can't include dyspoissometer_xtrn.h for these because it would require all 4 precisions at once, so declare them through the same prototype macros which it uses.
+*/
+#define DYSPOISSOMETER_ANY_PROTOTYPE_LIST(prefix, number, uint) \
+  extern DYSPOISSOMETER_INIT_PROTOTYPE(prefix##init); \
+  extern DYSPOISSOMETER_U64_FREQ_LIST_LOGFREEDOM_GET_PROTOTYPE(prefix##u64_freq_list_logfreedom_get, number); \
+  extern DYSPOISSOMETER_LOGFREEDOM_MAX_GET_PROTOTYPE(prefix##logfreedom_max_get, number, uint); \
+  extern DYSPOISSOMETER_LOGFREEDOM_MEDIAN_GET_PROTOTYPE(prefix##logfreedom_median_get, number, uint);
+DYSPOISSOMETER_ANY_PROTOTYPE_LIST(dyspoissometer_quad_, __float128, u64)
+DYSPOISSOMETER_ANY_PROTOTYPE_LIST(dyspoissometer_double_, double, u32)
+DYSPOISSOMETER_ANY_PROTOTYPE_LIST(dyspoissometer_float_, float, u16)
+DYSPOISSOMETER_ANY_PROTOTYPE_LIST(dyspoissometer_double_double_, double, u32)
+
+u8
+dyspoissometer_any_init(u32 build_break_count, u32 build_feature_count){
+/*
+Verify that the source code is sufficiently updated, for all precisions.
+
+In:
+
+  build_break_count is as defined in dyspoissometer_init():In.
+
+  build_feature_count is as defined in dyspoissometer_init():In.
+
+Out:
+
+  Returns as defined in dyspoissometer_init():Out, except that failure of any precision counts as failure.
+*/
+  u8 status;
+
+  status=dyspoissometer_quad_init(build_break_count, build_feature_count);
+  status=(u8)(status|dyspoissometer_double_init(build_break_count, build_feature_count));
+  status=(u8)(status|dyspoissometer_float_init(build_break_count, build_feature_count));
+  status=(u8)(status|dyspoissometer_double_double_init(build_break_count, build_feature_count));
+  return status;
+}
+
+u64
+dyspoissometer_any_uint_max_get(u8 precision){
+/*
+Get the maximum value of DYSPOISSOMETER_UINT for a given precision, which is also the upper bound of integer arguments to other dyspoissometer_any_*() functions.
+
+In:
+
+  precision is DYSPOISSOMETER_PRECISION_QUAD, DYSPOISSOMETER_PRECISION_DOUBLE, DYSPOISSOMETER_PRECISION_FLOAT, or DYSPOISSOMETER_PRECISION_DD.
+
+Out:
+
+  Returns the maximum DYSPOISSOMETER_UINT for precision, or zero if precision is invalid.
+*/
+  u64 uint_max;
+
+  uint_max=0;
+  switch(precision){
+  case DYSPOISSOMETER_PRECISION_QUAD:
+    uint_max=U64_MAX;
+    break;
+  case DYSPOISSOMETER_PRECISION_DOUBLE:
+  case DYSPOISSOMETER_PRECISION_DD:
+    uint_max=U32_MAX;
+    break;
+  case DYSPOISSOMETER_PRECISION_FLOAT:
+    uint_max=U16_MAX;
+    break;
+  }
+  return uint_max;
+}
+
+double
+dyspoissometer_any_u64_freq_list_logfreedom_get(double *dyspoissonism_base, u64 *freq_list_base, u64 mask_max, u8 precision){
+/*
+Call dyspoissometer_u64_freq_list_logfreedom_get() at a given precision.
+
+In:
+
+  *dyspoissonism_base is undefined.
+
+  *freq_list_base is as defined in dyspoissometer_u64_freq_list_logfreedom_get():In.
+
+  mask_max is as defined in dyspoissometer_u64_freq_list_logfreedom_get():In.
+
+  precision is as defined in dyspoissometer_any_uint_max_get():In.
+
+Out:
+
+  Returns as defined in dyspoissometer_u64_freq_list_logfreedom_get():Out, converted to double. Negative if precision is invalid.
+
+  *dyspoissonism_base is as defined in dyspoissometer_u64_freq_list_logfreedom_get():Out, converted to double.
+*/
+  double dyspoissonism;
+  double dyspoissonism_double;
+  float dyspoissonism_float;
+  __float128 dyspoissonism_quad;
+  double logfreedom;
+
+  dyspoissonism=0.0f;
+  logfreedom=-1.0f;
+  switch(precision){
+  case DYSPOISSOMETER_PRECISION_QUAD:
+    logfreedom=(double)(dyspoissometer_quad_u64_freq_list_logfreedom_get(&dyspoissonism_quad, freq_list_base, mask_max));
+    dyspoissonism=(double)(dyspoissonism_quad);
+    break;
+  case DYSPOISSOMETER_PRECISION_DOUBLE:
+    logfreedom=dyspoissometer_double_u64_freq_list_logfreedom_get(&dyspoissonism_double, freq_list_base, mask_max);
+    dyspoissonism=dyspoissonism_double;
+    break;
+  case DYSPOISSOMETER_PRECISION_FLOAT:
+    logfreedom=(double)(dyspoissometer_float_u64_freq_list_logfreedom_get(&dyspoissonism_float, freq_list_base, mask_max));
+    dyspoissonism=(double)(dyspoissonism_float);
+    break;
+  case DYSPOISSOMETER_PRECISION_DD:
+    logfreedom=dyspoissometer_double_double_u64_freq_list_logfreedom_get(&dyspoissonism_double, freq_list_base, mask_max);
+    dyspoissonism=dyspoissonism_double;
+    break;
+  }
+  *dyspoissonism_base=dyspoissonism;
+  return logfreedom;
+}
+
+double
+dyspoissometer_any_logfreedom_max_get(u64 iteration_max, u64 mask_idx_max, u64 mask_max, u8 precision, u64 *random_seed_base){
+/*
+Call dyspoissometer_logfreedom_max_get() at a given precision.
+
+In:
+
+  iteration_max is as defined in dyspoissometer_logfreedom_max_get():In.
+
+  mask_idx_max is as defined in dyspoissometer_logfreedom_max_get():In, but limited by dyspoissometer_any_uint_max_get(precision).
+
+  mask_max is as defined in dyspoissometer_logfreedom_max_get():In, but limited by dyspoissometer_any_uint_max_get(precision).
+
+  precision is as defined in dyspoissometer_any_uint_max_get():In.
+
+  *random_seed_base is as defined in dyspoissometer_logfreedom_max_get():In.
+
+Out:
+
+  Returns as defined in dyspoissometer_logfreedom_max_get():Out, converted to double. Negative if precision is invalid or the integer arguments don't fit.
+
+  *random_seed_base is as defined in dyspoissometer_logfreedom_max_get():Out.
+*/
+  double logfreedom_max;
+  u64 uint_max;
+
+  logfreedom_max=-1.0f;
+  uint_max=dyspoissometer_any_uint_max_get(precision);
+  if((mask_idx_max<uint_max)&&(mask_max<=uint_max)){
+    switch(precision){
+    case DYSPOISSOMETER_PRECISION_QUAD:
+      logfreedom_max=(double)(dyspoissometer_quad_logfreedom_max_get(iteration_max, mask_idx_max, mask_max, random_seed_base));
+      break;
+    case DYSPOISSOMETER_PRECISION_DOUBLE:
+      logfreedom_max=dyspoissometer_double_logfreedom_max_get(iteration_max, (u32)(mask_idx_max), (u32)(mask_max), random_seed_base);
+      break;
+    case DYSPOISSOMETER_PRECISION_FLOAT:
+      logfreedom_max=(double)(dyspoissometer_float_logfreedom_max_get(iteration_max, (u16)(mask_idx_max), (u16)(mask_max), random_seed_base));
+      break;
+    case DYSPOISSOMETER_PRECISION_DD:
+      logfreedom_max=dyspoissometer_double_double_logfreedom_max_get(iteration_max, (u32)(mask_idx_max), (u32)(mask_max), random_seed_base);
+      break;
+    }
+  }
+  return logfreedom_max;
+}
+
+double
+dyspoissometer_any_logfreedom_median_get(u64 iteration_max, u64 mask_idx_max, u64 mask_max, u8 precision, u64 *random_seed_base){
+/*
+Call dyspoissometer_logfreedom_median_get() at a given precision.
+
+In:
+
+  iteration_max is as defined in dyspoissometer_logfreedom_median_get():In, but limited by dyspoissometer_any_uint_max_get(precision).
+
+  mask_idx_max is as defined in dyspoissometer_logfreedom_median_get():In, but limited by dyspoissometer_any_uint_max_get(precision).
+
+  mask_max is as defined in dyspoissometer_logfreedom_median_get():In, but limited by dyspoissometer_any_uint_max_get(precision).
+
+  precision is as defined in dyspoissometer_any_uint_max_get():In.
+
+  *random_seed_base is as defined in dyspoissometer_logfreedom_median_get():In.
+
+Out:
+
+  Returns as defined in dyspoissometer_logfreedom_median_get():Out, converted to double. Negative if precision is invalid or the integer arguments don't fit.
+
+  *random_seed_base is as defined in dyspoissometer_logfreedom_median_get():Out.
+*/
+  double median;
+  u64 uint_max;
+
+  median=-1.0f;
+  uint_max=dyspoissometer_any_uint_max_get(precision);
+  if((iteration_max<uint_max)&&(mask_idx_max<uint_max)&&(mask_max<=uint_max)){
+    switch(precision){
+    case DYSPOISSOMETER_PRECISION_QUAD:
+      median=(double)(dyspoissometer_quad_logfreedom_median_get(iteration_max, mask_idx_max, mask_max, random_seed_base));
+      break;
+    case DYSPOISSOMETER_PRECISION_DOUBLE:
+      median=dyspoissometer_double_logfreedom_median_get((u32)(iteration_max), (u32)(mask_idx_max), (u32)(mask_max), random_seed_base);
+      break;
+    case DYSPOISSOMETER_PRECISION_FLOAT:
+      median=(double)(dyspoissometer_float_logfreedom_median_get((u16)(iteration_max), (u16)(mask_idx_max), (u16)(mask_max), random_seed_base));
+      break;
+    case DYSPOISSOMETER_PRECISION_DD:
+      median=dyspoissometer_double_double_logfreedom_median_get((u32)(iteration_max), (u32)(mask_idx_max), (u32)(mask_max), random_seed_base);
+      break;
+    }
+  }
+  return median;
+}
@@ -0,0 +1,33 @@
+/*
+Dyspoissometer
+Copyright 2016 Russell Leidich
+http://dyspoissonism.blogspot.com
+
+This collection of files constitutes the Dyspoissometer Library. (This is a
+library in the abstact sense; it's not intended to compile to a ".lib"
+file.)
+
+The Dyspoissometer Library is free software: you can redistribute it and/or
+modify it under the terms of the GNU Limited General Public License as
+published by the Free Software Foundation, version 3.
+
+The Dyspoissometer Library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+Limited General Public License version 3 for more details.
+
+You should have received a copy of the GNU Limited General Public
+License version 3 along with the Dyspoissometer Library (filename
+"COPYING"). If not, see http://www.gnu.org/licenses/ .
+*/
+/*
+Dyspoissometer Runtime Precision Selection Constants
+*/
+/*
+DYSPOISSOMETER_PRECISION_* are the precision arguments to dyspoissometer_any_*() functions. Quad, double, float, and double-double precision correspond to builds of dyspoissometer.c with DYSPOISSOMETER_NUMBER_QUAD, DYSPOISSOMETER_NUMBER_DOUBLE, DYSPOISSOMETER_NUMBER_FLOAT, and DYSPOISSOMETER_NUMBER_DD, respectively, and therefore imply 64, 32, 16, and 32 bits per integer, respectively.
+*/
+#define DYSPOISSOMETER_PRECISION_QUAD 0U
+#define DYSPOISSOMETER_PRECISION_DOUBLE 1U
+#define DYSPOISSOMETER_PRECISION_FLOAT 2U
+#define DYSPOISSOMETER_PRECISION_DD 3U
+#define DYSPOISSOMETER_PRECISION_MAX 3U
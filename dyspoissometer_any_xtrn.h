@@ -0,0 +1,27 @@
+/*
+Dyspoissometer
+Copyright 2016 Russell Leidich
+http://dyspoissonism.blogspot.com
+
+This collection of files constitutes the Dyspoissometer Library. (This is a
+library in the abstact sense; it's not intended to compile to a ".lib"
+file.)
+
+The Dyspoissometer Library is free software: you can redistribute it and/or
+modify it under the terms of the GNU Limited General Public License as
+published by the Free Software Foundation, version 3.
+
+The Dyspoissometer Library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+Limited General Public License version 3 for more details.
+
+You should have received a copy of the GNU Limited General Public
+License version 3 along with the Dyspoissometer Library (filename
+"COPYING"). If not, see http://www.gnu.org/licenses/ .
+*/
+extern u8 dyspoissometer_any_init(u32 build_break_count, u32 build_feature_count);
+extern u64 dyspoissometer_any_uint_max_get(u8 precision);
+extern double dyspoissometer_any_u64_freq_list_logfreedom_get(double *dyspoissonism_base, u64 *freq_list_base, u64 mask_max, u8 precision);
+extern double dyspoissometer_any_logfreedom_max_get(u64 iteration_max, u64 mask_idx_max, u64 mask_max, u8 precision, u64 *random_seed_base);
+extern double dyspoissometer_any_logfreedom_median_get(u64 iteration_max, u64 mask_idx_max, u64 mask_max, u8 precision, u64 *random_seed_base);
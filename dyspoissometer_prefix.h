@@ -0,0 +1,145 @@
+/*
+Dyspoissometer
+Copyright 2016 Russell Leidich
+http://dyspoissonism.blogspot.com
+
+This collection of files constitutes the Dyspoissometer Library. (This is a
+library in the abstact sense; it's not intended to compile to a ".lib"
+file.)
+
+The Dyspoissometer Library is free software: you can redistribute it and/or
+modify it under the terms of the GNU Limited General Public License as
+published by the Free Software Foundation, version 3.
+
+The Dyspoissometer Library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+Limited General Public License version 3 for more details.
+
+You should have received a copy of the GNU Limited General Public
+License version 3 along with the Dyspoissometer Library (filename
+"COPYING"). If not, see http://www.gnu.org/licenses/ .
+*/
+/*
+When DYSPOISSOMETER_PREFIX is defined, every public Dyspoissometer function is renamed to include its precision, for example dyspoissometer_double_logfreedom_dense_get() instead of dyspoissometer_logfreedom_dense_get(). This allows all 4 precisions to be linked into the same executable, which is what dyspoissometer_any.c expects. This file must be included after the precision has been established, and before any function declarations. Every function added to dyspoissometer_xtrn.h must be added here as well.
+*/
+#ifdef DYSPOISSOMETER_NUMBER_QUAD
+  #define DYSPOISSOMETER_PREFIXED(name) dyspoissometer_quad_##name
+#elif defined(DYSPOISSOMETER_NUMBER_DD)
+  #define DYSPOISSOMETER_PREFIXED(name) dyspoissometer_double_double_##name
+#elif defined(DYSPOISSOMETER_NUMBER_DOUBLE)
+  #define DYSPOISSOMETER_PREFIXED(name) dyspoissometer_double_##name
+#else
+  #define DYSPOISSOMETER_PREFIXED(name) dyspoissometer_float_##name
+#endif
+#define dyspoissometer_init DYSPOISSOMETER_PREFIXED(init)
+#define dyspoissometer_free DYSPOISSOMETER_PREFIXED(free)
+#define dyspoissometer_number_list_malloc DYSPOISSOMETER_PREFIXED(number_list_malloc)
+#define dyspoissometer_uint_list_malloc DYSPOISSOMETER_PREFIXED(uint_list_malloc)
+#define dyspoissometer_uint_list_copy DYSPOISSOMETER_PREFIXED(uint_list_copy)
+#define dyspoissometer_uint_list_list_free DYSPOISSOMETER_PREFIXED(uint_list_list_free)
+#define dyspoissometer_uint_list_zero DYSPOISSOMETER_PREFIXED(uint_list_zero)
+#define dyspoissometer_uint_list_malloc_zero DYSPOISSOMETER_PREFIXED(uint_list_malloc_zero)
+#define dyspoissometer_uint_list_sort DYSPOISSOMETER_PREFIXED(uint_list_sort)
+#define dyspoissometer_dd_add DYSPOISSOMETER_PREFIXED(dd_add)
+#define dyspoissometer_dd_sub DYSPOISSOMETER_PREFIXED(dd_sub)
+#define dyspoissometer_dd_mul DYSPOISSOMETER_PREFIXED(dd_mul)
+#define dyspoissometer_dd_div DYSPOISSOMETER_PREFIXED(dd_div)
+#define dyspoissometer_dd_from_u64 DYSPOISSOMETER_PREFIXED(dd_from_u64)
+#define dyspoissometer_dd_exp DYSPOISSOMETER_PREFIXED(dd_exp)
+#define dyspoissometer_dd_log DYSPOISSOMETER_PREFIXED(dd_log)
+#define dyspoissometer_dd_sqrt DYSPOISSOMETER_PREFIXED(dd_sqrt)
+#define dyspoissometer_dd_log_sum_get DYSPOISSOMETER_PREFIXED(dd_log_sum_get)
+#define dyspoissometer_logfreedom_nonzero_dd_get DYSPOISSOMETER_PREFIXED(logfreedom_nonzero_dd_get)
+#define dyspoissometer_logfreedom_sparse_dd_get DYSPOISSOMETER_PREFIXED(logfreedom_sparse_dd_get)
+#define dyspoissometer_logfreedom_nonzero_get DYSPOISSOMETER_PREFIXED(logfreedom_nonzero_get)
+#define dyspoissometer_logfreedom_sparse_get DYSPOISSOMETER_PREFIXED(logfreedom_sparse_get)
+#define dyspoissometer_logfreedom_dense_get DYSPOISSOMETER_PREFIXED(logfreedom_dense_get)
+#define dyspoissometer_dyspoissonism_get DYSPOISSOMETER_PREFIXED(dyspoissonism_get)
+#define dyspoissometer_dyspoissonism_dd_get DYSPOISSOMETER_PREFIXED(dyspoissonism_dd_get)
+#define dyspoissometer_u64_freq_list_logfreedom_get DYSPOISSOMETER_PREFIXED(u64_freq_list_logfreedom_get)
+#define dyspoissometer_sparsity_get DYSPOISSOMETER_PREFIXED(sparsity_get)
+#define dyspoissometer_freq_list_update_autoscale DYSPOISSOMETER_PREFIXED(freq_list_update_autoscale)
+#define dyspoissometer_freq_list_lane_malloc_zero DYSPOISSOMETER_PREFIXED(freq_list_lane_malloc_zero)
+#define dyspoissometer_u24_list_unpack DYSPOISSOMETER_PREFIXED(u24_list_unpack)
+#define dyspoissometer_freq_list_accrue DYSPOISSOMETER_PREFIXED(freq_list_accrue)
+#define dyspoissometer_freq_list_merge DYSPOISSOMETER_PREFIXED(freq_list_merge)
+#define dyspoissometer_freq_list_lane_get DYSPOISSOMETER_PREFIXED(freq_list_lane_get)
+#define dyspoissometer_freq_list_get DYSPOISSOMETER_PREFIXED(freq_list_get)
+#define dyspoissometer_uint_list_unpack DYSPOISSOMETER_PREFIXED(uint_list_unpack)
+#define dyspoissometer_freq_list_sparse_get DYSPOISSOMETER_PREFIXED(freq_list_sparse_get)
+#define dyspoissometer_freq_max_minus_1_get DYSPOISSOMETER_PREFIXED(freq_max_minus_1_get)
+#define dyspoissometer_pop_list_get DYSPOISSOMETER_PREFIXED(pop_list_get)
+#define dyspoissometer_pop_list_init DYSPOISSOMETER_PREFIXED(pop_list_init)
+#define dyspoissometer_pop_list_obtuse_init DYSPOISSOMETER_PREFIXED(pop_list_obtuse_init)
+#define dyspoissometer_poisson_term_get DYSPOISSOMETER_PREFIXED(poisson_term_get)
+#define dyspoissometer_chain_init DYSPOISSOMETER_PREFIXED(chain_init)
+#define dyspoissometer_chain_free DYSPOISSOMETER_PREFIXED(chain_free)
+#define dyspoissometer_chain_iterate DYSPOISSOMETER_PREFIXED(chain_iterate)
+#define dyspoissometer_chain_thread_run DYSPOISSOMETER_PREFIXED(chain_thread_run)
+#define dyspoissometer_chain_logfreedom_get DYSPOISSOMETER_PREFIXED(chain_logfreedom_get)
+#define dyspoissometer_chain_copy DYSPOISSOMETER_PREFIXED(chain_copy)
+#define dyspoissometer_chain_list_malloc DYSPOISSOMETER_PREFIXED(chain_list_malloc)
+#define dyspoissometer_cpu_count_get DYSPOISSOMETER_PREFIXED(cpu_count_get)
+#define dyspoissometer_logfreedom_max_get DYSPOISSOMETER_PREFIXED(logfreedom_max_get)
+#define dyspoissometer_logfreedom_max_parallel_get DYSPOISSOMETER_PREFIXED(logfreedom_max_parallel_get)
+#define dyspoissometer_marsaglia_product_get DYSPOISSOMETER_PREFIXED(marsaglia_product_get)
+#define dyspoissometer_random_seed_jump_get DYSPOISSOMETER_PREFIXED(random_seed_jump_get)
+#define dyspoissometer_mask_list_pseudorandom_get DYSPOISSOMETER_PREFIXED(mask_list_pseudorandom_get)
+#define dyspoissometer_number_list_sort DYSPOISSOMETER_PREFIXED(number_list_sort)
+#define dyspoissometer_number_list_select DYSPOISSOMETER_PREFIXED(number_list_select)
+#define dyspoissometer_quantile_init DYSPOISSOMETER_PREFIXED(quantile_init)
+#define dyspoissometer_quantile_free DYSPOISSOMETER_PREFIXED(quantile_free)
+#define dyspoissometer_quantile_add DYSPOISSOMETER_PREFIXED(quantile_add)
+#define dyspoissometer_quantile_get DYSPOISSOMETER_PREFIXED(quantile_get)
+#define dyspoissometer_logfreedom_median_get DYSPOISSOMETER_PREFIXED(logfreedom_median_get)
+#define dyspoissometer_logfreedom_median_stream_get DYSPOISSOMETER_PREFIXED(logfreedom_median_stream_get)
+#define dyspoissometer_uint_list_logfreedom_get DYSPOISSOMETER_PREFIXED(uint_list_logfreedom_get)
+#define dyspoissometer_uint_list_mean_get DYSPOISSOMETER_PREFIXED(uint_list_mean_get)
+#define dyspoissometer_moment_merge DYSPOISSOMETER_PREFIXED(moment_merge)
+#define dyspoissometer_moment_accrue DYSPOISSOMETER_PREFIXED(moment_accrue)
+#define dyspoissometer_moment_thread_run DYSPOISSOMETER_PREFIXED(moment_thread_run)
+#define dyspoissometer_moment_list_malloc DYSPOISSOMETER_PREFIXED(moment_list_malloc)
+#define dyspoissometer_moment_stats_get DYSPOISSOMETER_PREFIXED(moment_stats_get)
+#define dyspoissometer_uint_list_stats_get DYSPOISSOMETER_PREFIXED(uint_list_stats_get)
+#define dyspoissometer_u16_list_logfreedom_get DYSPOISSOMETER_PREFIXED(u16_list_logfreedom_get)
+#define dyspoissometer_u16_list_mean_get DYSPOISSOMETER_PREFIXED(u16_list_mean_get)
+#define dyspoissometer_u16_list_stats_get DYSPOISSOMETER_PREFIXED(u16_list_stats_get)
+#define dyspoissometer_u24_list_logfreedom_get DYSPOISSOMETER_PREFIXED(u24_list_logfreedom_get)
+#define dyspoissometer_u24_list_mean_get DYSPOISSOMETER_PREFIXED(u24_list_mean_get)
+#define dyspoissometer_u24_list_stats_get DYSPOISSOMETER_PREFIXED(u24_list_stats_get)
+#define dyspoissometer_u32_list_logfreedom_get DYSPOISSOMETER_PREFIXED(u32_list_logfreedom_get)
+#define dyspoissometer_u32_list_mean_get DYSPOISSOMETER_PREFIXED(u32_list_mean_get)
+#define dyspoissometer_u32_list_stats_get DYSPOISSOMETER_PREFIXED(u32_list_stats_get)
+#define dyspoissometer_u8_list_logfreedom_get DYSPOISSOMETER_PREFIXED(u8_list_logfreedom_get)
+#define dyspoissometer_u8_list_mean_get DYSPOISSOMETER_PREFIXED(u8_list_mean_get)
+#define dyspoissometer_u8_list_stats_get DYSPOISSOMETER_PREFIXED(u8_list_stats_get)
+#define dyspoissometer_kernel_density_expected_fast_get DYSPOISSOMETER_PREFIXED(kernel_density_expected_fast_get)
+#define dyspoissometer_kernel_density_expected_slow_get DYSPOISSOMETER_PREFIXED(kernel_density_expected_slow_get)
+#define dyspoissometer_kernel_size_get DYSPOISSOMETER_PREFIXED(kernel_size_get)
+#define dyspoissometer_kernel_size_slow_get DYSPOISSOMETER_PREFIXED(kernel_size_slow_get)
+#define dyspoissometer_kernel_density_get DYSPOISSOMETER_PREFIXED(kernel_density_get)
+#define dyspoissometer_kernel_skew_get DYSPOISSOMETER_PREFIXED(kernel_skew_get)
+#define dyspoissometer_mibr_expected_get DYSPOISSOMETER_PREFIXED(mibr_expected_get)
+#define dyspoissometer_uint_idx_list_sort DYSPOISSOMETER_PREFIXED(uint_idx_list_sort)
+#define dyspoissometer_uint_idx_record_list_malloc DYSPOISSOMETER_PREFIXED(uint_idx_record_list_malloc)
+#define dyspoissometer_uint_idx_list_record_sort DYSPOISSOMETER_PREFIXED(uint_idx_list_record_sort)
+#define dyspoissometer_mibr_scan_get DYSPOISSOMETER_PREFIXED(mibr_scan_get)
+#define dyspoissometer_mibr_get DYSPOISSOMETER_PREFIXED(mibr_get)
+#define dyspoissometer_skew_from_mibr_get DYSPOISSOMETER_PREFIXED(skew_from_mibr_get)
+#define dyspoissometer_mibr_from_skew_get DYSPOISSOMETER_PREFIXED(mibr_from_skew_get)
+#define dyspoissometer_report_get DYSPOISSOMETER_PREFIXED(report_get)
+#define dyspoissometer_baseline_compare DYSPOISSOMETER_PREFIXED(baseline_compare)
+#define dyspoissometer_baseline_pack DYSPOISSOMETER_PREFIXED(baseline_pack)
+#define dyspoissometer_baseline_unpack DYSPOISSOMETER_PREFIXED(baseline_unpack)
+#define dyspoissometer_baseline_find DYSPOISSOMETER_PREFIXED(baseline_find)
+#define dyspoissometer_baseline_save DYSPOISSOMETER_PREFIXED(baseline_save)
+#define dyspoissometer_logfreedom_median_cached_get DYSPOISSOMETER_PREFIXED(logfreedom_median_cached_get)
+#define dyspoissometer_logfreedom_max_cached_get DYSPOISSOMETER_PREFIXED(logfreedom_max_cached_get)
+#define dyspoissometer_window_init DYSPOISSOMETER_PREFIXED(window_init)
+#define dyspoissometer_window_free DYSPOISSOMETER_PREFIXED(window_free)
+#define dyspoissometer_window_log_get DYSPOISSOMETER_PREFIXED(window_log_get)
+#define dyspoissometer_window_add DYSPOISSOMETER_PREFIXED(window_add)
+#define dyspoissometer_window_remove DYSPOISSOMETER_PREFIXED(window_remove)
+#define dyspoissometer_window_slide DYSPOISSOMETER_PREFIXED(window_slide)
+#define dyspoissometer_window_logfreedom_get DYSPOISSOMETER_PREFIXED(window_logfreedom_get)
@@ -0,0 +1,29 @@
+/*
+Dyspoissometer
+Copyright 2016 Russell Leidich
+http://dyspoissonism.blogspot.com
+
+This collection of files constitutes the Dyspoissometer Library. (This is a
+library in the abstact sense; it's not intended to compile to a ".lib"
+file.)
+
+The Dyspoissometer Library is free software: you can redistribute it and/or
+modify it under the terms of the GNU Limited General Public License as
+published by the Free Software Foundation, version 3.
+
+The Dyspoissometer Library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+Limited General Public License version 3 for more details.
+
+You should have received a copy of the GNU Limited General Public
+License version 3 along with the Dyspoissometer Library (filename
+"COPYING"). If not, see http://www.gnu.org/licenses/ .
+*/
+/*
+Prototypes of the Dyspoissometer functions to which dyspoissometer_any.c dispatches, as functions of their names and of DYSPOISSOMETER_NUMBER and DYSPOISSOMETER_UINT, which vary by precision. dyspoissometer_xtrn.h declares these functions through these macros for the precision being compiled, and dyspoissometer_any.c declares them for all 4 precisions at once, so the latter can't fall out of sync with the former.
+*/
+#define DYSPOISSOMETER_INIT_PROTOTYPE(name) u8 name(u32 build_break_count, u32 build_feature_count)
+#define DYSPOISSOMETER_LOGFREEDOM_MAX_GET_PROTOTYPE(name, number, uint) number name(u64 iteration_max, uint mask_idx_max, uint mask_max, u64 *random_seed_base)
+#define DYSPOISSOMETER_LOGFREEDOM_MEDIAN_GET_PROTOTYPE(name, number, uint) number name(uint iteration_max, uint mask_idx_max, uint mask_max, u64 *random_seed_base)
+#define DYSPOISSOMETER_U64_FREQ_LIST_LOGFREEDOM_GET_PROTOTYPE(name, number) number name(number *dyspoissonism_base, u64 *freq_list_base, u64 mask_max)
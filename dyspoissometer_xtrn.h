@@ -20,7 +20,7 @@ You should have received a copy of the GNU Limited General Public
 License version 3 along with the Dyspoissometer Library (filename
 "COPYING"). If not, see http://www.gnu.org/licenses/ .
 */
-extern u8 dyspoissometer_init(u32 build_break_count, u32 build_feature_count);
+extern DYSPOISSOMETER_INIT_PROTOTYPE(dyspoissometer_init);
 extern void *dyspoissometer_free(void *base);
 extern DYSPOISSOMETER_NUMBER *dyspoissometer_number_list_malloc(DYSPOISSOMETER_UINT number_idx_max);
 extern DYSPOISSOMETER_UINT *dyspoissometer_uint_list_malloc(DYSPOISSOMETER_UINT uint_idx_max);
@@ -29,23 +29,66 @@ extern void *dyspoissometer_uint_list_list_free(DYSPOISSOMETER_UINT list_idx_max
 extern void dyspoissometer_uint_list_zero(DYSPOISSOMETER_UINT uint_idx_max, DYSPOISSOMETER_UINT *uint_list_base);
 extern DYSPOISSOMETER_UINT *dyspoissometer_uint_list_malloc_zero(DYSPOISSOMETER_UINT uint_idx_max);
 extern void dyspoissometer_uint_list_sort(DYSPOISSOMETER_UINT uint_idx_max, DYSPOISSOMETER_UINT *uint_list0_base, DYSPOISSOMETER_UINT *uint_list1_base);
+extern dyspoissometer_dd_t dyspoissometer_dd_add(dyspoissometer_dd_t dd0, dyspoissometer_dd_t dd1);
+extern dyspoissometer_dd_t dyspoissometer_dd_sub(dyspoissometer_dd_t dd0, dyspoissometer_dd_t dd1);
+extern dyspoissometer_dd_t dyspoissometer_dd_mul(dyspoissometer_dd_t dd0, dyspoissometer_dd_t dd1);
+extern dyspoissometer_dd_t dyspoissometer_dd_div(dyspoissometer_dd_t dd0, dyspoissometer_dd_t dd1);
+extern dyspoissometer_dd_t dyspoissometer_dd_from_u64(u64 u);
+extern dyspoissometer_dd_t dyspoissometer_dd_exp(dyspoissometer_dd_t dd);
+extern dyspoissometer_dd_t dyspoissometer_dd_log(dyspoissometer_dd_t dd);
+extern dyspoissometer_dd_t dyspoissometer_dd_sqrt(dyspoissometer_dd_t dd);
+extern dyspoissometer_dd_t dyspoissometer_dd_log_sum_get(u64 u);
+extern dyspoissometer_dd_t dyspoissometer_logfreedom_nonzero_dd_get(DYSPOISSOMETER_UINT freq_idx_max, DYSPOISSOMETER_UINT *freq_list0_base, DYSPOISSOMETER_UINT *freq_list1_base, DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_max);
+extern dyspoissometer_dd_t dyspoissometer_logfreedom_sparse_dd_get(DYSPOISSOMETER_UINT *freq_list0_base, DYSPOISSOMETER_UINT *freq_list1_base, DYSPOISSOMETER_UINT mask_max);
+extern DYSPOISSOMETER_NUMBER dyspoissometer_logfreedom_nonzero_get(DYSPOISSOMETER_UINT freq_idx_max, DYSPOISSOMETER_UINT *freq_list0_base, DYSPOISSOMETER_UINT *freq_list1_base, DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_max);
 extern DYSPOISSOMETER_NUMBER dyspoissometer_logfreedom_sparse_get(DYSPOISSOMETER_UINT *freq_list0_base, DYSPOISSOMETER_UINT *freq_list1_base, DYSPOISSOMETER_UINT mask_max);
 extern DYSPOISSOMETER_NUMBER dyspoissometer_logfreedom_dense_get(DYSPOISSOMETER_UINT freq_max_minus_1, DYSPOISSOMETER_UINT freq_min, DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_max, DYSPOISSOMETER_UINT *pop_list_base);
 extern DYSPOISSOMETER_NUMBER dyspoissometer_dyspoissonism_get(DYSPOISSOMETER_NUMBER logfreedom, DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_max);
+extern DYSPOISSOMETER_NUMBER dyspoissometer_dyspoissonism_dd_get(dyspoissometer_dd_t logfreedom, DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_max);
+extern DYSPOISSOMETER_U64_FREQ_LIST_LOGFREEDOM_GET_PROTOTYPE(dyspoissometer_u64_freq_list_logfreedom_get, DYSPOISSOMETER_NUMBER);
 extern DYSPOISSOMETER_NUMBER dyspoissometer_sparsity_get(DYSPOISSOMETER_NUMBER logfreedom, DYSPOISSOMETER_NUMBER logfreedom_max);
 extern u8 dyspoissometer_freq_list_update_autoscale(DYSPOISSOMETER_UINT *freq_list_base, DYSPOISSOMETER_UINT *mask_count_implied_base, DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT *mask_list_base, DYSPOISSOMETER_UINT mask_max);
+extern DYSPOISSOMETER_UINT *dyspoissometer_freq_list_lane_malloc_zero(u8 burst_status, u8 *lane_idx_max_base, DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_max);
+extern void dyspoissometer_u24_list_unpack(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u8 *u24_list_base, u32 *u32_list_base);
+extern void dyspoissometer_freq_list_accrue(DYSPOISSOMETER_UINT *freq_list_base, u8 lane_idx_max, DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, DYSPOISSOMETER_UINT mask_max, u16 *u16_list_base, u8 *u24_list_base, u32 *u32_list_base, u8 *u8_list_base, DYSPOISSOMETER_UINT *uint_list_base);
+extern void dyspoissometer_freq_list_merge(DYSPOISSOMETER_UINT *freq_list_base, u8 lane_idx_max, DYSPOISSOMETER_UINT mask_max);
+extern void dyspoissometer_freq_list_lane_get(DYSPOISSOMETER_UINT *freq_list_base, u8 lane_idx_max, DYSPOISSOMETER_UINT *lane_list_base, DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT *mask_list_base, DYSPOISSOMETER_UINT mask_max);
 extern void dyspoissometer_freq_list_get(DYSPOISSOMETER_UINT *freq_list_base, DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT *mask_list_base, DYSPOISSOMETER_UINT mask_max);
+extern void dyspoissometer_uint_list_unpack(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u16 *u16_list_base, u8 *u24_list_base, u32 *u32_list_base, u8 *u8_list_base, DYSPOISSOMETER_UINT *uint_list_base);
+extern DYSPOISSOMETER_UINT dyspoissometer_freq_list_sparse_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT *mask_list0_base, DYSPOISSOMETER_UINT *mask_list1_base);
 extern DYSPOISSOMETER_UINT dyspoissometer_freq_max_minus_1_get(DYSPOISSOMETER_UINT *freq_list_base, DYSPOISSOMETER_UINT mask_max);
 extern DYSPOISSOMETER_UINT dyspoissometer_pop_list_get(DYSPOISSOMETER_UINT *freq_list_base, DYSPOISSOMETER_UINT freq_max_minus_1, DYSPOISSOMETER_UINT mask_max, DYSPOISSOMETER_UINT *pop_list_base);
 extern DYSPOISSOMETER_UINT *dyspoissometer_pop_list_init(DYSPOISSOMETER_UINT *freq_list_base, DYSPOISSOMETER_UINT *freq_max_minus_1_base, DYSPOISSOMETER_UINT *h0_base, DYSPOISSOMETER_UINT mask_max);
 extern DYSPOISSOMETER_UINT *dyspoissometer_pop_list_obtuse_init(DYSPOISSOMETER_UINT *freq_list_base, DYSPOISSOMETER_UINT freq_max_minus_1, DYSPOISSOMETER_UINT *h0_base, DYSPOISSOMETER_UINT mask_max);
 extern DYSPOISSOMETER_NUMBER dyspoissometer_poisson_term_get(DYSPOISSOMETER_UINT freq, DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_max);
-extern DYSPOISSOMETER_NUMBER dyspoissometer_logfreedom_max_get(u64 iteration_max, DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_max, u64 *random_seed_base);
+extern u8 dyspoissometer_chain_init(dyspoissometer_chain_t *chain_base, DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_max, u64 random_seed);
+extern void dyspoissometer_chain_free(dyspoissometer_chain_t *chain_base);
+extern void dyspoissometer_chain_iterate(dyspoissometer_chain_t *chain_base, u64 iteration_count_minus_1);
+extern void *dyspoissometer_chain_thread_run(void *chain_base);
+extern DYSPOISSOMETER_NUMBER dyspoissometer_chain_logfreedom_get(dyspoissometer_chain_t *chain_base);
+extern u8 dyspoissometer_chain_copy(dyspoissometer_chain_t *chain0_base, dyspoissometer_chain_t *chain1_base);
+extern dyspoissometer_chain_t *dyspoissometer_chain_list_malloc(u32 chain_idx_max);
+extern u32 dyspoissometer_cpu_count_get(void);
+extern DYSPOISSOMETER_LOGFREEDOM_MAX_GET_PROTOTYPE(dyspoissometer_logfreedom_max_get, DYSPOISSOMETER_NUMBER, DYSPOISSOMETER_UINT);
+extern DYSPOISSOMETER_NUMBER dyspoissometer_logfreedom_max_parallel_get(u64 iteration_max, u64 iteration_stall_max, DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_max, u64 *random_seed_base, u32 thread_count);
+extern u64 dyspoissometer_marsaglia_product_get(u64 factor0, u64 factor1);
+extern u64 dyspoissometer_random_seed_jump_get(u64 random_seed, u64 step_count);
 extern void dyspoissometer_mask_list_pseudorandom_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT *mask_list_base, DYSPOISSOMETER_UINT mask_max, u64 *random_seed_base);
 extern void dyspoissometer_number_list_sort(DYSPOISSOMETER_UINT number_idx_max, DYSPOISSOMETER_NUMBER *number_list_base0, DYSPOISSOMETER_NUMBER *number_list_base1);
-extern DYSPOISSOMETER_NUMBER dyspoissometer_logfreedom_median_get(DYSPOISSOMETER_UINT iteration_max, DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_max, u64 *random_seed_base);
+extern DYSPOISSOMETER_NUMBER dyspoissometer_number_list_select(DYSPOISSOMETER_UINT number_idx, DYSPOISSOMETER_UINT number_idx_max, DYSPOISSOMETER_NUMBER *number_list_base);
+extern u8 dyspoissometer_quantile_init(DYSPOISSOMETER_UINT buffer_idx_max, dyspoissometer_quantile_t *quantile_base);
+extern void dyspoissometer_quantile_free(dyspoissometer_quantile_t *quantile_base);
+extern u8 dyspoissometer_quantile_add(dyspoissometer_quantile_t *quantile_base, DYSPOISSOMETER_NUMBER number);
+extern DYSPOISSOMETER_NUMBER dyspoissometer_quantile_get(dyspoissometer_quantile_t *quantile_base, u64 rank, u64 *rank_error_max_base);
+extern DYSPOISSOMETER_LOGFREEDOM_MEDIAN_GET_PROTOTYPE(dyspoissometer_logfreedom_median_get, DYSPOISSOMETER_NUMBER, DYSPOISSOMETER_UINT);
+extern DYSPOISSOMETER_NUMBER dyspoissometer_logfreedom_median_stream_get(DYSPOISSOMETER_UINT buffer_idx_max, u64 iteration_max, DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_max, u64 *random_seed_base, u64 *rank_error_max_base);
 extern DYSPOISSOMETER_NUMBER dyspoissometer_uint_list_logfreedom_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u32 mask_max, u16 *u16_list_base, u8 *u24_list_base, u32 *u32_list_base, u8 *u8_list_base);
 extern DYSPOISSOMETER_NUMBER dyspoissometer_uint_list_mean_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u8 sign_status, u16 *u16_list_base, u8 *u24_list_base, u32 *u32_list_base, u8 *u8_list_base);
+extern void dyspoissometer_moment_merge(dyspoissometer_moment_t *moment0_base, dyspoissometer_moment_t *moment1_base);
+extern void dyspoissometer_moment_accrue(dyspoissometer_moment_t *moment_base);
+extern void *dyspoissometer_moment_thread_run(void *moment_base);
+extern dyspoissometer_moment_t *dyspoissometer_moment_list_malloc(u32 moment_idx_max);
+extern DYSPOISSOMETER_NUMBER dyspoissometer_moment_stats_get(dyspoissometer_moment_t *moment_base, DYSPOISSOMETER_NUMBER *stat_kurtosis_base, DYSPOISSOMETER_NUMBER *stat_sigma_base, DYSPOISSOMETER_NUMBER *stat_variance_base);
 extern DYSPOISSOMETER_NUMBER dyspoissometer_uint_list_stats_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u8 sign_status, DYSPOISSOMETER_NUMBER *stat_kurtosis_base, DYSPOISSOMETER_NUMBER *stat_sigma_base, DYSPOISSOMETER_NUMBER *stat_variance_base, u16 *u16_list_base, u8 *u24_list_base, u32 *u32_list_base, u8 *u8_list_base);
 extern DYSPOISSOMETER_NUMBER dyspoissometer_u16_list_logfreedom_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u16 mask_max, u16 *u16_list_base);
 extern DYSPOISSOMETER_NUMBER dyspoissometer_u16_list_mean_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, u8 sign_status, u16 *u16_list_base);
@@ -62,10 +105,29 @@ extern DYSPOISSOMETER_NUMBER dyspoissometer_u8_list_stats_get(DYSPOISSOMETER_UIN
 extern DYSPOISSOMETER_NUMBER dyspoissometer_kernel_density_expected_fast_get(DYSPOISSOMETER_UINT mask_idx_max);
 extern DYSPOISSOMETER_NUMBER dyspoissometer_kernel_density_expected_slow_get(DYSPOISSOMETER_UINT mask_idx_max);
 extern DYSPOISSOMETER_UINT dyspoissometer_kernel_size_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT *mask_list_base);
+extern DYSPOISSOMETER_UINT dyspoissometer_kernel_size_slow_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT *mask_list_base);
 extern DYSPOISSOMETER_NUMBER dyspoissometer_kernel_density_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT kernel_size);
 extern DYSPOISSOMETER_NUMBER dyspoissometer_kernel_skew_get(DYSPOISSOMETER_NUMBER kernel_density, DYSPOISSOMETER_NUMBER kernel_density_expected);
 extern DYSPOISSOMETER_NUMBER dyspoissometer_mibr_expected_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_max);
 extern void dyspoissometer_uint_idx_list_sort(DYSPOISSOMETER_UINT *idx_list_base0, DYSPOISSOMETER_UINT *idx_list_base1, DYSPOISSOMETER_UINT uint_idx_max, DYSPOISSOMETER_UINT *uint_list_base0, DYSPOISSOMETER_UINT *uint_list_base1);
+extern dyspoissometer_uint_idx_record_t *dyspoissometer_uint_idx_record_list_malloc(DYSPOISSOMETER_UINT record_idx_max);
+extern void dyspoissometer_uint_idx_list_record_sort(DYSPOISSOMETER_UINT *idx_list_base, dyspoissometer_uint_idx_record_t *record_list0_base, dyspoissometer_uint_idx_record_t *record_list1_base, DYSPOISSOMETER_UINT uint_idx_max, DYSPOISSOMETER_UINT *uint_list_base);
+extern u8 dyspoissometer_mibr_scan_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT *mask_list_base, DYSPOISSOMETER_UINT mask_max, DYSPOISSOMETER_UINT *mibr_base);
 extern u8 dyspoissometer_mibr_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT *mask_list_base, DYSPOISSOMETER_UINT *mibr_base);
 extern DYSPOISSOMETER_NUMBER dyspoissometer_skew_from_mibr_get(DYSPOISSOMETER_UINT mask_max, DYSPOISSOMETER_UINT mibr);
 extern DYSPOISSOMETER_UINT dyspoissometer_mibr_from_skew_get(DYSPOISSOMETER_UINT mask_max, DYSPOISSOMETER_NUMBER probability);
+extern u8 dyspoissometer_report_get(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_idx_min, DYSPOISSOMETER_UINT mask_max, u8 metric_status, dyspoissometer_report_t *report_base, u8 sign_status, u16 *u16_list_base, u8 *u24_list_base, u32 *u32_list_base, u8 *u8_list_base);
+extern u8 dyspoissometer_baseline_compare(dyspoissometer_baseline_t *baseline0_base, dyspoissometer_baseline_t *baseline1_base);
+extern void dyspoissometer_baseline_pack(dyspoissometer_baseline_t *baseline_base, u8 *record_base);
+extern void dyspoissometer_baseline_unpack(dyspoissometer_baseline_t *baseline_base, u8 *record_base);
+extern u8 dyspoissometer_baseline_find(dyspoissometer_baseline_t *baseline_base, char *filename_base);
+extern u8 dyspoissometer_baseline_save(dyspoissometer_baseline_t *baseline_base, char *filename_base);
+extern DYSPOISSOMETER_NUMBER dyspoissometer_logfreedom_median_cached_get(char *filename_base, DYSPOISSOMETER_UINT iteration_max, DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_max, u64 *random_seed_base);
+extern DYSPOISSOMETER_NUMBER dyspoissometer_logfreedom_max_cached_get(char *filename_base, u64 iteration_max, DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_max, u64 *random_seed_base);
+extern u8 dyspoissometer_window_init(DYSPOISSOMETER_UINT mask_idx_max, DYSPOISSOMETER_UINT mask_max, dyspoissometer_window_t *window_base);
+extern void dyspoissometer_window_free(dyspoissometer_window_t *window_base);
+extern DYSPOISSOMETER_NUMBER dyspoissometer_window_log_get(DYSPOISSOMETER_UINT log_idx_max, DYSPOISSOMETER_NUMBER *log_list_base, DYSPOISSOMETER_UINT n);
+extern void dyspoissometer_window_add(dyspoissometer_window_t *window_base, DYSPOISSOMETER_UINT mask);
+extern void dyspoissometer_window_remove(dyspoissometer_window_t *window_base, DYSPOISSOMETER_UINT mask);
+extern void dyspoissometer_window_slide(dyspoissometer_window_t *window_base, DYSPOISSOMETER_UINT mask_new, DYSPOISSOMETER_UINT mask_old);
+extern DYSPOISSOMETER_NUMBER dyspoissometer_window_logfreedom_get(DYSPOISSOMETER_NUMBER *dyspoissonism_base, dyspoissometer_window_t *window_base);
@@ -26,4 +26,4 @@ Timedelta Profile Version Info
 /*
 BUILD_ID must increase with every code release, even if only a comment changes. It allows the user to discern one build from another, but is invisible to other libraries. If this library depends on other libraries, then it should be expressed as the sum of the local build ID plus the build IDs of the dependencies, and in any event must increase monotonically even if some of the latter are removed.
 */
-#define TIMEDELTAPROFILE_BUILD_ID (4+DYSPOISSOMETER_BUILD_ID+TIMESTAMP_BUILD_ID)
+#define TIMEDELTAPROFILE_BUILD_ID (17+TIMEDELTA_PROFILE_BUILD_ID)
@@ -26,4 +26,4 @@ Timedelta Stream Saver Version Info
 /*
 BUILD_ID must increase with every code release, even if only a comment changes. It allows the user to discern one build from another, but is invisible to other libraries. If this library depends on other libraries, then it should be expressed as the sum of the local build ID plus the build IDs of the dependencies, and in any event must increase monotonically even if some of the latter are removed.
 */
-#define TIMEDELTASAVE_BUILD_ID (3+TIMESTAMP_BUILD_ID)
+#define TIMEDELTASAVE_BUILD_ID (8+TIMEDELTA_PACK_BUILD_ID+TIMESTAMP_BUILD_ID)
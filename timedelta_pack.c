@@ -0,0 +1,588 @@
+/*
+Enranda
+Copyright 2016 Russell Leidich
+http://enranda.blogspot.com
+
+This collection of files constitutes the Enranda Library. (This is a
+library in the abstact sense; it's not intended to compile to a ".lib"
+file.)
+
+The Enranda Library is free software: you can redistribute it and/or
+modify it under the terms of the GNU Limited General Public License as
+published by the Free Software Foundation, version 3.
+
+The Enranda Library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+Limited General Public License version 3 for more details.
+
+You should have received a copy of the GNU Limited General Public
+License version 3 along with the Enranda Library (filename
+"COPYING"). If not, see http://www.gnu.org/licenses/ .
+*/
+/*
+Timedelta Pack Library
+
+This reads and writes the compressed timedelta file format described in timedelta_pack.h, which timedeltasave outputs with "f=p". Blocks can be decoded independently of one another, so a reader can seek to any part of a capture, or stream all of it into a frequency list for Dyspoissometer, without ever holding more than one block in memory. The only dependency is the C library, so decoders can be built without the rest of Enranda.
+*/
+#include "flag.h"
+#include "flag_timedelta_pack.h"
+#ifndef WINDOWS
+  #define _GNU_SOURCE
+#endif
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "constant.h"
+#include "debug.h"
+#include "debug_xtrn.h"
+#include "timedelta_pack.h"
+/*
+TIMEDELTA_PACK_FSEEK() seeks to a 64-bit file offset, which fseek() cannot do on some platforms.
+*/
+#ifdef WINDOWS
+  #define TIMEDELTA_PACK_FSEEK(handle, offset, origin) _fseeki64(handle, (__int64)(offset), origin)
+#else
+  #define TIMEDELTA_PACK_FSEEK(handle, offset, origin) fseeko(handle, (off_t)(offset), origin)
+#endif
+
+u64
+timedelta_pack_u64_get(u8 *u8_list_base){
+/*
+Read a little endian u64 regardless of the native byte order.
+
+In:
+
+  *u8_list_base contains the u64 in little endian order.
+
+Out:
+
+  Returns the u64.
+*/
+  u8 u8_idx;
+  u64 value;
+
+  value=0;
+  u8_idx=U64_BYTE_MAX;
+  do{
+    value=(value<<U8_BITS)|u8_list_base[u8_idx];
+  }while(u8_idx--);
+  return value;
+}
+
+void
+timedelta_pack_u64_put(u8 *u8_list_base, u64 value){
+/*
+Write a little endian u64 regardless of the native byte order.
+
+In:
+
+  *u8_list_base is writable for U64_SIZE bytes.
+
+  value is the u64 to write.
+
+Out:
+
+  *u8_list_base contains value in little endian order.
+*/
+  u8 u8_idx;
+
+  u8_idx=0;
+  do{
+    u8_list_base[u8_idx]=(u8)(value);
+    value>>=U8_BITS;
+  }while((u8_idx++)!=U64_BYTE_MAX);
+  return;
+}
+
+u64
+timedelta_pack_block_encode(u8 *code_list_base, u64 timedelta_count, u8 timedelta_sample_size, u8 *timedelta_u8_list_base){
+/*
+Code a block of timedeltas as described in timedelta_pack.h.
+
+In:
+
+  *code_list_base is writable for (timedelta_count*TIMEDELTA_PACK_CODE_SIZE_MAX) bytes.
+
+  timedelta_count is the number of timedeltas in the block, which is nonzero.
+
+  timedelta_sample_size is the number of bytes per timedelta, on [1, 8].
+
+  *timedelta_u8_list_base contains timedelta_count timedeltas of timedelta_sample_size bytes each, as output by timedeltasave, which is to say the low bytes of the native u64s.
+
+Out:
+
+  Returns the number of bytes of code.
+
+  *code_list_base contains the code.
+*/
+  u64 code_idx;
+  u64 delta;
+  u64 timedelta;
+  u64 timedelta_idx;
+  u64 timedelta_prev;
+  u64 zigzag;
+
+  code_idx=0;
+  timedelta=0;
+  timedelta_idx=0;
+  do{
+    timedelta_prev=timedelta;
+    timedelta=0;
+    memcpy(&timedelta, &timedelta_u8_list_base[timedelta_idx*timedelta_sample_size], (size_t)(timedelta_sample_size));
+/*
+Zigzag the difference, which is a signed value in 2's complement, so that its sign ends up in bit zero.
+*/
+    delta=timedelta-timedelta_prev;
+    zigzag=(delta<<1)^(0-(delta>>U64_BIT_MAX));
+    while(zigzag>>7){
+      code_list_base[code_idx]=(u8)(zigzag|0x80U);
+      code_idx++;
+      zigzag>>=7;
+    }
+    code_list_base[code_idx]=(u8)(zigzag);
+    code_idx++;
+  }while((++timedelta_idx)!=timedelta_count);
+  return code_idx;
+}
+
+u8
+timedelta_pack_block_decode(u64 code_size, u8 *code_list_base, u64 timedelta_count, u64 *timedelta_list_base){
+/*
+Decode a block of timedeltas as described in timedelta_pack.h.
+
+In:
+
+  code_size is the number of bytes of code.
+
+  *code_list_base is as defined in timedelta_pack_block_encode():Out.
+
+  timedelta_count is the number of timedeltas in the block, which is nonzero.
+
+  *timedelta_list_base is writable for timedelta_count items.
+
+Out:
+
+  Returns one if the code is malformed or its size does not correspond to timedelta_count, else zero.
+
+  *timedelta_list_base contains the timedeltas. Undefined if we returned one.
+*/
+  u8 code;
+  u64 code_idx;
+  u64 delta;
+  u8 shift;
+  u8 status;
+  u64 timedelta;
+  u64 timedelta_idx;
+  u64 zigzag;
+
+  code_idx=0;
+  status=0;
+  timedelta=0;
+  timedelta_idx=0;
+  do{
+    shift=0;
+    zigzag=0;
+    do{
+      status=(code_idx==code_size)||(U64_BIT_MAX<shift);
+      if(status){
+        break;
+      }
+      code=code_list_base[code_idx];
+      code_idx++;
+/*
+The tenth byte can only contribute the high bit of zigzag, so fail if it has any others rather than silently discard them.
+*/
+      status=(shift==U64_BIT_MAX)&&(code&0x7EU);
+      if(status){
+        break;
+      }
+      zigzag|=(u64)(code&0x7FU)<<shift;
+      shift=(u8)(shift+7);
+    }while(code&0x80U);
+    if(status){
+      break;
+    }
+    delta=(zigzag>>1)^(0-(zigzag&1));
+    timedelta+=delta;
+    timedelta_list_base[timedelta_idx]=timedelta;
+  }while((++timedelta_idx)!=timedelta_count);
+  status=(u8)(status|(code_idx!=code_size));
+  return status;
+}
+
+void *
+timedelta_pack_reader_free(timedelta_pack_reader_t *timedelta_pack_reader_base){
+/*
+Close a packed timedelta file and free its reader.
+
+In:
+
+  timedelta_pack_reader_base is the return value of timedelta_pack_reader_init(). May be NULL.
+
+Out:
+
+  Returns NULL so that the caller can easily maintain the good practice of NULLing out invalid pointers.
+
+  *timedelta_pack_reader_base and all the lists which it owns are freed, and its file is closed.
+*/
+  if(timedelta_pack_reader_base){
+    if(timedelta_pack_reader_base->handle){
+      fclose(timedelta_pack_reader_base->handle);
+    }
+    DEBUG_FREE_PARANOID(timedelta_pack_reader_base->timedelta_list_base);
+    DEBUG_FREE_PARANOID(timedelta_pack_reader_base->code_list_base);
+    DEBUG_FREE_PARANOID(timedelta_pack_reader_base->block_offset_list_base);
+  }
+  DEBUG_FREE_PARANOID(timedelta_pack_reader_base);
+  return NULL;
+}
+
+timedelta_pack_reader_t *
+timedelta_pack_reader_init(u32 build_break_count, u32 build_feature_count, char *filename_base){
+/*
+Verify that the source code is sufficiently updated, then open a packed timedelta file and load its block index.
+
+To maximize portability and debuggability, this is the only place where the reader allocates memory.
+
+In:
+
+  build_break_count is the caller's most recent knowledge of TIMEDELTA_PACK_BUILD_BREAK_COUNT, which will fail if the caller is unaware of all critical updates.
+
+  build_feature_count is the caller's most recent knowledge of TIMEDELTA_PACK_BUILD_FEATURE_COUNT, which will fail if this library is not up to date with the caller's expectations.
+
+  filename_base is the zero-terminated name of the file.
+
+Out:
+
+  Returns NULL if (build_break_count!=TIMEDELTA_PACK_BUILD_BREAK_COUNT); or (build_feature_count>TIMEDELTA_PACK_BUILD_FEATURE_COUNT); or if the file could not be read or is malformed; or if we failed to allocate memory. Otherwise, returns the base of a timedelta_pack_reader_t, in which case, block_count, block_timedelta_count_log2, timedelta_count, and timedelta_sample_size are as saved, and the reader may be passed to timedelta_pack_block_read() and timedelta_pack_freq_list_accrue() from one thread at a time. After use, free it with timedelta_pack_reader_free().
+*/
+  u64 block_count;
+  u64 block_idx;
+  u64 *block_offset_list_base;
+  u8 block_timedelta_count_log2;
+  u8 header_list_base[TIMEDELTA_PACK_HEADER_SIZE];
+  u64 index_offset;
+  u8 status;
+  u64 timedelta_count;
+  timedelta_pack_reader_t *timedelta_pack_reader_base;
+  u8 trailer_list_base[TIMEDELTA_PACK_TRAILER_SIZE];
+
+  timedelta_pack_reader_base=NULL;
+  if((build_break_count==TIMEDELTA_PACK_BUILD_BREAK_COUNT)&&(build_feature_count<=TIMEDELTA_PACK_BUILD_FEATURE_COUNT)){
+    timedelta_pack_reader_base=(timedelta_pack_reader_t *)(DEBUG_CALLOC_PARANOID(sizeof(timedelta_pack_reader_t)));
+  }
+  status=1;
+  do{
+    if(!timedelta_pack_reader_base){
+      break;
+    }
+    timedelta_pack_reader_base->handle=fopen(filename_base, "rb");
+    if(!timedelta_pack_reader_base->handle){
+      break;
+    }
+    if(fread(header_list_base, (size_t)(U8_SIZE), (size_t)(TIMEDELTA_PACK_HEADER_SIZE), timedelta_pack_reader_base->handle)!=TIMEDELTA_PACK_HEADER_SIZE){
+      break;
+    }
+    if(TIMEDELTA_PACK_FSEEK(timedelta_pack_reader_base->handle, -(i64)(TIMEDELTA_PACK_TRAILER_SIZE), SEEK_END)){
+      break;
+    }
+    if(fread(trailer_list_base, (size_t)(U8_SIZE), (size_t)(TIMEDELTA_PACK_TRAILER_SIZE), timedelta_pack_reader_base->handle)!=TIMEDELTA_PACK_TRAILER_SIZE){
+      break;
+    }
+    block_timedelta_count_log2=header_list_base[TIMEDELTA_PACK_SIGNATURE_SIZE+1];
+    timedelta_pack_reader_base->block_timedelta_count_log2=block_timedelta_count_log2;
+    timedelta_pack_reader_base->timedelta_sample_size=header_list_base[TIMEDELTA_PACK_SIGNATURE_SIZE];
+    index_offset=timedelta_pack_u64_get(&trailer_list_base[0]);
+    block_count=timedelta_pack_u64_get(&trailer_list_base[U64_SIZE]);
+    timedelta_count=timedelta_pack_u64_get(&trailer_list_base[U64_SIZE<<1]);
+    timedelta_pack_reader_base->block_count=block_count;
+    timedelta_pack_reader_base->timedelta_count=timedelta_count;
+/*
+Require the block count to be exactly what the timedelta count implies, which also limits it to a size which can be allocated.
+*/
+    if(memcmp(header_list_base, TIMEDELTA_PACK_SIGNATURE, (size_t)(TIMEDELTA_PACK_SIGNATURE_SIZE))||memcmp(&trailer_list_base[U64_SIZE*3], TIMEDELTA_PACK_SIGNATURE, (size_t)(TIMEDELTA_PACK_SIGNATURE_SIZE))){
+      break;
+    }
+    if((!timedelta_pack_reader_base->timedelta_sample_size)||(U64_SIZE<timedelta_pack_reader_base->timedelta_sample_size)||(TIMEDELTA_PACK_BLOCK_TIMEDELTA_COUNT_LOG2<block_timedelta_count_log2)){
+      break;
+    }
+    if(((timedelta_count>>block_timedelta_count_log2)+!!(timedelta_count&((1ULL<<block_timedelta_count_log2)-1)))!=block_count){
+      break;
+    }
+    if((((ULONG_MAX>>U64_SIZE_LOG2)-1)<=block_count)||(index_offset<TIMEDELTA_PACK_HEADER_SIZE)){
+      break;
+    }
+    block_offset_list_base=(u64 *)(DEBUG_MALLOC_PARANOID((ULONG)((block_count+1)<<U64_SIZE_LOG2)));
+    timedelta_pack_reader_base->block_offset_list_base=block_offset_list_base;
+    timedelta_pack_reader_base->code_list_base=(u8 *)(DEBUG_MALLOC_PARANOID((ULONG)(TIMEDELTA_PACK_CODE_SIZE_MAX)<<block_timedelta_count_log2));
+    timedelta_pack_reader_base->timedelta_list_base=(u64 *)(DEBUG_MALLOC_PARANOID((ULONG)(U64_SIZE)<<block_timedelta_count_log2));
+    if(!(block_offset_list_base&&timedelta_pack_reader_base->code_list_base&&timedelta_pack_reader_base->timedelta_list_base)){
+      break;
+    }
+    if(TIMEDELTA_PACK_FSEEK(timedelta_pack_reader_base->handle, index_offset, SEEK_SET)){
+      break;
+    }
+    if(fread(block_offset_list_base, (size_t)(U64_SIZE), (size_t)(block_count), timedelta_pack_reader_base->handle)!=block_count){
+      break;
+    }
+/*
+Convert the block index to native byte order in place, and verify that block offsets increase from the end of the header to the start of the block index.
+*/
+    block_offset_list_base[block_count]=index_offset;
+    status=0;
+    block_idx=0;
+    while((!status)&&(block_idx!=block_count)){
+      block_offset_list_base[block_idx]=timedelta_pack_u64_get((u8 *)(&block_offset_list_base[block_idx]));
+      if(!block_idx){
+        status=(block_offset_list_base[0]!=TIMEDELTA_PACK_HEADER_SIZE);
+      }else{
+        status=(block_offset_list_base[block_idx]<=block_offset_list_base[block_idx-1]);
+      }
+      block_idx++;
+    }
+    if(block_count&&(!status)){
+      status=(index_offset<=block_offset_list_base[block_count-1]);
+    }
+  }while(0);
+  if(status){
+    timedelta_pack_reader_base=timedelta_pack_reader_free(timedelta_pack_reader_base);
+  }
+  return timedelta_pack_reader_base;
+}
+
+u64
+timedelta_pack_block_read(u64 block_idx, timedelta_pack_reader_t *timedelta_pack_reader_base){
+/*
+Read and decode one block of a packed timedelta file.
+
+In:
+
+  block_idx is the index of the block to read, on [0, timedelta_pack_reader_base->block_count-1].
+
+  *timedelta_pack_reader_base is as returned by timedelta_pack_reader_init().
+
+Out:
+
+  Returns zero if block_idx is out of range or the block could not be read or decoded, else the number of timedeltas in the block, which is (2^timedelta_pack_reader_base->block_timedelta_count_log2) for all but the last block.
+
+  *timedelta_pack_reader_base->timedelta_list_base contains the timedeltas in the block, each of which is less than (2^(timedelta_pack_reader_base->timedelta_sample_size*8)).
+*/
+  u64 block_timedelta_count;
+  u64 code_size;
+  u64 code_size_max;
+
+  block_timedelta_count=0;
+  if(block_idx<timedelta_pack_reader_base->block_count){
+    block_timedelta_count=1ULL<<timedelta_pack_reader_base->block_timedelta_count_log2;
+    if((block_idx+1)==timedelta_pack_reader_base->block_count){
+      block_timedelta_count=timedelta_pack_reader_base->timedelta_count-(block_idx<<timedelta_pack_reader_base->block_timedelta_count_log2);
+    }
+    code_size=timedelta_pack_reader_base->block_offset_list_base[block_idx+1]-timedelta_pack_reader_base->block_offset_list_base[block_idx];
+    code_size_max=block_timedelta_count*TIMEDELTA_PACK_CODE_SIZE_MAX;
+    if((code_size_max<code_size)||TIMEDELTA_PACK_FSEEK(timedelta_pack_reader_base->handle, timedelta_pack_reader_base->block_offset_list_base[block_idx], SEEK_SET)||(fread(timedelta_pack_reader_base->code_list_base, (size_t)(U8_SIZE), (size_t)(code_size), timedelta_pack_reader_base->handle)!=code_size)||timedelta_pack_block_decode(code_size, timedelta_pack_reader_base->code_list_base, block_timedelta_count, timedelta_pack_reader_base->timedelta_list_base)){
+      block_timedelta_count=0;
+    }
+  }
+  return block_timedelta_count;
+}
+
+u8
+timedelta_pack_freq_list_accrue(u64 *freq_list_base, u64 mask_max, timedelta_pack_reader_t *timedelta_pack_reader_base){
+/*
+Stream all the timedeltas in a packed timedelta file into a frequency list, one block at a time, so that their dyspoissonism can be computed with, for example, dyspoissometer_any_u64_freq_list_logfreedom_get().
+
+In:
+
+  *freq_list_base contains (mask_max+1) frequencies, to which those of the timedeltas will be added.
+
+  mask_max is one less than a power of 2, and is the mask to apply to each timedelta, such as U16_MAX in order to match timedeltaprofile.
+
+  *timedelta_pack_reader_base is as returned by timedelta_pack_reader_init().
+
+Out:
+
+  Returns one if any block could not be read, else zero.
+
+  *freq_list_base has been incremented at (timedelta&mask_max) for each timedelta in the file, so the frequencies have increased by a total of timedelta_pack_reader_base->timedelta_count. Undefined if we returned one.
+*/
+  u64 block_idx;
+  u64 block_timedelta_count;
+  u8 status;
+  u64 *timedelta_list_base;
+  u64 timedelta_idx;
+
+  status=0;
+  timedelta_list_base=timedelta_pack_reader_base->timedelta_list_base;
+  block_idx=0;
+  while(block_idx!=timedelta_pack_reader_base->block_count){
+    block_timedelta_count=timedelta_pack_block_read(block_idx, timedelta_pack_reader_base);
+    status=!block_timedelta_count;
+    if(status){
+      break;
+    }
+    timedelta_idx=0;
+    do{
+      freq_list_base[timedelta_list_base[timedelta_idx]&mask_max]++;
+    }while((++timedelta_idx)!=block_timedelta_count);
+    block_idx++;
+  }
+  return status;
+}
+
+void *
+timedelta_pack_writer_free(timedelta_pack_writer_t *timedelta_pack_writer_base){
+/*
+Free a packed timedelta file writer.
+
+In:
+
+  timedelta_pack_writer_base is the return value of timedelta_pack_writer_init(). May be NULL.
+
+Out:
+
+  Returns NULL so that the caller can easily maintain the good practice of NULLing out invalid pointers.
+
+  *timedelta_pack_writer_base and all the lists which it owns are freed. Its file is not closed.
+*/
+  if(timedelta_pack_writer_base){
+    DEBUG_FREE_PARANOID(timedelta_pack_writer_base->code_list_base);
+    DEBUG_FREE_PARANOID(timedelta_pack_writer_base->block_offset_list_base);
+  }
+  DEBUG_FREE_PARANOID(timedelta_pack_writer_base);
+  return NULL;
+}
+
+timedelta_pack_writer_t *
+timedelta_pack_writer_init(u32 build_break_count, u32 build_feature_count, FILE *handle, u8 timedelta_sample_size){
+/*
+Verify that the source code is sufficiently updated, then start writing a packed timedelta file.
+
+To maximize portability and debuggability, this and timedelta_pack_block_write() are the only places where the writer allocates memory.
+
+In:
+
+  build_break_count is as defined in timedelta_pack_reader_init():In.
+
+  build_feature_count is as defined in timedelta_pack_reader_init():In.
+
+  handle is the output file, opened for binary writing and empty. It need not be seekable.
+
+  timedelta_sample_size is the number of bytes per timedelta, on [1, 8].
+
+Out:
+
+  Returns NULL if (build_break_count!=TIMEDELTA_PACK_BUILD_BREAK_COUNT); or (build_feature_count>TIMEDELTA_PACK_BUILD_FEATURE_COUNT); or if the header could not be written; or if we failed to allocate memory. Otherwise, returns the base of a timedelta_pack_writer_t, in which case, pass it to timedelta_pack_block_write() for each block, then to timedelta_pack_writer_finish(). After use, free it with timedelta_pack_writer_free().
+*/
+  u8 header_list_base[TIMEDELTA_PACK_HEADER_SIZE];
+  u8 status;
+  timedelta_pack_writer_t *timedelta_pack_writer_base;
+
+  timedelta_pack_writer_base=NULL;
+  if((build_break_count==TIMEDELTA_PACK_BUILD_BREAK_COUNT)&&(build_feature_count<=TIMEDELTA_PACK_BUILD_FEATURE_COUNT)){
+    timedelta_pack_writer_base=(timedelta_pack_writer_t *)(DEBUG_CALLOC_PARANOID(sizeof(timedelta_pack_writer_t)));
+  }
+  status=1;
+  if(timedelta_pack_writer_base){
+/*
+Start with room for (2^10) blocks in the index, which will grow as needed.
+*/
+    timedelta_pack_writer_base->block_count_max=1U<<10;
+    timedelta_pack_writer_base->block_offset_list_base=(u64 *)(DEBUG_MALLOC_PARANOID((ULONG)(timedelta_pack_writer_base->block_count_max<<U64_SIZE_LOG2)));
+    timedelta_pack_writer_base->code_list_base=(u8 *)(DEBUG_MALLOC_PARANOID((ULONG)(TIMEDELTA_PACK_CODE_SIZE_MAX)<<TIMEDELTA_PACK_BLOCK_TIMEDELTA_COUNT_LOG2));
+    timedelta_pack_writer_base->file_offset=TIMEDELTA_PACK_HEADER_SIZE;
+    timedelta_pack_writer_base->handle=handle;
+    timedelta_pack_writer_base->timedelta_sample_size=timedelta_sample_size;
+    if(timedelta_pack_writer_base->block_offset_list_base&&timedelta_pack_writer_base->code_list_base){
+      memcpy(header_list_base, TIMEDELTA_PACK_SIGNATURE, (size_t)(TIMEDELTA_PACK_SIGNATURE_SIZE));
+      header_list_base[TIMEDELTA_PACK_SIGNATURE_SIZE]=timedelta_sample_size;
+      header_list_base[TIMEDELTA_PACK_SIGNATURE_SIZE+1]=TIMEDELTA_PACK_BLOCK_TIMEDELTA_COUNT_LOG2;
+      status=(fwrite(header_list_base, (size_t)(U8_SIZE), (size_t)(TIMEDELTA_PACK_HEADER_SIZE), handle)!=TIMEDELTA_PACK_HEADER_SIZE);
+    }
+  }
+  if(status){
+    timedelta_pack_writer_base=timedelta_pack_writer_free(timedelta_pack_writer_base);
+  }
+  return timedelta_pack_writer_base;
+}
+
+u8
+timedelta_pack_block_write(u64 timedelta_count, u8 *timedelta_u8_list_base, timedelta_pack_writer_t *timedelta_pack_writer_base){
+/*
+Code a block of timedeltas and write it to a packed timedelta file.
+
+In:
+
+  timedelta_count is the number of timedeltas in the block, on [1, (2^TIMEDELTA_PACK_BLOCK_TIMEDELTA_COUNT_LOG2)]. Only the last block may have fewer than the maximum.
+
+  *timedelta_u8_list_base is as defined in timedelta_pack_block_encode():In.
+
+  *timedelta_pack_writer_base is as returned by timedelta_pack_writer_init().
+
+Out:
+
+  Returns one if timedelta_count is invalid or follows a partial block, or if we failed to allocate memory or to write the block, else zero.
+
+  *timedelta_pack_writer_base has been updated to reflect the block.
+*/
+  u64 *block_offset_list_base;
+  u64 code_size;
+  u8 status;
+
+  status=(!timedelta_count)||((1ULL<<TIMEDELTA_PACK_BLOCK_TIMEDELTA_COUNT_LOG2)<timedelta_count)||timedelta_pack_writer_base->partial_status;
+  if((!status)&&(timedelta_pack_writer_base->block_count==timedelta_pack_writer_base->block_count_max)){
+    block_offset_list_base=(u64 *)(DEBUG_REALLOC_PARANOID(timedelta_pack_writer_base->block_offset_list_base, (ULONG)(timedelta_pack_writer_base->block_count_max<<(U64_SIZE_LOG2+1))));
+    status=!block_offset_list_base;
+    if(!status){
+      timedelta_pack_writer_base->block_count_max<<=1;
+      timedelta_pack_writer_base->block_offset_list_base=block_offset_list_base;
+    }
+  }
+  if(!status){
+    code_size=timedelta_pack_block_encode(timedelta_pack_writer_base->code_list_base, timedelta_count, timedelta_pack_writer_base->timedelta_sample_size, timedelta_u8_list_base);
+    status=(fwrite(timedelta_pack_writer_base->code_list_base, (size_t)(U8_SIZE), (size_t)(code_size), timedelta_pack_writer_base->handle)!=code_size);
+    if(!status){
+      timedelta_pack_writer_base->block_offset_list_base[timedelta_pack_writer_base->block_count]=timedelta_pack_writer_base->file_offset;
+      timedelta_pack_writer_base->block_count++;
+      timedelta_pack_writer_base->file_offset+=code_size;
+      timedelta_pack_writer_base->partial_status=(timedelta_count!=(1ULL<<TIMEDELTA_PACK_BLOCK_TIMEDELTA_COUNT_LOG2));
+      timedelta_pack_writer_base->timedelta_count+=timedelta_count;
+    }
+  }
+  return status;
+}
+
+u8
+timedelta_pack_writer_finish(timedelta_pack_writer_t *timedelta_pack_writer_base){
+/*
+Write the block index and trailer of a packed timedelta file.
+
+In:
+
+  *timedelta_pack_writer_base is as returned by timedelta_pack_writer_init(), after all blocks have been written.
+
+Out:
+
+  Returns one if the block index or trailer could not be written, else zero. The file is not closed.
+*/
+  u64 block_idx;
+  u8 status;
+  u8 trailer_list_base[TIMEDELTA_PACK_TRAILER_SIZE];
+
+  status=0;
+  block_idx=0;
+  while((!status)&&(block_idx!=timedelta_pack_writer_base->block_count)){
+    timedelta_pack_u64_put(trailer_list_base, timedelta_pack_writer_base->block_offset_list_base[block_idx]);
+    status=(fwrite(trailer_list_base, (size_t)(U8_SIZE), (size_t)(U64_SIZE), timedelta_pack_writer_base->handle)!=U64_SIZE);
+    block_idx++;
+  }
+  if(!status){
+    timedelta_pack_u64_put(&trailer_list_base[0], timedelta_pack_writer_base->file_offset);
+    timedelta_pack_u64_put(&trailer_list_base[U64_SIZE], timedelta_pack_writer_base->block_count);
+    timedelta_pack_u64_put(&trailer_list_base[U64_SIZE<<1], timedelta_pack_writer_base->timedelta_count);
+    memcpy(&trailer_list_base[U64_SIZE*3], TIMEDELTA_PACK_SIGNATURE, (size_t)(TIMEDELTA_PACK_SIGNATURE_SIZE));
+    status=(fwrite(trailer_list_base, (size_t)(U8_SIZE), (size_t)(TIMEDELTA_PACK_TRAILER_SIZE), timedelta_pack_writer_base->handle)!=TIMEDELTA_PACK_TRAILER_SIZE);
+  }
+  return status;
+}
@@ -0,0 +1,71 @@
+/*
+Enranda
+Copyright 2016 Russell Leidich
+http://enranda.blogspot.com
+
+This collection of files constitutes the Enranda Library. (This is a
+library in the abstact sense; it's not intended to compile to a ".lib"
+file.)
+
+The Enranda Library is free software: you can redistribute it and/or
+modify it under the terms of the GNU Limited General Public License as
+published by the Free Software Foundation, version 3.
+
+The Enranda Library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+Limited General Public License version 3 for more details.
+
+You should have received a copy of the GNU Limited General Public
+License version 3 along with the Enranda Library (filename
+"COPYING"). If not, see http://www.gnu.org/licenses/ .
+*/
+/*
+Timedelta Pack Library Data Structure
+*/
+/*
+A packed timedelta file consists of a header, blocks, a block index, and a trailer:
+
+  The header is the 8-byte TIMEDELTA_PACK_SIGNATURE, followed by one byte giving the size of each timedelta in bytes on [1, 8], and one byte giving TIMEDELTA_PACK_BLOCK_TIMEDELTA_COUNT_LOG2.
+
+  Each block codes (2^TIMEDELTA_PACK_BLOCK_TIMEDELTA_COUNT_LOG2) timedeltas, except that the last block may code fewer. Each timedelta is coded as the difference from its predecessor in the block, or from zero for the first one; in other words, as the delta-of-delta of the underlying timestamps. Each difference is zigzag coded, so that small negative and positive differences both become small unsigned integers, and then written as a little endian base-128 varint, with the high bit of each byte set if and only if another byte follows. Blocks are therefore independent of one another.
+
+  The block index is the file offset of each block, as a little endian u64.
+
+  The trailer is the file offset of the block index, the block count, and the timedelta count, each as a little endian u64, followed by TIMEDELTA_PACK_SIGNATURE again.
+
+Because timedeltas cluster tightly around a few values, most differences fit into a single byte.
+*/
+#define TIMEDELTA_PACK_BLOCK_TIMEDELTA_COUNT_LOG2 17U
+#define TIMEDELTA_PACK_CODE_SIZE_MAX 10U
+#define TIMEDELTA_PACK_HEADER_SIZE 10U
+#define TIMEDELTA_PACK_SIGNATURE "TDPACK01"
+#define TIMEDELTA_PACK_SIGNATURE_SIZE 8U
+#define TIMEDELTA_PACK_TRAILER_SIZE 32U
+/*
+timedelta_pack_reader_t is the state of a packed timedelta file open for reading; see timedelta_pack_reader_init(). block_offset_list_base is the block index, followed by the offset of the block index itself, so that block sizes can be computed by subtraction. code_list_base holds one coded block. timedelta_list_base holds one decoded block.
+*/
+TYPEDEF_START
+  u64 *block_offset_list_base;
+  u8 *code_list_base;
+  FILE *handle;
+  u64 *timedelta_list_base;
+  u64 block_count;
+  u64 timedelta_count;
+  u8 block_timedelta_count_log2;
+  u8 timedelta_sample_size;
+TYPEDEF_END(timedelta_pack_reader_t)
+/*
+timedelta_pack_writer_t is the state of a packed timedelta file open for writing; see timedelta_pack_writer_init(). block_offset_list_base is the block index so far, with room for block_count_max blocks. code_list_base holds one coded block. file_offset is the number of bytes written so far. partial_status is one after a block of fewer than (2^TIMEDELTA_PACK_BLOCK_TIMEDELTA_COUNT_LOG2) timedeltas has been written, which must be the last.
+*/
+TYPEDEF_START
+  u64 *block_offset_list_base;
+  u8 *code_list_base;
+  FILE *handle;
+  u64 block_count;
+  u64 block_count_max;
+  u64 file_offset;
+  u64 timedelta_count;
+  u8 partial_status;
+  u8 timedelta_sample_size;
+TYPEDEF_END(timedelta_pack_writer_t)
@@ -0,0 +1,34 @@
+/*
+Enranda
+Copyright 2016 Russell Leidich
+http://enranda.blogspot.com
+
+This collection of files constitutes the Enranda Library. (This is a
+library in the abstact sense; it's not intended to compile to a ".lib"
+file.)
+
+The Enranda Library is free software: you can redistribute it and/or
+modify it under the terms of the GNU Limited General Public License as
+published by the Free Software Foundation, version 3.
+
+The Enranda Library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+Limited General Public License version 3 for more details.
+
+You should have received a copy of the GNU Limited General Public
+License version 3 along with the Enranda Library (filename
+"COPYING"). If not, see http://www.gnu.org/licenses/ .
+*/
+extern u64 timedelta_pack_u64_get(u8 *u8_list_base);
+extern void timedelta_pack_u64_put(u8 *u8_list_base, u64 value);
+extern u64 timedelta_pack_block_encode(u8 *code_list_base, u64 timedelta_count, u8 timedelta_sample_size, u8 *timedelta_u8_list_base);
+extern u8 timedelta_pack_block_decode(u64 code_size, u8 *code_list_base, u64 timedelta_count, u64 *timedelta_list_base);
+extern void *timedelta_pack_reader_free(timedelta_pack_reader_t *timedelta_pack_reader_base);
+extern timedelta_pack_reader_t *timedelta_pack_reader_init(u32 build_break_count, u32 build_feature_count, char *filename_base);
+extern u64 timedelta_pack_block_read(u64 block_idx, timedelta_pack_reader_t *timedelta_pack_reader_base);
+extern u8 timedelta_pack_freq_list_accrue(u64 *freq_list_base, u64 mask_max, timedelta_pack_reader_t *timedelta_pack_reader_base);
+extern void *timedelta_pack_writer_free(timedelta_pack_writer_t *timedelta_pack_writer_base);
+extern timedelta_pack_writer_t *timedelta_pack_writer_init(u32 build_break_count, u32 build_feature_count, FILE *handle, u8 timedelta_sample_size);
+extern u8 timedelta_pack_block_write(u64 timedelta_count, u8 *timedelta_u8_list_base, timedelta_pack_writer_t *timedelta_pack_writer_base);
+extern u8 timedelta_pack_writer_finish(timedelta_pack_writer_t *timedelta_pack_writer_base);
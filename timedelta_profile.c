@@ -0,0 +1,385 @@
+/*
+Enranda
+Copyright 2016 Russell Leidich
+http://enranda.blogspot.com
+
+This collection of files constitutes the Enranda Library. (This is a
+library in the abstact sense; it's not intended to compile to a ".lib"
+file.)
+
+The Enranda Library is free software: you can redistribute it and/or
+modify it under the terms of the GNU Limited General Public License as
+published by the Free Software Foundation, version 3.
+
+The Enranda Library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+Limited General Public License version 3 for more details.
+
+You should have received a copy of the GNU Limited General Public
+License version 3 along with the Enranda Library (filename
+"COPYING"). If not, see http://www.gnu.org/licenses/ .
+*/
+/*
+Timedelta Profile Library
+
+This is the embeddable core of timedeltaprofile. It samples timedeltas in the calling thread for a given number of ticks at a time, and counts them in a full-width log-linear histogram as well as a frequency list of their low 16 bits, from which it can compute dyspoissonism. All memory is allocated by timedelta_profile_init(), so sampling and snapshots may be done at any time, for instance when a service is idle.
+*/
+#include "flag.h"
+#include "flag_dyspoissometer.h"
+#include "flag_timestamp.h"
+#include "flag_timedelta_profile.h"
+#include <math.h>
+#ifdef DYSPOISSOMETER_NUMBER_QUAD
+  #include <quadmath.h>
+#endif
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "constant.h"
+#include "debug.h"
+#include "debug_xtrn.h"
+#include "dyspoissometer.h"
+#include "dyspoissometer_xtrn.h"
+#include "timedelta_profile.h"
+#include "timestamp_xtrn.h"
+
+void
+timedelta_profile_bucket_list_accrue(u64 *bucket_list_base, u64 timedelta_idx_max, u64 *timedelta_list_base){
+/*
+Count timedeltas in a log-linear histogram.
+
+In:
+
+  *bucket_list_base contains (TIMEDELTA_PROFILE_BUCKET_IDX_MAX+1) bucket frequencies.
+
+  timedelta_idx_max is the number of timedeltas at timedelta_list_base, less one.
+
+  *timedelta_list_base contains the timedeltas.
+
+Out:
+
+  *bucket_list_base has been incremented at the bucket of each timedelta. A timedelta on [0, TIMEDELTA_PROFILE_BUCKET_EXACT_MAX] is counted in the bucket of the same index. Otherwise, it's right-shifted by the least shift which brings it onto that interval, yielding a mantissa on [(TIMEDELTA_PROFILE_BUCKET_EXACT_MAX+1)/2, TIMEDELTA_PROFILE_BUCKET_EXACT_MAX], and counted at index (mantissa+(shift<<(TIMEDELTA_PROFILE_BUCKET_BITS-1))).
+*/
+  u64 bucket_idx;
+  u8 shift;
+  u64 timedelta;
+  u64 timedelta_idx;
+
+  timedelta_idx=0;
+  do{
+    timedelta=timedelta_list_base[timedelta_idx];
+    bucket_idx=timedelta;
+    if(TIMEDELTA_PROFILE_BUCKET_EXACT_MAX<timedelta){
+      shift=1;
+      while(TIMEDELTA_PROFILE_BUCKET_EXACT_MAX<(timedelta>>shift)){
+        shift++;
+      }
+      bucket_idx=(timedelta>>shift)+((u64)(shift)<<(TIMEDELTA_PROFILE_BUCKET_BITS-1));
+    }
+    bucket_list_base[bucket_idx]++;
+  }while((timedelta_idx++)!=timedelta_idx_max);
+  return;
+}
+
+u64
+timedelta_profile_bucket_max_get(u32 bucket_idx){
+/*
+Get the greatest timedelta which would be counted in a given bucket.
+
+In:
+
+  bucket_idx is the bucket index, on [0, TIMEDELTA_PROFILE_BUCKET_IDX_MAX].
+
+Out:
+
+  Returns the greatest timedelta in the bucket, which is bucket_idx itself if bucket_idx is at most TIMEDELTA_PROFILE_BUCKET_EXACT_MAX.
+*/
+  u64 bucket_max;
+  u8 shift;
+
+  bucket_max=bucket_idx;
+  if(TIMEDELTA_PROFILE_BUCKET_EXACT_MAX<bucket_idx){
+    shift=(u8)((bucket_idx>>(TIMEDELTA_PROFILE_BUCKET_BITS-1))-1);
+    bucket_max=bucket_idx-((u64)(shift)<<(TIMEDELTA_PROFILE_BUCKET_BITS-1));
+/*
+In the last bucket, this wraps to U64_MAX, which is correct.
+*/
+    bucket_max=((bucket_max+1)<<shift)-1;
+  }
+  return bucket_max;
+}
+
+u8
+timedelta_profile_band_list_get(u64 *band_list_base, u64 *bucket_list_base){
+/*
+Count the timedeltas in a log-linear histogram by MSB.
+
+In:
+
+  *band_list_base is writable for U64_BITS items.
+
+  *bucket_list_base is as defined in timedelta_profile_bucket_list_accrue():Out.
+
+Out:
+
+  Returns the MSB of the greatest timedelta, or zero if there are none.
+
+  *band_list_base contains the number of timedeltas having each MSB, where zero is taken to have an MSB of zero.
+*/
+  u32 bucket_idx;
+  u64 freq;
+  u8 msb;
+  u8 msb_max;
+
+  memset(band_list_base, 0, (size_t)(U64_BITS<<U64_SIZE_LOG2));
+  msb_max=0;
+  bucket_idx=0;
+  do{
+    freq=bucket_list_base[bucket_idx];
+    if(freq){
+/*
+Every timedelta in a given bucket has the same MSB, which is that of bucket_idx below (TIMEDELTA_PROFILE_BUCKET_EXACT_MAX+1), else (shift+TIMEDELTA_PROFILE_BUCKET_BITS-1).
+*/
+      if(bucket_idx<=TIMEDELTA_PROFILE_BUCKET_EXACT_MAX){
+        msb=0;
+        while(1<(bucket_idx>>msb)){
+          msb++;
+        }
+      }else{
+        msb=(u8)((bucket_idx>>(TIMEDELTA_PROFILE_BUCKET_BITS-1))+TIMEDELTA_PROFILE_BUCKET_BITS-2);
+      }
+      band_list_base[msb]+=freq;
+      msb_max=msb;
+    }
+  }while((bucket_idx++)!=TIMEDELTA_PROFILE_BUCKET_IDX_MAX);
+  return msb_max;
+}
+
+u64
+timedelta_profile_percentile_get(u64 *bucket_list_base, u16 percentile_x100, u64 timedelta_count){
+/*
+Get a percentile of the timedeltas in a log-linear histogram.
+
+In:
+
+  *bucket_list_base is as defined in timedelta_profile_bucket_list_accrue():Out.
+
+  percentile_x100 is the percentile times 100, on [1, 10000]. For example, 9990 means the 99.9th percentile, and 10000 means the maximum.
+
+  timedelta_count is the sum of all frequencies at bucket_list_base, on [1, 2^50].
+
+Out:
+
+  Returns the greatest timedelta which could be in the bucket at which the cumulative frequency first reaches (timedelta_count*percentile_x100/10000), rounded up. This is exact up to TIMEDELTA_PROFILE_BUCKET_EXACT_MAX, and otherwise rounded up by less than 1/(2^(TIMEDELTA_PROFILE_BUCKET_BITS-1)).
+*/
+  u32 bucket_idx;
+  u64 freq_sum;
+  u64 rank;
+
+  rank=((timedelta_count*percentile_x100)+9999)/10000;
+  bucket_idx=0;
+  freq_sum=bucket_list_base[0];
+  while(freq_sum<rank){
+    bucket_idx++;
+    freq_sum+=bucket_list_base[bucket_idx];
+  }
+  return timedelta_profile_bucket_max_get(bucket_idx);
+}
+
+void *
+timedelta_profile_free(timedelta_profile_t *timedelta_profile_base){
+/*
+To maximize portability and debuggability, this is the only place where Timedelta Profile frees memory.
+
+In:
+
+  timedelta_profile_base is the return value of timedelta_profile_init(). May be NULL.
+
+Out:
+
+  Returns NULL so that the caller can easily maintain the good practice of NULLing out invalid pointers.
+
+  *timedelta_profile_base and all the lists which it owns are freed.
+*/
+  if(timedelta_profile_base){
+    DEBUG_FREE_PARANOID(timedelta_profile_base->bucket_list_base);
+  }
+  DEBUG_FREE_PARANOID(timedelta_profile_base);
+  return NULL;
+}
+
+void
+timedelta_profile_reset(timedelta_profile_t *timedelta_profile_base){
+/*
+Forget all timedeltas sampled so far.
+
+In:
+
+  *timedelta_profile_base is as returned by timedelta_profile_init().
+
+Out:
+
+  *timedelta_profile_base is as though no timedeltas had ever been sampled.
+*/
+  memset(timedelta_profile_base->bucket_list_base, 0, (size_t)((TIMEDELTA_PROFILE_BUCKET_IDX_MAX+1)<<U64_SIZE_LOG2));
+  memset(timedelta_profile_base->freq_list_base, 0, (size_t)(U16_SPAN<<U64_SIZE_LOG2));
+  timedelta_profile_base->timedelta_count=0;
+  return;
+}
+
+timedelta_profile_t *
+timedelta_profile_init(u32 build_break_count, u32 build_feature_count){
+/*
+Verify that the source code is sufficiently updated and initialize a timedelta profiler.
+
+To maximize portability and debuggability, this is the only place where Timedelta Profile allocates memory.
+
+In:
+
+  build_break_count is the caller's most recent knowledge of TIMEDELTA_PROFILE_BUILD_BREAK_COUNT, which will fail if the caller is unaware of all critical updates.
+
+  build_feature_count is the caller's most recent knowledge of TIMEDELTA_PROFILE_BUILD_FEATURE_COUNT, which will fail if this library is not up to date with the caller's expectations.
+
+Out:
+
+  Returns NULL if (build_break_count!=TIMEDELTA_PROFILE_BUILD_BREAK_COUNT); or (build_feature_count>TIMEDELTA_PROFILE_BUILD_FEATURE_COUNT); or if we failed to allocate memory. Otherwise, returns the base of a timedelta_profile_t containing no timedeltas, in which case, pass it to timedelta_profile_sample_for() and timedelta_profile_snapshot() from one thread at a time. After use, free it with timedelta_profile_free().
+*/
+  u64 *list_base;
+  timedelta_profile_t *timedelta_profile_base;
+
+  timedelta_profile_base=NULL;
+  if((build_break_count==TIMEDELTA_PROFILE_BUILD_BREAK_COUNT)&&(build_feature_count<=TIMEDELTA_PROFILE_BUILD_FEATURE_COUNT)){
+    timedelta_profile_base=(timedelta_profile_t *)(DEBUG_MALLOC_PARANOID(sizeof(timedelta_profile_t)));
+    if(timedelta_profile_base){
+/*
+Allocate all lists in one block, owned by bucket_list_base.
+*/
+      list_base=(u64 *)(DEBUG_MALLOC_PARANOID(((TIMEDELTA_PROFILE_BUCKET_IDX_MAX+1)+(U16_SPAN*3)+(TIMEDELTA_PROFILE_CHUNK_IDX_MAX+1))<<U64_SIZE_LOG2));
+      timedelta_profile_base->bucket_list_base=list_base;
+      if(list_base){
+        list_base+=TIMEDELTA_PROFILE_BUCKET_IDX_MAX+1;
+        timedelta_profile_base->freq_list_base=list_base;
+        list_base+=U16_SPAN;
+        timedelta_profile_base->freq_list0_base=list_base;
+        list_base+=U16_SPAN;
+        timedelta_profile_base->freq_list1_base=list_base;
+        list_base+=U16_SPAN;
+        timedelta_profile_base->timedelta_list_base=list_base;
+        timedelta_profile_reset(timedelta_profile_base);
+      }else{
+        timedelta_profile_base=timedelta_profile_free(timedelta_profile_base);
+      }
+    }
+  }
+  return timedelta_profile_base;
+}
+
+u64
+timedelta_profile_sample_for(u64 tick_count, timedelta_profile_t *timedelta_profile_base){
+/*
+Sample timedeltas in the calling thread for a given number of timestamp ticks, which are usually CPU cycles.
+
+In:
+
+  tick_count is the minimum number of ticks for which to sample. The actual number may slightly exceed it, including the time spent accruing the last chunk.
+
+  *timedelta_profile_base is as returned by timedelta_profile_init().
+
+Out:
+
+  Returns the number of timedeltas sampled, which is at least one.
+
+  *timedelta_profile_base contains the timedeltas as well.
+*/
+  u64 *bucket_list_base;
+  u64 *freq_list_base;
+  u64 time;
+  u64 time_start;
+  u64 timedelta;
+  u64 timedelta_count;
+  u64 timedelta_idx;
+  u64 *timedelta_list_base;
+
+  bucket_list_base=timedelta_profile_base->bucket_list_base;
+  freq_list_base=timedelta_profile_base->freq_list_base;
+  timedelta_list_base=timedelta_profile_base->timedelta_list_base;
+  timedelta_count=0;
+  time_start=timestamp_get();
+  do{
+    time=timestamp_get();
+    timedelta_idx=0;
+    do{
+      timedelta=time;
+      time=timestamp_get();
+      timedelta_list_base[timedelta_idx]=time-timedelta;
+    }while(((timedelta_idx++)!=TIMEDELTA_PROFILE_CHUNK_IDX_MAX)&&((time-time_start)<tick_count));
+    timedelta_count+=timedelta_idx;
+    timedelta_idx--;
+    timedelta_profile_bucket_list_accrue(bucket_list_base, timedelta_idx, timedelta_list_base);
+    do{
+      freq_list_base[(u16)(timedelta_list_base[timedelta_idx])]++;
+    }while(timedelta_idx--);
+  }while((time-time_start)<tick_count);
+  timedelta_profile_base->timedelta_count+=timedelta_count;
+  return timedelta_count;
+}
+
+u64
+timedelta_profile_snapshot(u64 *band_list_base, u64 *bucket_list_base, double *dyspoissonism_base, timedelta_profile_t *timedelta_profile_base){
+/*
+Get the statistics of all timedeltas sampled since the last reset, without disturbing them.
+
+In:
+
+  band_list_base is NULL or writable for U64_BITS items.
+
+  bucket_list_base is NULL or writable for (TIMEDELTA_PROFILE_BUCKET_IDX_MAX+1) items.
+
+  dyspoissonism_base is NULL or writable for one item.
+
+  *timedelta_profile_base is as returned by timedelta_profile_init().
+
+Out:
+
+  Returns the number of timedeltas sampled since the last reset.
+
+  *band_list_base, if not NULL, is as defined in timedelta_profile_band_list_get():Out.
+
+  *bucket_list_base, if not NULL, is as defined in timedelta_profile_bucket_list_accrue():Out, and may be passed to timedelta_profile_percentile_get().
+
+  *dyspoissonism_base, if not NULL, is the dyspoissonism of the low 16 bits of the timedeltas; or -1.0 if there are none, or too many for DYSPOISSOMETER_UINT.
+*/
+  DYSPOISSOMETER_NUMBER dyspoissonism;
+  DYSPOISSOMETER_UINT *freq_list0_base;
+  u64 *freq_list_base;
+  DYSPOISSOMETER_NUMBER logfreedom;
+  u64 timedelta_count;
+  u32 u16_idx;
+
+  timedelta_count=timedelta_profile_base->timedelta_count;
+  if(band_list_base){
+    timedelta_profile_band_list_get(band_list_base, timedelta_profile_base->bucket_list_base);
+  }
+  if(bucket_list_base){
+    memcpy(bucket_list_base, timedelta_profile_base->bucket_list_base, (size_t)((TIMEDELTA_PROFILE_BUCKET_IDX_MAX+1)<<U64_SIZE_LOG2));
+  }
+  if(dyspoissonism_base){
+    *dyspoissonism_base=-1.0f;
+    if(timedelta_count&&(timedelta_count<=DYSPOISSOMETER_UINT_MAX)){
+/*
+dyspoissometer_logfreedom_sparse_get() destroys its input, so give it a copy narrowed to DYSPOISSOMETER_UINT, which is no wider than u64. The scratch lists are sized for u64s, so they're big enough.
+*/
+      freq_list0_base=(DYSPOISSOMETER_UINT *)(timedelta_profile_base->freq_list0_base);
+      freq_list_base=timedelta_profile_base->freq_list_base;
+      u16_idx=0;
+      do{
+        freq_list0_base[u16_idx]=(DYSPOISSOMETER_UINT)(freq_list_base[u16_idx]);
+      }while((u16_idx++)!=U16_MAX);
+      logfreedom=dyspoissometer_logfreedom_sparse_get(freq_list0_base, (DYSPOISSOMETER_UINT *)(timedelta_profile_base->freq_list1_base), U16_MAX);
+      dyspoissonism=dyspoissometer_dyspoissonism_get(logfreedom, (DYSPOISSOMETER_UINT)(timedelta_count-1), U16_MAX);
+      *dyspoissonism_base=(double)(dyspoissonism);
+    }
+  }
+  return timedelta_count;
+}
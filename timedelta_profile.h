@@ -0,0 +1,46 @@
+/*
+Enranda
+Copyright 2016 Russell Leidich
+http://enranda.blogspot.com
+
+This collection of files constitutes the Enranda Library. (This is a
+library in the abstact sense; it's not intended to compile to a ".lib"
+file.)
+
+The Enranda Library is free software: you can redistribute it and/or
+modify it under the terms of the GNU Limited General Public License as
+published by the Free Software Foundation, version 3.
+
+The Enranda Library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+Limited General Public License version 3 for more details.
+
+You should have received a copy of the GNU Limited General Public
+License version 3 along with the Enranda Library (filename
+"COPYING"). If not, see http://www.gnu.org/licenses/ .
+*/
+/*
+Timedelta Profile Library Data Structure
+*/
+/*
+Timedeltas are counted in a log-linear histogram of (TIMEDELTA_PROFILE_BUCKET_IDX_MAX+1) buckets. Timedeltas up to TIMEDELTA_PROFILE_BUCKET_EXACT_MAX have one bucket each. Larger ones are right-shifted until they fit into TIMEDELTA_PROFILE_BUCKET_BITS bits, so each bucket spans less than 1/(2^(TIMEDELTA_PROFILE_BUCKET_BITS-1)) of its lower bound; see timedelta_profile_bucket_list_accrue().
+*/
+#define TIMEDELTA_PROFILE_BUCKET_BITS 8U
+#define TIMEDELTA_PROFILE_BUCKET_EXACT_MAX ((1U<<TIMEDELTA_PROFILE_BUCKET_BITS)-1)
+#define TIMEDELTA_PROFILE_BUCKET_IDX_MAX (((U64_BITS-TIMEDELTA_PROFILE_BUCKET_BITS)<<(TIMEDELTA_PROFILE_BUCKET_BITS-1))+TIMEDELTA_PROFILE_BUCKET_EXACT_MAX)
+/*
+TIMEDELTA_PROFILE_CHUNK_IDX_MAX is the number of timedeltas which are buffered before being accrued, less one. Each chunk begins with a fresh timestamp, so the time spent accruing does not contaminate the timedeltas.
+*/
+#define TIMEDELTA_PROFILE_CHUNK_IDX_MAX 0xFFFU
+/*
+timedelta_profile_t is the state of a timedelta profiler; see timedelta_profile_init(). bucket_list_base is the log-linear histogram. freq_list_base is the frequency list of the low 16 bits of each timedelta, from which dyspoissonism is computed, and freq_list0_base and freq_list1_base are scratch space for doing so. timedelta_list_base buffers one chunk. timedelta_count is the number of timedeltas sampled since the last reset.
+*/
+TYPEDEF_START
+  u64 *bucket_list_base;
+  u64 *freq_list0_base;
+  u64 *freq_list1_base;
+  u64 *freq_list_base;
+  u64 *timedelta_list_base;
+  u64 timedelta_count;
+TYPEDEF_END(timedelta_profile_t)
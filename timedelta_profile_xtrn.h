@@ -0,0 +1,31 @@
+/*
+Enranda
+Copyright 2016 Russell Leidich
+http://enranda.blogspot.com
+
+This collection of files constitutes the Enranda Library. (This is a
+library in the abstact sense; it's not intended to compile to a ".lib"
+file.)
+
+The Enranda Library is free software: you can redistribute it and/or
+modify it under the terms of the GNU Limited General Public License as
+published by the Free Software Foundation, version 3.
+
+The Enranda Library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+Limited General Public License version 3 for more details.
+
+You should have received a copy of the GNU Limited General Public
+License version 3 along with the Enranda Library (filename
+"COPYING"). If not, see http://www.gnu.org/licenses/ .
+*/
+extern void timedelta_profile_bucket_list_accrue(u64 *bucket_list_base, u64 timedelta_idx_max, u64 *timedelta_list_base);
+extern u64 timedelta_profile_bucket_max_get(u32 bucket_idx);
+extern u8 timedelta_profile_band_list_get(u64 *band_list_base, u64 *bucket_list_base);
+extern u64 timedelta_profile_percentile_get(u64 *bucket_list_base, u16 percentile_x100, u64 timedelta_count);
+extern void *timedelta_profile_free(timedelta_profile_t *timedelta_profile_base);
+extern void timedelta_profile_reset(timedelta_profile_t *timedelta_profile_base);
+extern timedelta_profile_t *timedelta_profile_init(u32 build_break_count, u32 build_feature_count);
+extern u64 timedelta_profile_sample_for(u64 tick_count, timedelta_profile_t *timedelta_profile_base);
+extern u64 timedelta_profile_snapshot(u64 *band_list_base, u64 *bucket_list_base, double *dyspoissonism_base, timedelta_profile_t *timedelta_profile_base);
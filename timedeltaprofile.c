@@ -26,18 +26,35 @@ Timedelta Profile with Dyspoissometer
 #include "flag.h"
 #include "flag_dyspoissometer.h"
 #include "flag_timestamp.h"
+#include "flag_timedelta_profile.h"
 #include "flag_timedeltaprofile.h"
+#ifndef WINDOWS
+  #define _GNU_SOURCE
+#endif
 #include <math.h>
 #ifdef DYSPOISSOMETER_NUMBER_QUAD
   #include <quadmath.h>
 #endif
+#include <pthread.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
+#ifdef WINDOWS
+  #include <fcntl.h>
+  #include <io.h>
+  #include <windows.h>
+#else
+  #include <sched.h>
+#endif
 #include "constant.h"
 #include "dyspoissometer.h"
 #include "dyspoissometer_xtrn.h"
+#include "dyspoissometer_any.h"
+#include "dyspoissometer_any_xtrn.h"
+#include "timedelta_profile.h"
+#include "timedelta_profile_xtrn.h"
 #include "timestamp_xtrn.h"
 
 #define MODE_DYSPOISSONISM 0
@@ -46,7 +63,81 @@ Timedelta Profile with Dyspoissometer
 #define MODE_MEAN_HEX 3
 #define MODE_HISTOGRAM 4
 #define MODE_HISTOGRAM_HEX 5
+#define MODE_PERCENTILE 6
+#define MODE_PERCENTILE_HEX 7
+#define MODE_BAND 8
+#define MODE_BAND_HEX 9
+/*
+MODE_DIVERGENCE is not selectable by number. It replaces MODE_BAND when "d=" is given; see timedeltaprofile_divergence_get().
+*/
+#define MODE_DIVERGENCE 10
 #define TIMEDELTA_COUNT_LOG2_MAX 48
+/*
+TIMEDELTAPROFILE_CHUNK_IDX_MAX is the number of timedeltas which are buffered before being accrued to the frequency list, less one. Each chunk begins with a fresh timestamp, so the time spent accruing does not contaminate the timedeltas.
+*/
+#define TIMEDELTAPROFILE_CHUNK_IDX_MAX 0xFFFU
+/*
+TIMEDELTAPROFILE_CPU_COUNT_MAX is one more than the highest CPU index which can be selected with the "c=" option.
+*/
+#define TIMEDELTAPROFILE_CPU_COUNT_MAX 0x400U
+/*
+TIMEDELTAPROFILE_CPU_IDX_ALL and TIMEDELTAPROFILE_CPU_IDX_NONE are the cpu_idx values output for statistics which cover all selected CPUs, and for samplers which were not pinned to any particular CPU, respectively.
+*/
+#define TIMEDELTAPROFILE_CPU_IDX_ALL (U32_MAX-1)
+#define TIMEDELTAPROFILE_CPU_IDX_NONE U32_MAX
+/*
+TIMEDELTAPROFILE_FORMAT_* are the output formats selected by the "f=" option.
+*/
+#define TIMEDELTAPROFILE_FORMAT_TEXT 0
+#define TIMEDELTAPROFILE_FORMAT_BINARY 1
+#define TIMEDELTAPROFILE_FORMAT_JSON 2
+#define TIMEDELTAPROFILE_OPTION_COUNT 7
+/*
+TIMEDELTAPROFILE_PERCENTILE_COUNT is the number of percentiles reported in MODE_PERCENTILE and MODE_PERCENTILE_HEX; see timedeltaprofile_freq_list_report().
+*/
+#define TIMEDELTAPROFILE_PERCENTILE_COUNT 6U
+/*
+TIMEDELTAPROFILE_STDOUT_BUFFER_SIZE is the size of the stdout buffer with "f=b" or "f=j", which is flushed only once per output cycle.
+*/
+#define TIMEDELTAPROFILE_STDOUT_BUFFER_SIZE 0x10000U
+/*
+timedeltaprofile_sampler_t is the state of a sampler thread pinned to the CPU at cpu_idx; see timedeltaprofile_sampler_run().
+*/
+TYPEDEF_START
+  u64 *freq_list_base;
+  u64 timedelta_count;
+  u32 cpu_idx;
+  u8 lane_idx_max;
+  u8 mode;
+  u8 status;
+TYPEDEF_END(timedeltaprofile_sampler_t)
+/*
+timedeltaprofile_pipeline_t is the state shared between the producer thread, which samples into the frequency list at freq_list0_base or freq_list1_base, and the consumer thread, which analyzes the other; see timedeltaprofile_producer_run(). lane_idx_max0 and lane_idx_max1 are the respective lane counts, less one, which may differ because each list falls back to a single lane independently. All fields after mutex_base are protected by *mutex_base. pending_status is one while the frequency list at freq_list_idx has been filled but not yet released by the consumer. quit_status is one when the consumer wants the producer to exit.
+*/
+TYPEDEF_START
+  pthread_cond_t *cond_base;
+  u64 *freq_list0_base;
+  u64 *freq_list1_base;
+  u64 timedelta_count;
+  u8 lane_idx_max0;
+  u8 lane_idx_max1;
+  u8 mode;
+  pthread_mutex_t *mutex_base;
+  u8 freq_list_idx;
+  u8 pending_status;
+  u8 quit_status;
+TYPEDEF_END(timedeltaprofile_pipeline_t)
+/*
+timedeltaprofile_record_t is the header of each record output with "f=b", which is immediately followed by value_count doubles. time is the Unix time in seconds, and timestamp is the CPU timestamp, both as of the output. timedelta_count is the number of timedeltas covered. cpu_idx is the CPU index, TIMEDELTAPROFILE_CPU_IDX_ALL, or TIMEDELTAPROFILE_CPU_IDX_NONE. mode is MODE_DYSPOISSONISM, MODE_MEAN, MODE_HISTOGRAM, MODE_PERCENTILE, MODE_BAND, or MODE_DIVERGENCE, and the values are respectively the dyspoissonism, the mean timedelta, the normalized population of each log2 frequency band, the percentiles, the normalized population of each log2 timedelta band, or the divergence from the baseline.
+*/
+TYPEDEF_START
+  u64 time;
+  u64 timestamp;
+  u64 timedelta_count;
+  u32 cpu_idx;
+  u8 mode;
+  u8 value_count;
+TYPEDEF_END(timedeltaprofile_record_t)
 
 void
 timedeltaprofile_newline_printf(void){
@@ -66,56 +157,949 @@ timedeltaprofile_u64_printf(u64 value){
   return;
 }
 
+void
+timedeltaprofile_timedelta_list_sample(u64 timedelta_idx_max, u16 *timedelta_list_base){
+/*
+Sample a chunk of timedeltas, starting with a fresh timestamp so that whatever the caller did in the meantime does not contaminate the first timedelta.
+
+In:
+
+  timedelta_idx_max is the number of timedeltas to sample, less one, on [0, TIMEDELTAPROFILE_CHUNK_IDX_MAX].
+
+  *timedelta_list_base is writable for (timedelta_idx_max+1) items.
+
+Out:
+
+  *timedelta_list_base contains the low 16 bits of (timedelta_idx_max+1) successive timedeltas.
+*/
+  u16 time;
+  u16 timedelta;
+  u64 timedelta_idx;
+
+  time=(u16)(timestamp_get());
+  timedelta_idx=0;
+  do{
+    timedelta=time;
+    time=(u16)(timestamp_get());
+    timedelta_list_base[timedelta_idx]=(u16)(time-timedelta);
+  }while((timedelta_idx++)!=timedelta_idx_max);
+  return;
+}
+
+void
+timedeltaprofile_freq_list_sample(u64 *freq_list_base, u8 lane_idx_max, u64 timedelta_count){
+/*
+Sample timedeltas on the calling thread and count the frequencies of their low 16 bits.
+
+In:
+
+  *freq_list_base is as returned by timedeltaprofile_list_malloc() with a mode less than MODE_PERCENTILE.
+
+  lane_idx_max is the corresponding lane count, less one.
+
+  timedelta_count is the number of timedeltas to sample.
+
+Out:
+
+  *freq_list_base contains the frequencies of the timedeltas, merged into lane zero.
+*/
+  u64 timedelta_counter;
+  u64 timedelta_idx_max;
+  u16 timedelta_list_base[TIMEDELTAPROFILE_CHUNK_IDX_MAX+1];
+
+  dyspoissometer_uint_list_zero((u64)((((u64)(lane_idx_max)+1)<<U16_BITS)-1), freq_list_base);
+  timedelta_counter=timedelta_count;
+  do{
+    timedelta_idx_max=TIMEDELTAPROFILE_CHUNK_IDX_MAX;
+    if(timedelta_counter<=TIMEDELTAPROFILE_CHUNK_IDX_MAX){
+      timedelta_idx_max=timedelta_counter-1;
+    }
+    timedeltaprofile_timedelta_list_sample(timedelta_idx_max, timedelta_list_base);
+    dyspoissometer_freq_list_accrue(freq_list_base, lane_idx_max, timedelta_idx_max, 0, U16_MAX, timedelta_list_base, NULL, NULL, NULL, NULL);
+    timedelta_counter-=timedelta_idx_max+1;
+  }while(timedelta_counter);
+  dyspoissometer_freq_list_merge(freq_list_base, lane_idx_max, U16_MAX);
+  return;
+}
+
+void
+timedeltaprofile_bucket_list_sample(u64 *bucket_list_base, u64 timedelta_count){
+/*
+Sample full 64-bit timedeltas on the calling thread and count them in a log-linear histogram, so that long stalls are measured rather than wrapped.
+
+In:
+
+  *bucket_list_base is writable for (TIMEDELTA_PROFILE_BUCKET_IDX_MAX+1) items.
+
+  timedelta_count is the number of timedeltas to sample.
+
+Out:
+
+  *bucket_list_base is as defined in timedelta_profile_bucket_list_accrue():Out, with frequencies summing to timedelta_count.
+*/
+  u64 time;
+  u64 timedelta;
+  u64 timedelta_counter;
+  u64 timedelta_idx;
+  u64 timedelta_idx_max;
+  u64 timedelta_list_base[TIMEDELTAPROFILE_CHUNK_IDX_MAX+1];
+
+  dyspoissometer_uint_list_zero(TIMEDELTA_PROFILE_BUCKET_IDX_MAX, bucket_list_base);
+  timedelta_counter=timedelta_count;
+  do{
+    timedelta_idx_max=TIMEDELTAPROFILE_CHUNK_IDX_MAX;
+    if(timedelta_counter<=TIMEDELTAPROFILE_CHUNK_IDX_MAX){
+      timedelta_idx_max=timedelta_counter-1;
+    }
+    time=timestamp_get();
+    timedelta_idx=0;
+    do{
+      timedelta=time;
+      time=timestamp_get();
+      timedelta_list_base[timedelta_idx]=time-timedelta;
+    }while((timedelta_idx++)!=timedelta_idx_max);
+    timedelta_profile_bucket_list_accrue(bucket_list_base, timedelta_idx_max, timedelta_list_base);
+    timedelta_counter-=timedelta_idx_max+1;
+  }while(timedelta_counter);
+  return;
+}
+
+u64 *
+timedeltaprofile_list_malloc(u8 *lane_idx_max_base, u8 mode, u64 timedelta_count){
+/*
+Allocate a list suitable for timedeltaprofile_list_sample().
+
+In:
+
+  *lane_idx_max_base is undefined.
+
+  mode is MODE_* as documented in the usage text.
+
+  timedelta_count is the number of timedeltas to be sampled into the list at once.
+
+Out:
+
+  Returns NULL if we ran out of memory, else the base of the list, which must eventually be freed via dyspoissometer_free().
+
+  *lane_idx_max_base is the lane count of the list, less one, which is zero unless mode is less than MODE_PERCENTILE.
+*/
+  u64 *list_base;
+
+  *lane_idx_max_base=0;
+  if(mode<MODE_PERCENTILE){
+    list_base=dyspoissometer_freq_list_lane_malloc_zero(1, lane_idx_max_base, timedelta_count-1, U16_MAX);
+    if(!list_base){
+      list_base=dyspoissometer_uint_list_malloc_zero(U16_MAX);
+    }
+  }else{
+    list_base=dyspoissometer_uint_list_malloc(TIMEDELTA_PROFILE_BUCKET_IDX_MAX);
+  }
+  return list_base;
+}
+
+void
+timedeltaprofile_list_sample(u64 *list_base, u8 lane_idx_max, u8 mode, u64 timedelta_count){
+/*
+Sample timedeltas on the calling thread into the kind of list required by mode.
+
+In:
+
+  *list_base and lane_idx_max are as returned by timedeltaprofile_list_malloc().
+
+  mode is MODE_* as documented in the usage text.
+
+  timedelta_count is the number of timedeltas to sample.
+
+Out:
+
+  If mode is less than MODE_PERCENTILE, then *list_base is as defined in timedeltaprofile_freq_list_sample():Out; else as defined in timedeltaprofile_bucket_list_sample():Out.
+*/
+  if(mode<MODE_PERCENTILE){
+    timedeltaprofile_freq_list_sample(list_base, lane_idx_max, timedelta_count);
+  }else{
+    timedeltaprofile_bucket_list_sample(list_base, timedelta_count);
+  }
+  return;
+}
+
+u64
+timedeltaprofile_window_sample(u64 timedelta_count, u64 timedelta_ring_idx, u64 timedelta_ring_idx_max, u16 *timedelta_ring_base, u64 *timedelta_sum_base, dyspoissometer_window_t *window_base){
+/*
+Sample timedeltas into a ring buffer, and feed them to a sliding window logfreedom tracker. Until the ring is full, each timedelta enters the window; thereafter, each one also evicts the oldest timedelta in the ring, so that the window always contains the most recent (timedelta_ring_idx_max+1) of them.
+
+In:
+
+  timedelta_count is the number of timedeltas to sample.
+
+  timedelta_ring_idx is the index at which to store the next timedelta in *timedelta_ring_base.
+
+  timedelta_ring_idx_max is one less than the size of *timedelta_ring_base, which must be one less than a power of 2.
+
+  *timedelta_ring_base contains the timedeltas in the window.
+
+  *timedelta_sum_base is the sum of the timedeltas in the window.
+
+  *window_base is as returned by dyspoissometer_window_init() with a mask_idx_max of timedelta_ring_idx_max and a mask_max of U16_MAX, and contains the timedeltas in *timedelta_ring_base.
+
+Out:
+
+  Returns the updated timedelta_ring_idx.
+
+  *timedelta_ring_base, *timedelta_sum_base, and *window_base are updated to reflect the new timedeltas.
+*/
+  u64 timedelta_counter;
+  u64 timedelta_idx;
+  u64 timedelta_idx_max;
+  u16 timedelta_list_base[TIMEDELTAPROFILE_CHUNK_IDX_MAX+1];
+  u16 timedelta_new;
+  u16 timedelta_old;
+  u64 timedelta_sum;
+
+  timedelta_counter=timedelta_count;
+  timedelta_sum=*timedelta_sum_base;
+  do{
+    timedelta_idx_max=TIMEDELTAPROFILE_CHUNK_IDX_MAX;
+    if(timedelta_counter<=TIMEDELTAPROFILE_CHUNK_IDX_MAX){
+      timedelta_idx_max=timedelta_counter-1;
+    }
+    timedeltaprofile_timedelta_list_sample(timedelta_idx_max, timedelta_list_base);
+    timedelta_idx=0;
+    do{
+      timedelta_new=timedelta_list_base[timedelta_idx];
+      timedelta_old=timedelta_ring_base[timedelta_ring_idx];
+      timedelta_ring_base[timedelta_ring_idx]=timedelta_new;
+      if(window_base->mask_count<=timedelta_ring_idx_max){
+        dyspoissometer_window_add(window_base, timedelta_new);
+        timedelta_sum+=timedelta_new;
+      }else{
+        dyspoissometer_window_slide(window_base, timedelta_new, timedelta_old);
+        timedelta_sum+=(u64)(timedelta_new)-timedelta_old;
+      }
+      timedelta_ring_idx=(timedelta_ring_idx+1)&timedelta_ring_idx_max;
+    }while((timedelta_idx++)!=timedelta_idx_max);
+    timedelta_counter-=timedelta_idx_max+1;
+  }while(timedelta_counter);
+  *timedelta_sum_base=timedelta_sum;
+  return timedelta_ring_idx;
+}
+
+void *
+timedeltaprofile_sampler_run(void *sampler_base){
+/*
+Thread entry point for sampling timedeltas on a particular CPU.
+
+In:
+
+  sampler_base is a (timedeltaprofile_sampler_t *) with all fields but status defined.
+
+Out:
+
+  Returns NULL.
+
+  sampler_base->status is one if the thread could not be pinned to sampler_base->cpu_idx, in which case nothing was sampled; else zero, in which case *sampler_base->freq_list_base is as defined in timedeltaprofile_list_sample():Out.
+*/
+  timedeltaprofile_sampler_t *sampler_base_typed;
+#ifdef WINDOWS
+  DWORD_PTR affinity_mask;
+#else
+  cpu_set_t cpu_set;
+#endif
+
+  sampler_base_typed=(timedeltaprofile_sampler_t *)(sampler_base);
+  sampler_base_typed->status=1;
+#ifdef WINDOWS
+  if(sampler_base_typed->cpu_idx<(sizeof(DWORD_PTR)<<U8_BITS_LOG2)){
+    affinity_mask=(DWORD_PTR)(1)<<sampler_base_typed->cpu_idx;
+    sampler_base_typed->status=!SetThreadAffinityMask(GetCurrentThread(), affinity_mask);
+  }
+#else
+  CPU_ZERO(&cpu_set);
+  CPU_SET(sampler_base_typed->cpu_idx, &cpu_set);
+  sampler_base_typed->status=!!sched_setaffinity(0, sizeof(cpu_set_t), &cpu_set);
+#endif
+  if(!sampler_base_typed->status){
+    timedeltaprofile_list_sample(sampler_base_typed->freq_list_base, sampler_base_typed->lane_idx_max, sampler_base_typed->mode, sampler_base_typed->timedelta_count);
+  }
+  return NULL;
+}
+
+void *
+timedeltaprofile_producer_run(void *pipeline_base){
+/*
+Thread entry point for sampling timedeltas into alternate frequency lists without pause, so that the consumer can analyze one while the other is being filled. The only gaps in coverage are the brief handoffs, plus any time spent waiting for a consumer which is slower than the sampling itself.
+
+In:
+
+  pipeline_base is a (timedeltaprofile_pipeline_t *) with pending_status and quit_status zero.
+
+Out:
+
+  Returns NULL after the consumer sets quit_status.
+*/
+  u64 *freq_list_base;
+  u8 freq_list_idx;
+  u8 lane_idx_max;
+  timedeltaprofile_pipeline_t *pipeline_base_typed;
+  u8 quit_status;
+
+  pipeline_base_typed=(timedeltaprofile_pipeline_t *)(pipeline_base);
+  freq_list_idx=0;
+  do{
+    freq_list_base=pipeline_base_typed->freq_list0_base;
+    lane_idx_max=pipeline_base_typed->lane_idx_max0;
+    if(freq_list_idx){
+      freq_list_base=pipeline_base_typed->freq_list1_base;
+      lane_idx_max=pipeline_base_typed->lane_idx_max1;
+    }
+    timedeltaprofile_list_sample(freq_list_base, lane_idx_max, pipeline_base_typed->mode, pipeline_base_typed->timedelta_count);
+/*
+Wait for the consumer to release the other frequency list, then hand over this one and start filling the other.
+*/
+    pthread_mutex_lock(pipeline_base_typed->mutex_base);
+    while(pipeline_base_typed->pending_status&&(!pipeline_base_typed->quit_status)){
+      pthread_cond_wait(pipeline_base_typed->cond_base, pipeline_base_typed->mutex_base);
+    }
+    quit_status=pipeline_base_typed->quit_status;
+    pipeline_base_typed->freq_list_idx=freq_list_idx;
+    pipeline_base_typed->pending_status=1;
+    pthread_cond_signal(pipeline_base_typed->cond_base);
+    pthread_mutex_unlock(pipeline_base_typed->mutex_base);
+    freq_list_idx=!freq_list_idx;
+  }while(!quit_status);
+  return NULL;
+}
+
+u8
+timedeltaprofile_cpu_list_parse(u8 *cpu_status_list_base, char *digit_list_base){
+/*
+Parse the value of the "c=" option.
+
+In:
+
+  *cpu_status_list_base is writable for TIMEDELTAPROFILE_CPU_COUNT_MAX items.
+
+  digit_list_base is the zero-terminated option value: either "a" for all CPUs on which this process is allowed to run, or a comma-separated list of decimal CPU indexes and inclusive ranges thereof, such as "0-3,8".
+
+Out:
+
+  Returns one if the value is invalid or selects no CPUs, else zero.
+
+  *cpu_status_list_base contains one at each selected CPU index, else zero.
+*/
+  u32 cpu_idx;
+  u32 cpu_idx_max;
+  u32 cpu_idx_min;
+  u8 cpu_status;
+  u8 digit;
+  u8 range_status;
+  u8 status;
+#ifdef WINDOWS
+  DWORD_PTR affinity_mask;
+  DWORD_PTR system_affinity_mask;
+#else
+  cpu_set_t cpu_set;
+#endif
+
+  memset(cpu_status_list_base, 0, (size_t)(TIMEDELTAPROFILE_CPU_COUNT_MAX));
+  cpu_status=0;
+  status=1;
+  if((digit_list_base[0]=='a')&&(!digit_list_base[1])){
+#ifdef WINDOWS
+    if(GetProcessAffinityMask(GetCurrentProcess(), &affinity_mask, &system_affinity_mask)){
+      cpu_idx=0;
+      while(affinity_mask){
+        cpu_status_list_base[cpu_idx]=(u8)(affinity_mask&1);
+        cpu_status=(u8)(cpu_status|cpu_status_list_base[cpu_idx]);
+        affinity_mask>>=1;
+        cpu_idx++;
+      }
+    }
+#else
+    if(!sched_getaffinity(0, sizeof(cpu_set_t), &cpu_set)){
+      cpu_idx=0;
+      do{
+        if(CPU_ISSET(cpu_idx, &cpu_set)){
+          cpu_status_list_base[cpu_idx]=1;
+          cpu_status=1;
+        }
+      }while((cpu_idx++)!=(TIMEDELTAPROFILE_CPU_COUNT_MAX-1));
+    }
+#endif
+    status=!cpu_status;
+  }else{
+/*
+Parse each index or range, i.e. one or 2 decimal numbers separated by "-", followed by "," or the terminating null.
+*/
+    do{
+      cpu_idx_min=0;
+      range_status=0;
+      do{
+        cpu_idx_max=0;
+        digit=(u8)(*digit_list_base-'0');
+        status=(9<digit);
+        while((!status)&&(digit<=9)){
+          cpu_idx_max=(cpu_idx_max*10)+digit;
+          status=(TIMEDELTAPROFILE_CPU_COUNT_MAX<=cpu_idx_max);
+          digit_list_base++;
+          digit=(u8)(*digit_list_base-'0');
+        }
+        if(status){
+          break;
+        }
+        if(!range_status){
+          cpu_idx_min=cpu_idx_max;
+          if(*digit_list_base=='-'){
+            digit_list_base++;
+            range_status=1;
+            continue;
+          }
+        }
+        range_status=0;
+      }while(range_status);
+      if(status||(cpu_idx_max<cpu_idx_min)||((*digit_list_base)&&(*digit_list_base!=','))){
+        status=1;
+        break;
+      }
+      cpu_idx=cpu_idx_min;
+      do{
+        cpu_status_list_base[cpu_idx]=1;
+      }while((cpu_idx++)!=cpu_idx_max);
+      cpu_status=1;
+    }while(*(digit_list_base++));
+  }
+  return status;
+}
+
+void
+timedeltaprofile_value_list_print(u32 cpu_idx, u8 csv_status, u8 format, u8 mode, u64 timedelta_count, u8 value_idx_max, DYSPOISSOMETER_NUMBER *value_list_base){
+/*
+Display a statistic in the selected output format.
+
+In:
+
+  cpu_idx is the index of the CPU to which the sampler was pinned, TIMEDELTAPROFILE_CPU_IDX_ALL if the statistic covers all selected CPUs, or TIMEDELTAPROFILE_CPU_IDX_NONE if the sampler was not pinned.
+
+  csv_status is one to display histogram bands on a single line separated by commas, else zero to display them one per line. Ignored unless format is TIMEDELTAPROFILE_FORMAT_TEXT.
+
+  format is TIMEDELTAPROFILE_FORMAT_*.
+
+  mode is MODE_* as documented in the usage text.
+
+  timedelta_count is the number of timedeltas which the statistic covers.
+
+  value_idx_max is the number of values, less one. It's zero if mode is less than MODE_HISTOGRAM or is MODE_DIVERGENCE, (TIMEDELTAPROFILE_PERCENTILE_COUNT-1) for MODE_PERCENTILE or MODE_PERCENTILE_HEX, else the maximum MSB.
+
+  *value_list_base contains the dyspoissonism, the mean timedelta, the normalized histogram band populations, the percentiles, or the divergence, depending on mode.
+
+Out:
+
+  The statistic has been written to stdout, which the caller must flush in order to ensure timely output.
+*/
+  char *name_base;
+  u8 list_status;
+  char *percentile_name_list_base[TIMEDELTAPROFILE_PERCENTILE_COUNT]={"p50", "p90", "p99", "p99.9", "p99.99", "max"};
+  timedeltaprofile_record_t record;
+  double value;
+  u8 value_idx;
+
+  list_status=(u8)((MODE_HISTOGRAM<=mode)&&(mode!=MODE_DIVERGENCE));
+  value_idx=0;
+  switch(format){
+  case TIMEDELTAPROFILE_FORMAT_TEXT:
+    do{
+      if((mode==MODE_PERCENTILE)||(mode==MODE_PERCENTILE_HEX)){
+        printf("%s: ", percentile_name_list_base[value_idx]);
+      }else if(list_status){
+        printf("%02d: ", value_idx);
+      }
+      switch(mode){
+      case MODE_DYSPOISSONISM:
+      case MODE_MEAN:
+      case MODE_HISTOGRAM:
+      case MODE_PERCENTILE:
+      case MODE_BAND:
+      case MODE_DIVERGENCE:
+        timedeltaprofile_double_printf((double)(value_list_base[value_idx]));
+        break;
+      case MODE_DYSPOISSONISM_HEX:
+      case MODE_HISTOGRAM_HEX:
+      case MODE_BAND_HEX:
+/*
+This is exact in quad precision, so the hex output is the same as shifting the population left by (U64_BIT_MAX-msb_max) whenever timedelta_count is a power of 2.
+*/
+        timedeltaprofile_u64_printf((u64)(value_list_base[value_idx]*U64_SPAN_HALF));
+        break;
+      case MODE_MEAN_HEX:
+      case MODE_PERCENTILE_HEX:
+        timedeltaprofile_u64_printf((u64)(value_list_base[value_idx]));
+        break;
+      }
+      if(list_status){
+        if(csv_status&&(value_idx!=value_idx_max)){
+          printf(", ");
+        }else{
+          timedeltaprofile_newline_printf();
+        }
+      }
+    }while((value_idx++)!=value_idx_max);
+    if(list_status&&(!csv_status)){
+      timedeltaprofile_newline_printf();
+    }
+    break;
+  case TIMEDELTAPROFILE_FORMAT_BINARY:
+/*
+Write a timedeltaprofile_record_t followed by its values as doubles, all in native byte order. The hex modes are the same as their decimal equivalents, so only the latter are recorded.
+*/
+    record.cpu_idx=cpu_idx;
+    record.mode=(u8)(mode&~1U);
+    if(mode==MODE_DIVERGENCE){
+      record.mode=MODE_DIVERGENCE;
+    }
+    record.time=(u64)(time(NULL));
+    record.timedelta_count=timedelta_count;
+    record.timestamp=timestamp_get();
+    record.value_count=(u8)(value_idx_max+1);
+    fwrite(&record, sizeof(timedeltaprofile_record_t), 1, stdout);
+    do{
+      value=(double)(value_list_base[value_idx]);
+      fwrite(&value, sizeof(double), 1, stdout);
+    }while((value_idx++)!=value_idx_max);
+    break;
+  case TIMEDELTAPROFILE_FORMAT_JSON:
+    printf("{\"time\":%llu,\"timestamp\":%llu,\"timedelta_count\":%llu,\"cpu\":", (unsigned long long)(time(NULL)), (unsigned long long)(timestamp_get()), (unsigned long long)(timedelta_count));
+    if(cpu_idx==TIMEDELTAPROFILE_CPU_IDX_NONE){
+      printf("null");
+    }else if(cpu_idx==TIMEDELTAPROFILE_CPU_IDX_ALL){
+      printf("\"all\"");
+    }else{
+      printf("%u", (unsigned int)(cpu_idx));
+    }
+    name_base="band";
+    if(mode==MODE_DIVERGENCE){
+      name_base="divergence";
+    }else if(mode<=MODE_DYSPOISSONISM_HEX){
+      name_base="dyspoissonism";
+    }else if(mode<=MODE_MEAN_HEX){
+      name_base="mean";
+    }else if(mode<=MODE_HISTOGRAM_HEX){
+      name_base="histogram";
+    }else if(mode<=MODE_PERCENTILE_HEX){
+      name_base="percentile";
+    }
+    printf(",\"%s\":", name_base);
+    if(list_status){
+      printf("[");
+    }
+    do{
+/*
+Percentiles are whole numbers, which "%1.15E" would round beyond (10^16).
+*/
+      if((mode==MODE_PERCENTILE)||(mode==MODE_PERCENTILE_HEX)){
+        printf("%llu", (unsigned long long)(value_list_base[value_idx]));
+      }else{
+        printf("%1.15E", (double)(value_list_base[value_idx]));
+      }
+      if(value_idx!=value_idx_max){
+        printf(",");
+      }
+    }while((value_idx++)!=value_idx_max);
+    if(list_status){
+      printf("]");
+    }
+    printf("}\n");
+    break;
+  }
+  return;
+}
+
+double
+timedeltaprofile_divergence_get(u64 *baseline_list_base, u64 *bucket_list_base){
+/*
+Measure how far the log2 band fingerprint of some timedeltas has drifted from a baseline.
+
+In:
+
+  *baseline_list_base contains U64_BITS log2 band populations, not all zero, as defined in timedelta_profile_band_list_get():Out.
+
+  *bucket_list_base is as defined in timedelta_profile_bucket_list_accrue():Out, and contains at least one timedelta.
+
+Out:
+
+  Returns the Kullback-Leibler divergence, in bits, of the band distribution of *bucket_list_base from that of *baseline_list_base. Both distributions are smoothed by adding 1/2 to every band population, so that a band which is empty in one but not the other contributes a large but finite term. Zero means identical. Typical runs on the same machine differ by a small but nonzero amount due to sampling noise, which should be measured before choosing a drift threshold.
+*/
+  u64 band_list_base[U64_BITS];
+  double band_sum;
+  double baseline_sum;
+  double divergence;
+  u8 msb;
+  double p;
+  double q;
+
+  timedelta_profile_band_list_get(band_list_base, bucket_list_base);
+  band_sum=U64_BITS*0.5;
+  baseline_sum=U64_BITS*0.5;
+  msb=0;
+  do{
+    band_sum+=(double)(band_list_base[msb]);
+    baseline_sum+=(double)(baseline_list_base[msb]);
+  }while((msb++)!=U64_BIT_MAX);
+  divergence=0.0;
+  msb=0;
+  do{
+    p=((double)(band_list_base[msb])+0.5)/band_sum;
+    q=((double)(baseline_list_base[msb])+0.5)/baseline_sum;
+    divergence+=p*log2(p/q);
+  }while((msb++)!=U64_BIT_MAX);
+/*
+Rounding error can make the divergence of identical distributions slightly negative.
+*/
+  divergence=MAX(divergence, 0.0);
+  return divergence;
+}
+
+u8
+timedeltaprofile_freq_list_report(u64 *baseline_list_base, u32 cpu_idx, u8 csv_status, u8 format, u64 *freq_list_base, u8 mode, u8 precision, double threshold, u64 timedelta_count){
+/*
+Display the statistic selected by mode for a timedelta frequency list.
+
+In:
+
+  *baseline_list_base is as defined in timedeltaprofile_divergence_get():In if mode is MODE_DIVERGENCE, else ignored.
+
+  cpu_idx, csv_status, format, and mode are as defined in timedeltaprofile_value_list_print():In.
+
+  *freq_list_base contains (U16_MAX+1) timedelta frequencies which sum to timedelta_count if mode is less than MODE_PERCENTILE, else (TIMEDELTA_PROFILE_BUCKET_IDX_MAX+1) bucket frequencies as defined in timedeltaprofile_bucket_list_sample():Out.
+
+  precision is the DYSPOISSOMETER_PRECISION_* at which to compute dyspoissonism.
+
+  threshold is the divergence above which to report drift, or negative to never do so. Ignored unless mode is MODE_DIVERGENCE.
+
+  timedelta_count is the sum of all frequencies. The histogram bands are for MSB=(0 through floor(log2(timedelta_count))). The percentiles are the upper bounds of the buckets containing the 50th, 90th, 99th, 99.9th, 99.99th, and 100th percentiles, which are exact up to TIMEDELTA_PROFILE_BUCKET_EXACT_MAX. The bands are for MSB=(0 through that of the greatest timedelta).
+
+Out:
+
+  Returns one if we ran out of memory, two if the divergence exceeded threshold, else zero.
+*/
+  double divergence;
+  double dyspoissonism;
+  u64 freq;
+  double logfreedom;
+  u8 msb;
+  u8 msb_max;
+  u16 percentile_idx;
+  u16 percentile_list_base[TIMEDELTAPROFILE_PERCENTILE_COUNT]={5000, 9000, 9900, 9990, 9999, 10000};
+  u8 status;
+  u16 timedelta;
+  u64 timedelta_log2_pop_list_base[U64_BITS];
+  u64 timedelta_sum;
+  u8 value_idx_max;
+  DYSPOISSOMETER_NUMBER value_list_base[U64_BITS];
+
+  status=0;
+  value_idx_max=0;
+  switch(mode){
+  case MODE_DYSPOISSONISM:
+  case MODE_DYSPOISSONISM_HEX:
+    logfreedom=dyspoissometer_any_u64_freq_list_logfreedom_get(&dyspoissonism, freq_list_base, U16_MAX, precision);
+    if(logfreedom<0.0f){
+      printf("ERROR: Out of memory!\n");
+      status=1;
+      break;
+    }
+    value_list_base[0]=dyspoissonism;
+    break;
+  case MODE_MEAN:
+  case MODE_MEAN_HEX:
+    timedelta_sum=0;
+    timedelta=0;
+    do{
+/*
+This won't overflow because timedelta_count is at most (2^TIMEDELTA_COUNT_LOG2_MAX), where (TIMEDELTA_COUNT_LOG2_MAX==48).
+*/
+      timedelta_sum+=timedelta*freq_list_base[timedelta];
+    }while((timedelta++)!=U16_MAX);
+    value_list_base[0]=timedelta_sum;
+    value_list_base[0]/=timedelta_count;
+    break;
+  case MODE_HISTOGRAM:
+  case MODE_HISTOGRAM_HEX:
+    msb_max=0;
+    while(1<(timedelta_count>>msb_max)){
+      msb_max++;
+    }
+    msb=0;
+    do{
+      timedelta_log2_pop_list_base[msb]=0;
+    }while((msb++)!=TIMEDELTA_COUNT_LOG2_MAX);
+    timedelta=0;
+    do{
+      freq=freq_list_base[timedelta];
+      msb=0;
+      while(1<(DYSPOISSOMETER_UINT)(freq>>msb)){
+        msb++;
+      }
+      timedelta_log2_pop_list_base[msb]+=freq;
+    }while((timedelta++)!=U16_MAX);
+    msb=0;
+    do{
+      value_list_base[msb]=timedelta_log2_pop_list_base[msb];
+      value_list_base[msb]/=timedelta_count;
+    }while((msb++)!=msb_max);
+    value_idx_max=msb_max;
+    break;
+  case MODE_PERCENTILE:
+  case MODE_PERCENTILE_HEX:
+    percentile_idx=0;
+    do{
+      value_list_base[percentile_idx]=timedelta_profile_percentile_get(freq_list_base, percentile_list_base[percentile_idx], timedelta_count);
+    }while((++percentile_idx)!=TIMEDELTAPROFILE_PERCENTILE_COUNT);
+    value_idx_max=TIMEDELTAPROFILE_PERCENTILE_COUNT-1;
+    break;
+  case MODE_BAND:
+  case MODE_BAND_HEX:
+    msb_max=timedelta_profile_band_list_get(timedelta_log2_pop_list_base, freq_list_base);
+    msb=0;
+    do{
+      value_list_base[msb]=timedelta_log2_pop_list_base[msb];
+      value_list_base[msb]/=timedelta_count;
+    }while((msb++)!=msb_max);
+    value_idx_max=msb_max;
+    break;
+  case MODE_DIVERGENCE:
+    divergence=timedeltaprofile_divergence_get(baseline_list_base, freq_list_base);
+    if((0.0<=threshold)&&(threshold<divergence)){
+      status=2;
+    }
+    value_list_base[0]=divergence;
+    break;
+  }
+  if(status!=1){
+    timedeltaprofile_value_list_print(cpu_idx, csv_status, format, mode, timedelta_count, value_idx_max, value_list_base);
+  }
+  return status;
+}
+
+void
+timedeltaprofile_window_report(u8 format, u8 mode, u64 timedelta_sum, dyspoissometer_window_t *window_base){
+/*
+Display the statistic selected by mode for the timedeltas in a sliding window.
+
+In:
+
+  format is TIMEDELTAPROFILE_FORMAT_*.
+
+  mode is MODE_DYSPOISSONISM, MODE_DYSPOISSONISM_HEX, MODE_MEAN, or MODE_MEAN_HEX.
+
+  timedelta_sum is the sum of the timedeltas in the window.
+
+  *window_base is as defined in timedeltaprofile_window_sample():Out, and contains at least one timedelta.
+
+Out:
+
+  *window_base may have been resynchronized as described in dyspoissometer_window_logfreedom_get().
+*/
+  DYSPOISSOMETER_NUMBER value;
+
+  if(mode<=MODE_DYSPOISSONISM_HEX){
+    dyspoissometer_window_logfreedom_get(&value, window_base);
+  }else{
+    value=timedelta_sum;
+    value/=window_base->mask_count;
+  }
+  timedeltaprofile_value_list_print(TIMEDELTAPROFILE_CPU_IDX_NONE, 0, format, mode, window_base->mask_count, 0, &value);
+  return;
+}
+
+u8
+timedeltaprofile_baseline_load(u64 *baseline_list_base, char *file_name_base){
+/*
+Load a baseline saved by timedeltaprofile_baseline_save().
+
+In:
+
+  *baseline_list_base is writable for U64_BITS items.
+
+  *file_name_base is the zero-terminated name of the baseline file.
+
+Out:
+
+  Returns one if the file could not be opened, was malformed, or contained no timedeltas, else zero.
+
+  *baseline_list_base contains the log2 band populations in the file.
+*/
+  FILE *file_base;
+  unsigned long long int freq;
+  u8 msb;
+  u8 status;
+
+  status=1;
+  file_base=fopen(file_name_base, "r");
+  if(file_base){
+    status=0;
+    msb=0;
+    do{
+      status=(fscanf(file_base, "%llu", &freq)!=1);
+      baseline_list_base[msb]=(u64)(freq);
+    }while((!status)&&((msb++)!=U64_BIT_MAX));
+    if(!status){
+      status=1;
+      msb=0;
+      do{
+        if(baseline_list_base[msb]){
+          status=0;
+        }
+      }while((msb++)!=U64_BIT_MAX);
+    }
+    fclose(file_base);
+  }
+  return status;
+}
+
+u8
+timedeltaprofile_baseline_save(u64 *baseline_list_base, u64 *bucket_list_base, char *file_name_base){
+/*
+Accrue the log2 band populations of some timedeltas to a baseline, then save it in its entirety.
+
+In:
+
+  *baseline_list_base contains U64_BITS log2 band populations, initially all zero.
+
+  *bucket_list_base is as defined in timedelta_profile_bucket_list_accrue():Out.
+
+  *file_name_base is the zero-terminated name of the baseline file, which will be overwritten.
+
+Out:
+
+  Returns one if the file could not be written, else zero.
+
+  *baseline_list_base has been incremented by the log2 band populations of *bucket_list_base.
+
+  The file contains *baseline_list_base as U64_BITS decimal numbers, one per line, so that it can be inspected or edited by hand, and remains valid if this program is interrupted before the next save.
+*/
+  u64 band_list_base[U64_BITS];
+  FILE *file_base;
+  u8 msb;
+  u8 status;
+
+  timedelta_profile_band_list_get(band_list_base, bucket_list_base);
+  msb=0;
+  do{
+    baseline_list_base[msb]+=band_list_base[msb];
+  }while((msb++)!=U64_BIT_MAX);
+  status=1;
+  file_base=fopen(file_name_base, "w");
+  if(file_base){
+    status=0;
+    msb=0;
+    do{
+      status=(u8)(status|(fprintf(file_base, "%llu\n", (unsigned long long)(baseline_list_base[msb]))<0));
+    }while((msb++)!=U64_BIT_MAX);
+    status=(u8)(status|!!fclose(file_base));
+  }
+  return status;
+}
+
 int
 main(int argc, char *argv[]){
+  u64 baseline_list_base[U64_BITS];
+  char *baseline_name_base;
+  pthread_cond_t cond;
   u8 continuous_status;
+  u32 cpu_count;
+  u32 cpu_idx;
+  u8 cpu_status_list_base[TIMEDELTAPROFILE_CPU_COUNT_MAX];
   u8 csv_status;
+  u8 detect_status;
   char *digit_list_base;
   u8 digit0;
   u8 digit1;
   u8 digit2;
-  DYSPOISSOMETER_NUMBER dyspoissonism;
-  u64 freq;
+  u8 drift_status;
   u64 *freq_list0_base;
   u64 *freq_list1_base;
+  u64 *freq_list_base;
+  u8 format;
+  u8 lane_idx_max;
+  u8 lane_idx_max0;
+  u8 lane_idx_max1;
+  u8 learn_status;
+  u32 list_idx;
+  u32 list_idx_max;
   u8 log2_valid_status;
-  DYSPOISSOMETER_NUMBER logfreedom;
-  u64 mask_idx_max;
   u8 mode;
-  u8 msb;
-  u64 pop;
-  DYSPOISSOMETER_NUMBER pop_normalized;
+  pthread_mutex_t mutex;
+  char *option_list_base;
+  u8 option_idx;
+  timedeltaprofile_pipeline_t pipeline;
+  u8 pipeline_status;
+  u8 precision;
+  pthread_t producer_thread;
+  timedeltaprofile_sampler_t *sampler_base;
+  u32 sampler_idx;
+  u32 sampler_idx_max;
+  timedeltaprofile_sampler_t *sampler_list_base;
+  u8 slide_count_log2;
+  u8 slide_status;
   u8 status;
-  u16 time;
-  u16 timedelta;
+  char *threshold_end_base;
+  double threshold;
+  pthread_t *thread_list_base;
+  u8 *thread_status_list_base;
   u64 timedelta_count;
   u8 timedelta_count_log2;
   u64 timedelta_counter;
-  u64 timedelta_log2_pop_list_base[TIMEDELTA_COUNT_LOG2_MAX+1];
-  DYSPOISSOMETER_NUMBER timedelta_mean;
+  u16 *timedelta_ring_base;
+  u64 timedelta_ring_idx;
   u64 timedelta_sum;
+  dyspoissometer_window_t window;
+  u8 window_status;
 
+  baseline_name_base=NULL;
+  cpu_count=0;
+  detect_status=0;
   freq_list0_base=NULL;
+  format=TIMEDELTAPROFILE_FORMAT_TEXT;
   freq_list1_base=NULL;
+  learn_status=0;
+  pipeline_status=0;
+  sampler_idx_max=0;
+  sampler_list_base=NULL;
+  slide_count_log2=0;
+  slide_status=0;
+  threshold=-1.0;
+  thread_list_base=NULL;
+  thread_status_list_base=NULL;
+  timedelta_ring_base=NULL;
+  window_status=0;
   do{
     status=1;
-    if(argc!=4){
+    if((argc<4)||((4+TIMEDELTAPROFILE_OPTION_COUNT)<argc)){
       printf("Timedelta Profile with Dyspoissometer\nCopyright 2016 Russell Leidich\nhttp://enranda.blogspot.com\n");
       printf("build_id_in_hex=%02X\n\n", TIMEDELTAPROFILE_BUILD_ID);
-      printf("Perform realtime statistical analysis of the low 16 bits of the differences\nbetween successive timestamps. See README.txt for important warnings.\n\n");
+      printf("Perform realtime statistical analysis of the differences between successive\ntimestamps, truncated to 16 bits except in modes 6 through 9. See README.txt\nfor important warnings.\n\n");
       printf("Syntax:\n\n");
-      printf("timedeltaprofile mode continuous timedelta_count_log2\n\n");
+      printf("timedeltaprofile mode continuous timedelta_count_log2 [option ...]\n\n");
       printf("where:\n\n");
       printf("mode tells what to display:\n\n");
-      printf("  0: Dyspoissonism of timedelta -- watch it drop under heavy load (more timing\n     entropy)!\n  1: Like 0, but expressed as a hex fraction where (2^63) is one\n  2: Mean of timedelta\n  3: Like 2, but rounded down and expressed in hex\n  4: Normalized histogram of log2(timedelta), for MSB=(0 through\n     timedelta_count_log2)\n  5: Like 4, but expressed as a hex fraction where (2^63) is one\n\n");
+      printf("  0: Dyspoissonism of timedelta -- watch it drop under heavy load (more timing\n     entropy)!\n  1: Like 0, but expressed as a hex fraction where (2^63) is one\n  2: Mean of timedelta\n  3: Like 2, but rounded down and expressed in hex\n  4: Normalized histogram of log2(timedelta), for MSB=(0 through\n     timedelta_count_log2)\n  5: Like 4, but expressed as a hex fraction where (2^63) is one\n  6: Percentiles (50, 90, 99, 99.9, 99.99, and 100) of the full 64-bit\n     timedelta, exact up to 255 and otherwise rounded up by less than 1/128\n  7: Like 6, but expressed in hex\n  8: Normalized histogram of the MSB of the full 64-bit timedelta, for\n     MSB=(0 through that of the greatest timedelta)\n  9: Like 8, but expressed as a hex fraction where (2^63) is one\n\n");
       printf("continuous is:\n\n");
-      printf("  0: Quit after a single iteration\n  1: Same as 0, but separate multiple values with commas (CSV format)\n  2: Continue output with timedelta_count_log2 timedeltas between updates until\n     Ctrl+C is pressed\n  3: Same as 2, but CSV format\n\n");
+      printf("  0: Quit after a single iteration\n  1: Same as 0, but separate multiple values with commas (CSV format)\n  2: Continue output with timedelta_count_log2 timedeltas between updates until\n     Ctrl+C is pressed\n  3: Same as 2, but CSV format\n  4: Same as 2, but sample continuously in one thread while analyzing the\n     previous timedeltas in another, so that no timedeltas are missed\n  5: Same as 4, but CSV format\n\n");
       printf("timedelta_count_log2 is the log of the number of timedeltas to sample between\noutputs. Low values produce inaccurate results, not the least of which because\nthe act of running this program temporarily changes the timedelta histogram of\nyour system. 24 is a reasonable starting value; allowed values are on [16, 48].\n\n");
+      printf("option is any of the following, in any order:\n\n");
+      printf("  p=q: Compute dyspoissonism in quad precision (default)\n  p=d: Compute dyspoissonism in double precision, which is faster but requires\n       timedelta_count_log2 to be at most 31\n  p=dd: Compute dyspoissonism in double-double precision, which is nearly as\n        accurate as quad but faster, and likewise requires timedelta_count_log2\n        to be at most 31\n");
+      printf("  c=a: Sample simultaneously on every CPU on which this program may run, each\n       in its own thread pinned to that CPU, in order to find noisy cores\n  c=list: Like c=a, but only on the CPUs in list, which consists of CPU indexes\n          and ranges thereof separated by commas, for example: c=0-3,8\n");
+      printf("  f=t: Output text as described here (default)\n  f=j: Output one JSON object per line, with time, timestamp, timedelta_count,\n       cpu, and dyspoissonism, mean, histogram (an array of band populations),\n       percentile (an array in the order given above), or band (likewise)\n  f=b: Output binary records, each consisting of a u64 Unix time, a u64 CPU\n       timestamp, a u64 timedelta count, a u32 CPU index (0xFFFFFFFE for all,\n       0xFFFFFFFF for none), a u8 mode (0, 2, 4, 6, or 8), a u8 value count,\n       and that many doubles, all in native byte order\n");
+      printf("  s=M: Continuously track the most recent (2^timedelta_count_log2) timedeltas\n       in a sliding window, and output after every (2^M) new ones, where M is\n       on [0, timedelta_count_log2]; only valid with modes 0 through 3\n");
+      printf("  l=file: Learn a baseline fingerprint, which is the population of each log2\n          band of the full 64-bit timedelta, and save it to file after every\n          output, accumulated over all outputs; only valid with modes 6\n          through 9\n  d=file: Instead of the bands of mode 8, output the Kullback-Leibler divergence\n          in bits of the bands from the baseline in file, which is zero if they\n          are identical; only valid with mode 8\n  t=T: With \"d=\", quit with exit status 2 as soon as the divergence exceeds T,\n       which is a nonnegative decimal number such as 0.1\n\n");
       printf("Notes:\n\n");
-      printf("All of the above can only be used for comparison purposes provided that\ntimedelta_count_log2 is held constant. Floating-point is internally quad\nprecision regardless of display mode, but at most double precision is\ndisplayed.\n\n");
+      printf("All of the above can only be used for comparison purposes provided that\ntimedelta_count_log2 is held constant. Floating-point is internally quad\nprecision regardless of display mode (except as specified by \"p=\"), but at\nmost double precision is displayed.\n\n");
+      printf("With \"c=\", timedelta_count_log2 applies to each CPU. The output for each CPU\nis labeled \"cpuN:\", and is followed by that of all CPUs combined, labeled\n\"all:\". The combined timedelta count must not exceed (2^48), nor the limit\nimposed by \"p=\". Histograms have one line per label in CSV format.\n\n");
+      printf("With \"s=\", the first output comes after the window is full. Dyspoissonism is\nthen updated in constant time per timedelta, always in quad precision, so \"p=\"\nhas no effect. \"s=\" cannot be combined with \"c=\".\n\n");
+      printf("With \"f=b\" or \"f=j\", modes 1, 3, 5, 7, and 9 are the same as 0, 2, 4, 6, and 8,\nand the continuous CSV variants are the same as their non-CSV equivalents.\nOutput is flushed once per update.\n\n");
+      printf("With \"d=\", the JSON name is \"divergence\" and the binary mode is 10. With \"c=\",\n\"l=\" learns from all CPUs combined, whereas \"d=\" compares each CPU and all\nof them combined with the baseline. Learn the baseline with the same\ntimedelta_count_log2 as that used with \"d=\", on an idle or otherwise typical\nmachine.\n\n");
       break;
     }
-    status=dyspoissometer_init(0, 0);
+    status=dyspoissometer_any_init(1, 0);
     if(status){
       printf("Dyspoissometer source code is outdated!\n");
       break;
@@ -123,13 +1107,13 @@ main(int argc, char *argv[]){
     status=1;
     digit_list_base=argv[1];
     mode=(u8)(digit_list_base[0]-'0');
-    if((MODE_HISTOGRAM_HEX<mode)||(digit_list_base[1])){
+    if((MODE_BAND_HEX<mode)||(digit_list_base[1])){
       printf("Invalid mode!\n");
       break;
     }
     digit_list_base=argv[2];
     continuous_status=(u8)(digit_list_base[0]-'0');
-    if((3<continuous_status)||(digit_list_base[1])){
+    if((5<continuous_status)||(digit_list_base[1])){
       printf("Invalid continuous flag!\n");
       break;
     }
@@ -172,114 +1156,423 @@ main(int argc, char *argv[]){
     }
     timedelta_count=1;
     timedelta_count<<=timedelta_count_log2;
-    freq_list0_base=dyspoissometer_uint_list_malloc(U16_MAX);
-    if(!freq_list0_base){
-      printf("ERROR: Out of memory!\n");
+/*
+Parse options, each of which is a letter followed by "=" and a value.
+*/
+    precision=DYSPOISSOMETER_PRECISION_QUAD;
+    option_idx=4;
+    while(option_idx<argc){
+      option_list_base=argv[option_idx];
+      if((!option_list_base[0])||(option_list_base[1]!='=')){
+        printf("ERROR: Invalid option syntax!\n");
+        break;
+      }
+      digit_list_base=&option_list_base[2];
+      if(option_list_base[0]=='p'){
+        if((digit_list_base[0]=='q')&&(!digit_list_base[1])){
+          precision=DYSPOISSOMETER_PRECISION_QUAD;
+        }else if((digit_list_base[0]=='d')&&(!digit_list_base[1])){
+          precision=DYSPOISSOMETER_PRECISION_DOUBLE;
+        }else if((digit_list_base[0]=='d')&&(digit_list_base[1]=='d')&&(!digit_list_base[2])){
+          precision=DYSPOISSOMETER_PRECISION_DD;
+        }else{
+          printf("ERROR: Invalid precision!\n");
+          break;
+        }
+      }else if(option_list_base[0]=='c'){
+        if(timedeltaprofile_cpu_list_parse(cpu_status_list_base, digit_list_base)){
+          printf("ERROR: Invalid CPU list!\n");
+          break;
+        }
+        cpu_count=0;
+        cpu_idx=0;
+        do{
+          cpu_count+=cpu_status_list_base[cpu_idx];
+        }while((cpu_idx++)!=(TIMEDELTAPROFILE_CPU_COUNT_MAX-1));
+      }else if(option_list_base[0]=='f'){
+        format=TIMEDELTAPROFILE_FORMAT_TEXT;
+        if((digit_list_base[0]=='b')&&(!digit_list_base[1])){
+          format=TIMEDELTAPROFILE_FORMAT_BINARY;
+        }else if((digit_list_base[0]=='j')&&(!digit_list_base[1])){
+          format=TIMEDELTAPROFILE_FORMAT_JSON;
+        }else if((digit_list_base[0]!='t')||(digit_list_base[1])){
+          printf("ERROR: Invalid output format!\n");
+          break;
+        }
+      }else if((option_list_base[0]=='d')||(option_list_base[0]=='l')){
+        if(!digit_list_base[0]){
+          printf("ERROR: Invalid baseline file name!\n");
+          break;
+        }
+        baseline_name_base=digit_list_base;
+        if(option_list_base[0]=='d'){
+          detect_status=1;
+        }else{
+          learn_status=1;
+        }
+      }else if(option_list_base[0]=='t'){
+        threshold=strtod(digit_list_base, &threshold_end_base);
+        if((threshold_end_base==digit_list_base)||threshold_end_base[0]||(!(0.0<=threshold))){
+          printf("ERROR: Invalid threshold!\n");
+          break;
+        }
+      }else if(option_list_base[0]=='s'){
+        digit0=(u8)(digit_list_base[0]-'0');
+        digit1=(u8)(digit_list_base[1]-'0');
+        slide_count_log2=digit0;
+        if(digit_list_base[1]){
+          slide_count_log2=(u8)((digit0*10)+digit1);
+        }
+        if((9<digit0)||(digit_list_base[1]&&((9<digit1)||digit_list_base[2]))||(timedelta_count_log2<slide_count_log2)){
+          printf("ERROR: Invalid slide count!\n");
+          break;
+        }
+        slide_status=1;
+      }else{
+        printf("ERROR: Unknown option!\n");
+        break;
+      }
+      option_idx++;
+    }
+    if(option_idx!=argc){
       break;
     }
-    if((mode==MODE_DYSPOISSONISM)||(mode==MODE_DYSPOISSONISM_HEX)){
-      freq_list1_base=dyspoissometer_uint_list_malloc(U16_MAX);
-      if(!freq_list1_base){
-        printf("ERROR: Out of memory!\n");
+    if((continuous_status==2)&&(cpu_count||slide_status)){
+      printf("ERROR: Continuous modes 4 and 5 exclude \"c=\" and \"s=\"!\n");
+      break;
+    }
+    if(slide_status&&(cpu_count||(MODE_MEAN_HEX<mode))){
+      printf("ERROR: \"s=\" requires mode 0 through 3, and excludes \"c=\"!\n");
+      break;
+    }
+    if(detect_status&&learn_status){
+      printf("ERROR: \"d=\" and \"l=\" are mutually exclusive!\n");
+      break;
+    }
+    if(learn_status&&(mode<MODE_PERCENTILE)){
+      printf("ERROR: \"l=\" requires mode 6 through 9!\n");
+      break;
+    }
+    if(detect_status&&(mode!=MODE_BAND)){
+      printf("ERROR: \"d=\" requires mode 8!\n");
+      break;
+    }
+    if((0.0<=threshold)&&(!detect_status)){
+      printf("ERROR: \"t=\" requires \"d=\"!\n");
+      break;
+    }
+    if(detect_status){
+      if(timedeltaprofile_baseline_load(baseline_list_base, baseline_name_base)){
+        printf("ERROR: Could not load a valid baseline from %s!\n", baseline_name_base);
         break;
       }
+      mode=MODE_DIVERGENCE;
     }
-    status=0;
-    do{
-      dyspoissometer_uint_list_zero(U16_MAX, freq_list0_base);
+    if(learn_status){
+      memset(baseline_list_base, 0, sizeof(baseline_list_base));
+    }
+    if(cpu_count&&(((1ULL<<TIMEDELTA_COUNT_LOG2_MAX)>>timedelta_count_log2)<cpu_count)){
+      printf("ERROR: Too many CPUs for timedelta_count_log2!\n");
+      break;
+    }
+/*
+The implied mask count, which is timedelta_count (times cpu_count, if nonzero), must fit into DYSPOISSOMETER_UINT at the selected precision.
+*/
+    if((!slide_status)&&(dyspoissometer_any_uint_max_get(precision)<(timedelta_count*MAX(cpu_count, 1)))){
+      printf("ERROR: timedelta_count_log2 is too large for the selected precision!\n");
+      break;
+    }
+    if(format!=TIMEDELTAPROFILE_FORMAT_TEXT){
+/*
+Buffer each output cycle in its entirety, so that it costs one write.
+*/
+#ifdef WINDOWS
+      if(format==TIMEDELTAPROFILE_FORMAT_BINARY){
+        _setmode(_fileno(stdout), _O_BINARY);
+      }
+#endif
+      setvbuf(stdout, NULL, _IOFBF, (size_t)(TIMEDELTAPROFILE_STDOUT_BUFFER_SIZE));
+    }
+    if(slide_status){
+      timedelta_ring_base=(u16 *)(malloc((size_t)(timedelta_count)*sizeof(u16)));
+      window_status=1;
+      status=dyspoissometer_window_init(timedelta_count-1, U16_MAX, &window);
+      if(status||(!timedelta_ring_base)){
+        printf("ERROR: Out of memory!\n");
+        status=1;
+        break;
+      }
+/*
+Fill the window, then slide it by (2^slide_count_log2) timedeltas between outputs. Because the window tracks its own frequency and population lists, this costs constant time per timedelta, regardless of the window size.
+*/
       timedelta_counter=timedelta_count;
-      time=0;
+      timedelta_ring_idx=0;
+      timedelta_sum=0;
       do{
-        timedelta=time;
-        time=(u16)(timestamp_get());
-        timedelta=(u16)(time-timedelta);
-        freq_list0_base[timedelta]++;
-        timedelta_counter--;
-      }while(timedelta_counter);
-      switch(mode){
-      case MODE_DYSPOISSONISM:
-      case MODE_DYSPOISSONISM_HEX:
-        logfreedom=dyspoissometer_logfreedom_sparse_get(freq_list0_base, freq_list1_base, U16_MAX);
-        mask_idx_max=timedelta_count-1;
-        dyspoissonism=dyspoissometer_dyspoissonism_get(logfreedom, mask_idx_max, U16_MAX);
-        if(mode==MODE_DYSPOISSONISM){
-          timedeltaprofile_double_printf((double)(dyspoissonism));
-        }else{
-          timedeltaprofile_u64_printf((u64)(dyspoissonism*(U64_SPAN_HALF)));
+        timedelta_ring_idx=timedeltaprofile_window_sample(timedelta_counter, timedelta_ring_idx, timedelta_count-1, timedelta_ring_base, &timedelta_sum, &window);
+        timedeltaprofile_window_report(format, mode, timedelta_sum, &window);
+        if(format==TIMEDELTAPROFILE_FORMAT_TEXT){
+          if(!csv_status){
+            timedeltaprofile_newline_printf();
+          }else{
+            printf(", ");
+          }
         }
+        fflush(stdout);
+        timedelta_counter=(u64)(1)<<slide_count_log2;
+      }while(continuous_status);
+      break;
+    }
+    if(!cpu_count){
+      freq_list0_base=timedeltaprofile_list_malloc(&lane_idx_max0, mode, timedelta_count);
+      lane_idx_max1=0;
+      if(continuous_status==2){
+        freq_list1_base=timedeltaprofile_list_malloc(&lane_idx_max1, mode, timedelta_count);
+      }
+      if(!(freq_list0_base&&((continuous_status!=2)||freq_list1_base))){
+        printf("ERROR: Out of memory!\n");
         break;
-      case MODE_MEAN:
-      case MODE_MEAN_HEX:
-        timedelta_sum=0;
-        timedelta=0;
-        do{
+      }
+      if(continuous_status==2){
 /*
-This won't overflow because (TIMEDELTA_COUNT_LOG2_MAX==48).
+Run the sampler as a producer thread, leaving this thread to consume and report each frequency list as it's filled.
 */
-          timedelta_sum+=timedelta*freq_list0_base[timedelta];
-        }while((timedelta++)!=U16_MAX);
-        timedelta_mean=timedelta_sum;
-        timedelta_mean/=timedelta_count;
-        if(mode==MODE_MEAN){
-          timedeltaprofile_double_printf((double)(timedelta_mean));
+        pipeline.cond_base=&cond;
+        pipeline.freq_list0_base=freq_list0_base;
+        pipeline.freq_list1_base=freq_list1_base;
+        pipeline.lane_idx_max0=lane_idx_max0;
+        pipeline.lane_idx_max1=lane_idx_max1;
+        pipeline.mode=mode;
+        pipeline.mutex_base=&mutex;
+        pipeline.pending_status=0;
+        pipeline.quit_status=0;
+        pipeline.timedelta_count=timedelta_count;
+        pthread_cond_init(&cond, NULL);
+        pthread_mutex_init(&mutex, NULL);
+        pipeline_status=1;
+        if(pthread_create(&producer_thread, NULL, timedeltaprofile_producer_run, &pipeline)){
+          printf("ERROR: Could not create sampler thread!\n");
+          break;
+        }
+        pipeline_status=2;
+      }
+      status=0;
+      do{
+        freq_list_base=freq_list0_base;
+        if(!pipeline_status){
+          timedeltaprofile_list_sample(freq_list_base, lane_idx_max0, mode, timedelta_count);
         }else{
-          timedeltaprofile_u64_printf((u64)(timedelta_mean));
+          pthread_mutex_lock(&mutex);
+          while(!pipeline.pending_status){
+            pthread_cond_wait(&cond, &mutex);
+          }
+          if(pipeline.freq_list_idx){
+            freq_list_base=freq_list1_base;
+          }
+          pthread_mutex_unlock(&mutex);
         }
-        break;
-      case MODE_HISTOGRAM:
-      case MODE_HISTOGRAM_HEX:
-        msb=0;
-        do{
-          timedelta_log2_pop_list_base[msb]=0;
-        }while((msb++)!=TIMEDELTA_COUNT_LOG2_MAX);
-        timedelta=0;
-        do{
-          freq=freq_list0_base[timedelta];
-          msb=0;
-          while(1<(DYSPOISSOMETER_UINT)(freq>>msb)){
-            msb++;
+        status=timedeltaprofile_freq_list_report(baseline_list_base, TIMEDELTAPROFILE_CPU_IDX_NONE, csv_status, format, freq_list_base, mode, precision, threshold, timedelta_count);
+        if((!status)&&learn_status){
+          status=timedeltaprofile_baseline_save(baseline_list_base, freq_list_base, baseline_name_base);
+          if(status){
+            printf("ERROR: Could not save baseline to %s!\n", baseline_name_base);
           }
-          timedelta_log2_pop_list_base[msb]+=freq;
-        }while((timedelta++)!=U16_MAX);
-        msb=0;
+        }
+        if(pipeline_status){
+/*
+Release the frequency list back to the producer, or tell it to quit.
+*/
+          pthread_mutex_lock(&mutex);
+          pipeline.pending_status=0;
+          pipeline.quit_status=status;
+          pthread_cond_signal(&cond);
+          pthread_mutex_unlock(&mutex);
+        }
+        if(status==1){
+          break;
+        }
+        if(format==TIMEDELTAPROFILE_FORMAT_TEXT){
+          switch(mode){
+          case MODE_DYSPOISSONISM:
+          case MODE_DYSPOISSONISM_HEX:
+          case MODE_MEAN:
+          case MODE_MEAN_HEX:
+          case MODE_DIVERGENCE:
+            if(!csv_status){
+              timedeltaprofile_newline_printf();
+            }else{
+              printf(", ");
+            }
+            break;
+          }
+          if(status){
+            if(csv_status){
+              timedeltaprofile_newline_printf();
+            }
+            printf("DRIFT: Divergence exceeds threshold!\n");
+          }
+        }
+        fflush(stdout);
+      }while((!status)&&continuous_status);
+      break;
+    }
+/*
+Allocate one sampler per selected CPU, each with its own frequency list, plus a combined frequency list at freq_list0_base.
+*/
+    sampler_idx_max=cpu_count-1;
+    list_idx_max=U16_MAX;
+    if(MODE_PERCENTILE<=mode){
+      list_idx_max=TIMEDELTA_PROFILE_BUCKET_IDX_MAX;
+    }
+    freq_list0_base=dyspoissometer_uint_list_malloc(list_idx_max);
+    sampler_list_base=(timedeltaprofile_sampler_t *)(calloc((size_t)(cpu_count), sizeof(timedeltaprofile_sampler_t)));
+    thread_list_base=(pthread_t *)(malloc((size_t)(cpu_count)*sizeof(pthread_t)));
+    thread_status_list_base=(u8 *)(malloc((size_t)(cpu_count)));
+    if(!(freq_list0_base&&sampler_list_base&&thread_list_base&&thread_status_list_base)){
+      printf("ERROR: Out of memory!\n");
+      break;
+    }
+    cpu_idx=0;
+    sampler_idx=0;
+    do{
+      while(!cpu_status_list_base[cpu_idx]){
+        cpu_idx++;
+      }
+      sampler_base=&sampler_list_base[sampler_idx];
+      sampler_base->cpu_idx=cpu_idx;
+      sampler_base->freq_list_base=timedeltaprofile_list_malloc(&lane_idx_max, mode, timedelta_count);
+      sampler_base->lane_idx_max=lane_idx_max;
+      sampler_base->mode=mode;
+      sampler_base->timedelta_count=timedelta_count;
+      cpu_idx++;
+      status=!sampler_base->freq_list_base;
+    }while((!status)&&((sampler_idx++)!=sampler_idx_max));
+    if(status){
+      printf("ERROR: Out of memory!\n");
+      break;
+    }
+    do{
+/*
+Sample on all selected CPUs at once, so that each sees the others' load as it would any other neighbor's. The calling thread only waits.
+*/
+      sampler_idx=0;
+      do{
+        sampler_base=&sampler_list_base[sampler_idx];
+        sampler_base->status=1;
+        thread_status_list_base[sampler_idx]=!pthread_create(&thread_list_base[sampler_idx], NULL, timedeltaprofile_sampler_run, sampler_base);
+      }while((sampler_idx++)!=sampler_idx_max);
+      sampler_idx=0;
+      do{
+        if(thread_status_list_base[sampler_idx]){
+          pthread_join(thread_list_base[sampler_idx], NULL);
+        }
+      }while((sampler_idx++)!=sampler_idx_max);
+      sampler_idx=0;
+      do{
+        sampler_base=&sampler_list_base[sampler_idx];
+        status=sampler_base->status;
+      }while((!status)&&((sampler_idx++)!=sampler_idx_max));
+      if(status){
+        printf("ERROR: Could not run a sampler thread pinned to CPU %u!\n", (unsigned int)(sampler_base->cpu_idx));
+        break;
+      }
+/*
+Combine the frequency lists, then display each CPU's statistics followed by the combined statistics, treating sampler_idx==cpu_count as the latter.
+*/
+      list_idx=0;
+      do{
+        freq_list0_base[list_idx]=0;
+        sampler_idx=0;
         do{
-          if(mode==MODE_HISTOGRAM){
-            pop_normalized=timedelta_log2_pop_list_base[msb];
-            pop_normalized/=timedelta_count;
-            printf("%02d: ", msb);
-            timedeltaprofile_double_printf((double)(pop_normalized));
+          freq_list0_base[list_idx]+=sampler_list_base[sampler_idx].freq_list_base[list_idx];
+        }while((sampler_idx++)!=sampler_idx_max);
+      }while((list_idx++)!=list_idx_max);
+      if(learn_status){
+        status=timedeltaprofile_baseline_save(baseline_list_base, freq_list0_base, baseline_name_base);
+        if(status){
+          printf("ERROR: Could not save baseline to %s!\n", baseline_name_base);
+          break;
+        }
+      }
+/*
+Report every CPU even after one of them has drifted, so that the output shows which.
+*/
+      drift_status=0;
+      sampler_idx=0;
+      do{
+        if(sampler_idx!=cpu_count){
+          sampler_base=&sampler_list_base[sampler_idx];
+        }
+        if(format==TIMEDELTAPROFILE_FORMAT_TEXT){
+          if(sampler_idx!=cpu_count){
+            printf("cpu%u: ", (unsigned int)(sampler_base->cpu_idx));
           }else{
-            pop=timedelta_log2_pop_list_base[msb];
-            pop<<=U64_BIT_MAX-timedelta_count_log2;
-            printf("%02d: ", msb);
-            timedeltaprofile_u64_printf(pop);
+            printf("all: ");
           }
-          if(csv_status&&(msb!=timedelta_count_log2)){
-            printf(", ");
-          }else{
+          if((MODE_HISTOGRAM<=mode)&&(mode!=MODE_DIVERGENCE)&&(!csv_status)){
             timedeltaprofile_newline_printf();
           }
-        }while((msb++)!=timedelta_count_log2);
-        if(!csv_status){
-          timedeltaprofile_newline_printf();
         }
+        if(sampler_idx!=cpu_count){
+          status=timedeltaprofile_freq_list_report(baseline_list_base, sampler_base->cpu_idx, csv_status, format, sampler_base->freq_list_base, mode, precision, threshold, timedelta_count);
+        }else{
+          status=timedeltaprofile_freq_list_report(baseline_list_base, TIMEDELTAPROFILE_CPU_IDX_ALL, csv_status, format, freq_list0_base, mode, precision, threshold, timedelta_count*cpu_count);
+        }
+        if(status==1){
+          break;
+        }
+        drift_status=(u8)(drift_status|status);
+        if(format==TIMEDELTAPROFILE_FORMAT_TEXT){
+          switch(mode){
+          case MODE_DYSPOISSONISM:
+          case MODE_DYSPOISSONISM_HEX:
+          case MODE_MEAN:
+          case MODE_MEAN_HEX:
+          case MODE_DIVERGENCE:
+            if(csv_status&&(sampler_idx!=cpu_count)){
+              printf(", ");
+            }else{
+              timedeltaprofile_newline_printf();
+            }
+            break;
+          }
+        }
+      }while((sampler_idx++)!=cpu_count);
+      if(status==1){
         break;
       }
-      switch(mode){
-      case MODE_DYSPOISSONISM:
-      case MODE_DYSPOISSONISM_HEX:
-      case MODE_MEAN:
-      case MODE_MEAN_HEX:
-        if(!csv_status){
+      status=drift_status;
+      if(format==TIMEDELTAPROFILE_FORMAT_TEXT){
+        if(((mode<=MODE_MEAN_HEX)||(mode==MODE_DIVERGENCE))&&(!csv_status)){
           timedeltaprofile_newline_printf();
-        }else{
-          printf(", ");
         }
-        break;
+        if(status){
+          printf("DRIFT: Divergence exceeds threshold!\n");
+        }
       }
       fflush(stdout);
-    }while(continuous_status);
+    }while((!status)&&continuous_status);
   }while(0);
+  if(sampler_list_base){
+    sampler_idx=0;
+    do{
+      dyspoissometer_free(sampler_list_base[sampler_idx].freq_list_base);
+    }while((sampler_idx++)!=sampler_idx_max);
+  }
+  if(pipeline_status){
+    if(pipeline_status==2){
+      pthread_join(producer_thread, NULL);
+    }
+    pthread_mutex_destroy(&mutex);
+    pthread_cond_destroy(&cond);
+  }
+  if(window_status){
+    dyspoissometer_window_free(&window);
+  }
+  free(timedelta_ring_base);
+  free(thread_status_list_base);
+  free(thread_list_base);
+  free(sampler_list_base);
   dyspoissometer_free(freq_list1_base);
   dyspoissometer_free(freq_list0_base);
   return status;
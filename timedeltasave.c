@@ -27,13 +27,401 @@ NOTE: Compile with little or no optimization (-O0) in order to minimize autopseu
 */
 #include "flag.h"
 #include "flag_timestamp.h"
+#include "flag_timedelta_pack.h"
 #include "flag_timedeltasave.h"
+#ifndef WINDOWS
+  #define _GNU_SOURCE
+#endif
+#include <pthread.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#ifdef WINDOWS
+  #include <windows.h>
+#else
+  #include <sched.h>
+#endif
 #include "constant.h"
+#include "timedelta_pack.h"
+#include "timedelta_pack_xtrn.h"
 #include "timestamp_xtrn.h"
+/*
+TIMEDELTASAVE_BUFFER_TIMEDELTA_COUNT_LOG2 is the log2 of the number of timedeltas in each buffer of the pool used with "s=", so each buffer is at most (2^(TIMEDELTASAVE_BUFFER_TIMEDELTA_COUNT_LOG2+3)) bytes. With "f=p", each buffer is coded as one block.
+*/
+#define TIMEDELTASAVE_BUFFER_TIMEDELTA_COUNT_LOG2 TIMEDELTA_PACK_BLOCK_TIMEDELTA_COUNT_LOG2
+/*
+TIMEDELTASAVE_POOL_COUNT_LOG2_MAX is the greatest allowed log2 of the number of buffers in the pool.
+*/
+#define TIMEDELTASAVE_POOL_COUNT_LOG2_MAX 12U
+/*
+timedeltasave_stream_t is the state shared between the sampler, which fills the buffers in *buffer_list_base in circular order, and the writer thread, which drains them to *handle in the same order, coding them with *pack_writer_base unless it's NULL; see timedeltasave_writer_run(). The pool consists of (buffer_idx_max+1) buffers, each buffer_size bytes, the last (buffer_idx_max+1)th of which is the sampler's scratch buffer for timedeltas which must be dropped. *buffer_fill_size_list_base gives the number of bytes actually sampled into each buffer. All fields after mutex_base are protected by *mutex_base. drain_count and fill_count are the number of buffers which have been written and filled, respectively, so the buffer at index (fill_count&buffer_idx_max) is free if and only if (fill_count-drain_count) is at most buffer_idx_max. quit_status is one when the sampler is done. status is one if the writer failed to write a buffer, in which case it has quit.
+*/
+TYPEDEF_START
+  ULONG *buffer_fill_size_list_base;
+  u32 buffer_idx_max;
+  u8 *buffer_list_base;
+  ULONG buffer_size;
+  pthread_cond_t *cond_base;
+  FILE *handle;
+  timedelta_pack_writer_t *pack_writer_base;
+  u8 timedelta_sample_size;
+  u32 writer_cpu_idx;
+  pthread_mutex_t *mutex_base;
+  u64 drain_count;
+  u64 fill_count;
+  u8 quit_status;
+  u8 status;
+TYPEDEF_END(timedeltasave_stream_t)
+
+u8
+timedeltasave_cpu_pair_get(u32 *sampler_cpu_idx_base, u32 *writer_cpu_idx_base){
+/*
+Choose 2 different CPUs on which this process is allowed to run: one for the sampler, and one for the writer.
+
+In:
+
+  sampler_cpu_idx_base is writable for one item.
+
+  writer_cpu_idx_base is writable for one item.
+
+Out:
+
+  Returns one if fewer than 2 CPUs are available, else zero.
+
+  *sampler_cpu_idx_base is the lowest available CPU index. Undefined if we returned one.
+
+  *writer_cpu_idx_base is the next available CPU index. Undefined if we returned one.
+*/
+  u32 cpu_count;
+  u32 cpu_idx;
+#ifdef WINDOWS
+  DWORD_PTR affinity_mask;
+  DWORD_PTR system_affinity_mask;
+#else
+  cpu_set_t cpu_set;
+#endif
+
+  cpu_count=0;
+  *sampler_cpu_idx_base=0;
+  *writer_cpu_idx_base=0;
+#ifdef WINDOWS
+  if(GetProcessAffinityMask(GetCurrentProcess(), &affinity_mask, &system_affinity_mask)){
+    cpu_idx=0;
+    while(affinity_mask&&(cpu_count!=2)){
+      if(affinity_mask&1){
+        *writer_cpu_idx_base=cpu_idx;
+        if(!cpu_count){
+          *sampler_cpu_idx_base=cpu_idx;
+        }
+        cpu_count++;
+      }
+      affinity_mask>>=1;
+      cpu_idx++;
+    }
+  }
+#else
+  if(!sched_getaffinity(0, sizeof(cpu_set_t), &cpu_set)){
+    cpu_idx=0;
+    while((cpu_idx!=CPU_SETSIZE)&&(cpu_count!=2)){
+      if(CPU_ISSET(cpu_idx, &cpu_set)){
+        *writer_cpu_idx_base=cpu_idx;
+        if(!cpu_count){
+          *sampler_cpu_idx_base=cpu_idx;
+        }
+        cpu_count++;
+      }
+      cpu_idx++;
+    }
+  }
+#endif
+  return (cpu_count!=2);
+}
+
+u8
+timedeltasave_cpu_pin(u32 cpu_idx){
+/*
+Pin the calling thread to a particular CPU.
+
+In:
+
+  cpu_idx is the index of a CPU on which this process is allowed to run.
+
+Out:
+
+  Returns one on failure, else zero.
+*/
+  u8 status;
+#ifdef WINDOWS
+  DWORD_PTR affinity_mask;
+#else
+  cpu_set_t cpu_set;
+#endif
+
+  status=1;
+#ifdef WINDOWS
+  if(cpu_idx<(sizeof(DWORD_PTR)<<U8_BITS_LOG2)){
+    affinity_mask=(DWORD_PTR)(1)<<cpu_idx;
+    status=!SetThreadAffinityMask(GetCurrentThread(), affinity_mask);
+  }
+#else
+  CPU_ZERO(&cpu_set);
+  CPU_SET(cpu_idx, &cpu_set);
+  status=!!sched_setaffinity(0, sizeof(cpu_set_t), &cpu_set);
+#endif
+  return status;
+}
+
+void
+timedeltasave_buffer_sample(u8 *buffer_base, ULONG buffer_size, u8 timedelta_sample_size){
+/*
+Fill a buffer with successive timedeltas, starting with fresh timestamps so that whatever the caller did in the meantime does not contaminate the first timedelta.
+
+In:
+
+  *buffer_base is writable for buffer_size bytes.
+
+  buffer_size is a nonzero multiple of timedelta_sample_size.
+
+  timedelta_sample_size is the number of bytes per timedelta, on [1, 8].
+
+Out:
+
+  *buffer_base contains (buffer_size/timedelta_sample_size) timedeltas, each of which is the low timedelta_sample_size byte(s) of the difference between 2 successive timestamp reads. As in the non-streaming case, the first read is discarded.
+*/
+  u64 timedelta;
+  u64 timestamp;
+  ULONG u8_idx;
+
+  timestamp=timestamp_get();
+  timestamp=timestamp_get();
+  u8_idx=0;
+  do{
+    timedelta=timestamp;
+    timestamp=timestamp_get();
+    timedelta=timestamp-timedelta;
+    memcpy(&buffer_base[u8_idx], &timedelta, (size_t)(timedelta_sample_size));
+    u8_idx+=timedelta_sample_size;
+  }while(u8_idx!=buffer_size);
+  return;
+}
+
+void *
+timedeltasave_writer_run(void *stream_base){
+/*
+Thread entry point for writing filled buffers to disk in the order in which they were filled.
+
+In:
+
+  stream_base is a (timedeltasave_stream_t *) with drain_count, fill_count, quit_status, and status all zero. writer_cpu_idx is the CPU to which to pin this thread, or U32_MAX for none.
+
+Out:
+
+  Returns NULL after the sampler sets quit_status and all filled buffers have been written, or after a write fails, in which case stream_base->status is one.
+*/
+  u8 *buffer_base;
+  ULONG buffer_fill_size;
+  u32 buffer_idx;
+  u8 status;
+  timedeltasave_stream_t *stream_base_typed;
+
+  stream_base_typed=(timedeltasave_stream_t *)(stream_base);
+/*
+Pinning is merely a performance measure, so failure is harmless.
+*/
+  if(stream_base_typed->writer_cpu_idx!=U32_MAX){
+    timedeltasave_cpu_pin(stream_base_typed->writer_cpu_idx);
+  }
+  status=0;
+  pthread_mutex_lock(stream_base_typed->mutex_base);
+  do{
+    while((stream_base_typed->drain_count==stream_base_typed->fill_count)&&(!stream_base_typed->quit_status)){
+      pthread_cond_wait(stream_base_typed->cond_base, stream_base_typed->mutex_base);
+    }
+    if(stream_base_typed->drain_count==stream_base_typed->fill_count){
+      break;
+    }
+    buffer_idx=(u32)(stream_base_typed->drain_count&stream_base_typed->buffer_idx_max);
+    buffer_fill_size=stream_base_typed->buffer_fill_size_list_base[buffer_idx];
+    pthread_mutex_unlock(stream_base_typed->mutex_base);
+    buffer_base=&stream_base_typed->buffer_list_base[(size_t)(buffer_idx)*stream_base_typed->buffer_size];
+    if(stream_base_typed->pack_writer_base){
+      status=timedelta_pack_block_write(buffer_fill_size/stream_base_typed->timedelta_sample_size, buffer_base, stream_base_typed->pack_writer_base);
+    }else{
+      status=(fwrite(buffer_base, (size_t)(U8_SIZE), (size_t)(buffer_fill_size), stream_base_typed->handle)!=buffer_fill_size);
+    }
+    pthread_mutex_lock(stream_base_typed->mutex_base);
+    stream_base_typed->drain_count++;
+    stream_base_typed->status=status;
+  }while(!status);
+  pthread_mutex_unlock(stream_base_typed->mutex_base);
+  return NULL;
+}
+
+u8
+timedeltasave_stream_save(FILE *handle, timedelta_pack_writer_t *pack_writer_base, u8 pool_count_log2, ULONG timedelta_count, u8 timedelta_sample_size){
+/*
+Sample timedeltas into a pool of buffers while a writer thread saves them, so that memory usage is bounded regardless of timedelta_count.
+
+In:
+
+  handle is the output file, opened for binary writing.
+
+  pack_writer_base is the return value of timedelta_pack_writer_init() for handle, or NULL to save raw timedeltas.
+
+  pool_count_log2 is the log2 of the number of buffers in the pool, on [1, TIMEDELTASAVE_POOL_COUNT_LOG2_MAX].
+
+  timedelta_count is the number of timedeltas to sample, which is nonzero.
+
+  timedelta_sample_size is the number of bytes per timedelta, on [1, 8].
+
+Out:
+
+  Returns zero on success, one on failure, or 2 if some buffers had to be dropped because the writer could not keep up. A summary has been printed in any event, preceded by a warning giving the location of each run of consecutive dropped buffers.
+
+  The file contains the timedeltas, except for those in dropped buffers. If pack_writer_base is not NULL, then the caller must still call timedelta_pack_writer_finish().
+*/
+  ULONG *buffer_fill_size_list_base;
+  ULONG buffer_fill_size;
+  u32 buffer_idx;
+  u32 buffer_idx_max;
+  u8 *buffer_list_base;
+  ULONG buffer_size;
+  pthread_cond_t cond;
+  u64 drop_count;
+  u64 gap_timedelta_count;
+  pthread_mutex_t mutex;
+  u8 pin_status;
+  size_t pool_size;
+  u32 sampler_cpu_idx;
+  u8 status;
+  u64 save_timedelta_count;
+  timedeltasave_stream_t stream;
+  u64 timedelta_counter;
+  u32 writer_cpu_idx;
+  pthread_t writer_thread;
+
+  buffer_idx_max=(u32)((1U<<pool_count_log2)-1);
+  buffer_size=(ULONG)(timedelta_sample_size)<<TIMEDELTASAVE_BUFFER_TIMEDELTA_COUNT_LOG2;
+/*
+Allocate one more buffer than the pool size, as scratch space for dropped timedeltas. With 8-byte timedeltas, the largest pool exceeds the address space of a 32-bit build, so fail rather than allocate a truncated size.
+*/
+  buffer_list_base=NULL;
+  pool_size=(size_t)(buffer_idx_max+2)*(size_t)(buffer_size);
+  if((pool_size/buffer_size)==(buffer_idx_max+2)){
+    buffer_list_base=(u8 *)(malloc(pool_size));
+  }
+  buffer_fill_size_list_base=(ULONG *)(malloc((size_t)(buffer_idx_max+1)*sizeof(ULONG)));
+  status=1;
+  do{
+    if(!(buffer_list_base&&buffer_fill_size_list_base)){
+      printf("ERROR: Out of memory!\n");
+      break;
+    }
+/*
+Keep the writer off the sampler's CPU, where it would cause the very anomalies which we're trying to observe.
+*/
+    pin_status=!timedeltasave_cpu_pair_get(&sampler_cpu_idx, &writer_cpu_idx);
+    if(pin_status){
+      pin_status=!timedeltasave_cpu_pin(sampler_cpu_idx);
+    }
+    if(!pin_status){
+      printf("WARNING: Could not separate the sampler and writer onto different CPUs.\n");
+      writer_cpu_idx=U32_MAX;
+    }
+    stream.buffer_fill_size_list_base=buffer_fill_size_list_base;
+    stream.buffer_idx_max=buffer_idx_max;
+    stream.buffer_list_base=buffer_list_base;
+    stream.buffer_size=buffer_size;
+    stream.cond_base=&cond;
+    stream.drain_count=0;
+    stream.fill_count=0;
+    stream.handle=handle;
+    stream.mutex_base=&mutex;
+    stream.pack_writer_base=pack_writer_base;
+    stream.quit_status=0;
+    stream.status=0;
+    stream.timedelta_sample_size=timedelta_sample_size;
+    stream.writer_cpu_idx=writer_cpu_idx;
+    pthread_cond_init(&cond, NULL);
+    pthread_mutex_init(&mutex, NULL);
+    if(pthread_create(&writer_thread, NULL, timedeltasave_writer_run, &stream)){
+      printf("ERROR: Could not create writer thread!\n");
+      pthread_mutex_destroy(&mutex);
+      pthread_cond_destroy(&cond);
+      break;
+    }
+    printf("Streaming timedeltas to disk through %u buffers of %u bytes each...\n", (unsigned int)(buffer_idx_max+1), (unsigned int)(buffer_size));
+    fflush(stdout);
+    drop_count=0;
+    gap_timedelta_count=0;
+    save_timedelta_count=0;
+    status=0;
+    timedelta_counter=timedelta_count;
+    do{
+      buffer_fill_size=buffer_size;
+      if(timedelta_counter<((u64)(1)<<TIMEDELTASAVE_BUFFER_TIMEDELTA_COUNT_LOG2)){
+        buffer_fill_size=(ULONG)(timedelta_counter)*timedelta_sample_size;
+      }
+/*
+If the writer hasn't freed a buffer, then sample into the scratch buffer and drop it, rather than wait, which would create a gap indistinguishable from a stall.
+*/
+      pthread_mutex_lock(&mutex);
+      status=stream.status;
+      buffer_idx=buffer_idx_max+1;
+      if((stream.fill_count-stream.drain_count)<=buffer_idx_max){
+        buffer_idx=(u32)(stream.fill_count&buffer_idx_max);
+      }
+      pthread_mutex_unlock(&mutex);
+      if(status){
+        break;
+      }
+/*
+Report each run of dropped buffers once it ends, so that the gap can be located in the file. Doing so before sampling is harmless because each buffer begins with fresh timestamp reads.
+*/
+      if(gap_timedelta_count&&(buffer_idx<=buffer_idx_max)){
+        printf("WARNING: Dropped %llu timedeltas before saved timedelta %llu.\n", (unsigned long long)(gap_timedelta_count), (unsigned long long)(save_timedelta_count));
+        gap_timedelta_count=0;
+      }
+      timedeltasave_buffer_sample(&buffer_list_base[(size_t)(buffer_idx)*buffer_size], buffer_fill_size, timedelta_sample_size);
+      if(buffer_idx<=buffer_idx_max){
+        buffer_fill_size_list_base[buffer_idx]=buffer_fill_size;
+        pthread_mutex_lock(&mutex);
+        stream.fill_count++;
+        pthread_cond_signal(&cond);
+        pthread_mutex_unlock(&mutex);
+        save_timedelta_count+=buffer_fill_size/timedelta_sample_size;
+      }else{
+        drop_count++;
+        gap_timedelta_count+=buffer_fill_size/timedelta_sample_size;
+      }
+      timedelta_counter-=buffer_fill_size/timedelta_sample_size;
+    }while(timedelta_counter);
+    if(gap_timedelta_count){
+      printf("WARNING: Dropped %llu timedeltas after the last saved one.\n", (unsigned long long)(gap_timedelta_count));
+    }
+    pthread_mutex_lock(&mutex);
+    stream.quit_status=1;
+    pthread_cond_signal(&cond);
+    pthread_mutex_unlock(&mutex);
+    pthread_join(writer_thread, NULL);
+    pthread_mutex_destroy(&mutex);
+    pthread_cond_destroy(&cond);
+    status=stream.status;
+    if(status){
+      printf("ERROR: File write failed!\n");
+      break;
+    }
+    printf("Wrote %llu buffers.\n", (unsigned long long)(stream.drain_count));
+    if(drop_count){
+      printf("WARNING: Dropped %llu buffers because the disk could not keep up. Try a larger\npool or a faster disk.\n", (unsigned long long)(drop_count));
+      status=2;
+    }
+  }while(0);
+  free(buffer_fill_size_list_base);
+  free(buffer_list_base);
+  return status;
+}
 
 int
 main(int argc, char *argv[]){
@@ -43,7 +431,13 @@ main(int argc, char *argv[]){
   char *filename_base;
   FILE *handle;
   u8 mode;
+  char *option_base;
+  u8 option_idx;
+  timedelta_pack_writer_t *pack_writer_base;
+  u8 pack_status;
+  u8 pool_count_log2;
   u8 status;
+  ULONG timedelta_block_count;
   ULONG timedelta_count;
   u8 timedelta_count_log2;
   ULONG timedelta_list_size;
@@ -57,18 +451,23 @@ main(int argc, char *argv[]){
   u64 transfer_size_actual;
   ULONG u8_idx;
 
+  handle=NULL;
+  pack_writer_base=NULL;
   status=1;
   timedelta_u8_list_base=NULL;
   do{
-    if(argc!=4){
+    if((argc<4)||(6<argc)){
       printf("Timedelta Stream Saver\nCopyright 2016 Russell Leidich\nhttp://enranda.blogspot.com\n");
       printf("build_id_in_hex=%02X\n\n", TIMEDELTASAVE_BUILD_ID);
       printf("Save a power-of-2 block of N-byte successive timedeltas.\n\n");
-      printf("Syntax:\n\ntimedeltasave mode timedelta_count_log2 filename_to_overwrite\n\n");
+      printf("Syntax:\n\ntimedeltasave mode timedelta_count_log2 filename_to_overwrite [option ...]\n\n");
       printf("where:\n\n");
       printf("mode is the number of bytes per timedelta, less one, on [0, 7]. Each timedelta\nis the low (mode+1) byte(s) of the differnce between 2 successive timestamp\nreads, but the first read is discarded due to plausible branch misprediction\nin the read loop. Thus the first timedelta is issued following 3 timestamp\nreads, the next after a total of 4, etc.\n\n");
-      printf("timedelta_count_log2 is the log2 of the number of timedeltas to write to the\nindicated file. You can then perform a statistical analysis with tools such as\ndyspoissofile from the Dyspoissometer toolkit, or search for timedeltas in\nunusual ranges which may indicate the presence of malware. In any event no file\nIO shall take place until all timedeltas have been sampled, so as to avoid\nmistaking my own IO effects for timedelta anomalies.\n\n");
+      printf("timedelta_count_log2 is the log2 of the number of timedeltas to write to the\nindicated file. You can then perform a statistical analysis with tools such as\ndyspoissofile from the Dyspoissometer toolkit, or search for timedeltas in\nunusual ranges which may indicate the presence of malware. Unless \"s=\" is given,\nno file IO shall take place until all timedeltas have been sampled, so as to\navoid mistaking my own IO effects for timedelta anomalies.\n\n");
       printf("filename_to_overwrite is the output filename.\n\n");
+      printf("option is any of the following, in any order:\n\n");
+      printf("  f=r: Save raw timedeltas of (mode+1) byte(s) each (default)\n  f=p: Save packed timedeltas, which typically take about one byte each\n       regardless of mode, so full 8-byte timedeltas (mode 7) cost little more\n       than truncated ones. Each timedelta is coded as its difference from the\n       previous one, zigzagged and written as a variable-length integer, in\n       independent blocks of (2^%u) timedeltas with an index at the end for\n       random access. See timedelta_pack.h for the format and timedelta_pack.c\n       for a reader.\n", TIMEDELTA_PACK_BLOCK_TIMEDELTA_COUNT_LOG2);
+      printf("  s=M: Stream the timedeltas to disk while sampling, through a pool of (2^M)\n       buffers of (2^%u) timedeltas each, where M is on [1, %u]. This bounds\n       memory usage, so timedelta_count_log2 is limited only by disk space. The\n       sampler runs on the first CPU available to this process and a writer\n       thread, which also packs the timedeltas with \"f=p\", on the second, if\n       any. Each buffer begins with fresh timestamp reads, so handoffs between\n       buffers are excluded from the timedeltas. If the pool fills up because\n       the disk is too slow, then the sampler drops whole buffers rather than\n       stall, and exits with status 2 after reporting where.\n\n", TIMEDELTASAVE_BUFFER_TIMEDELTA_COUNT_LOG2, TIMEDELTASAVE_POOL_COUNT_LOG2_MAX);
       break;
     }
     decimal_base=argv[1];
@@ -93,8 +492,92 @@ main(int argc, char *argv[]){
         }
       }
     }
-    timedelta_count=1;
-    timedelta_count<<=timedelta_count_log2;
+    timedelta_count=0;
+    if(timedelta_count_log2<ULONG_BITS){
+      timedelta_count=1;
+      timedelta_count<<=timedelta_count_log2;
+    }
+    if(!timedelta_count){
+      printf("ERROR: Invalid timedelta_count_log2!\n");
+      break;
+    }
+/*
+Parse options, each of which is a letter followed by "=" and a value.
+*/
+    pack_status=0;
+    pool_count_log2=0;
+    option_idx=4;
+    while(option_idx<argc){
+      option_base=argv[option_idx];
+      if((!option_base[0])||(option_base[1]!='=')){
+        printf("ERROR: Invalid option syntax!\n");
+        break;
+      }
+      decimal_base=&option_base[2];
+      if(option_base[0]=='f'){
+        if((decimal_base[0]=='p')&&(!decimal_base[1])){
+          pack_status=1;
+        }else if((decimal_base[0]=='r')&&(!decimal_base[1])){
+          pack_status=0;
+        }else{
+          printf("ERROR: Invalid output format!\n");
+          break;
+        }
+      }else if(option_base[0]=='s'){
+        pool_count_log2=U8_MAX;
+        digit0=(u8)(decimal_base[0]-'0');
+        if(digit0<=9){
+          digit1=(u8)(decimal_base[1]);
+          if(!digit1){
+            pool_count_log2=digit0;
+          }else{
+            digit1=(u8)(digit1-'0');
+            if((digit1<=9)&&(!decimal_base[2])){
+              pool_count_log2=(u8)((digit0*10)+digit1);
+            }
+          }
+        }
+        if((!pool_count_log2)||(TIMEDELTASAVE_POOL_COUNT_LOG2_MAX<pool_count_log2)){
+          printf("ERROR: Invalid pool size!\n");
+          break;
+        }
+      }else{
+        printf("ERROR: Unknown option!\n");
+        break;
+      }
+      option_idx++;
+    }
+    if(option_idx!=argc){
+      break;
+    }
+    filename_base=argv[3];
+    if(pool_count_log2){
+      handle=fopen(filename_base, "wb");
+      if(!handle){
+        printf("ERROR: Cannot open that file for writing!\n");
+        break;
+      }
+      if(pack_status){
+        pack_writer_base=timedelta_pack_writer_init(TIMEDELTA_PACK_BUILD_BREAK_COUNT, TIMEDELTA_PACK_BUILD_FEATURE_COUNT, handle, timedelta_sample_size);
+        if(!pack_writer_base){
+          printf("ERROR: Out of memory or file write failed!\n");
+          break;
+        }
+      }
+      status=timedeltasave_stream_save(handle, pack_writer_base, pool_count_log2, timedelta_count, timedelta_sample_size);
+      if(pack_writer_base&&(status!=1)){
+        if(timedelta_pack_writer_finish(pack_writer_base)){
+          status=1;
+          printf("ERROR: File write failed!\n");
+        }else{
+          printf("Packed %llu timedeltas into %llu bytes.\n", (unsigned long long)(pack_writer_base->timedelta_count), (unsigned long long)(pack_writer_base->file_offset+(pack_writer_base->block_count<<U64_SIZE_LOG2)+TIMEDELTA_PACK_TRAILER_SIZE));
+        }
+      }
+      if(!status){
+        printf("\n");
+      }
+      break;
+    }
     timestamp_count=timedelta_count+2;
     timestamp_list_size=timestamp_count*timedelta_sample_size;    
     if((!timedelta_count)||((timestamp_list_size/timedelta_sample_size)!=timestamp_count)){
@@ -107,13 +590,18 @@ main(int argc, char *argv[]){
       printf("ERROR: Out of memory!\n");
       break;
     }
-    handle=NULL;
-    filename_base=argv[3];
     handle=fopen(filename_base, "wb");
     if(!handle){
       printf("ERROR: Cannot open that file for writing!\n");
       break;
     }
+    if(pack_status){
+      pack_writer_base=timedelta_pack_writer_init(TIMEDELTA_PACK_BUILD_BREAK_COUNT, TIMEDELTA_PACK_BUILD_FEATURE_COUNT, handle, timedelta_sample_size);
+      if(!pack_writer_base){
+        printf("ERROR: Out of memory or file write failed!\n");
+        break;
+      }
+    }
     printf("Reading timestamps into memory...\n");
     fflush(stdout);
     u8_idx=0;
@@ -138,21 +626,41 @@ main(int argc, char *argv[]){
     status=0;
     printf("Saving to %s...\n", filename_base);
     fflush(stdout);
-    transfer_size_actual=(u64)(fwrite(timedelta_u8_list_base, (size_t)(U8_SIZE), (size_t)(timedelta_list_size), handle));
-    if(timedelta_list_size!=transfer_size_actual){
-      status=1;
-      printf("ERROR: File write failed!\n");
-      fclose(handle);
-      break;
+    if(pack_writer_base){
+/*
+Pack the timedeltas one block at a time, then append the block index.
+*/
+      u8_idx=0;
+      do{
+        timedelta_block_count=(timedelta_list_size-u8_idx)/timedelta_sample_size;
+        timedelta_block_count=MIN(timedelta_block_count, (ULONG)(1)<<TIMEDELTA_PACK_BLOCK_TIMEDELTA_COUNT_LOG2);
+        status=timedelta_pack_block_write(timedelta_block_count, &timedelta_u8_list_base[u8_idx], pack_writer_base);
+        u8_idx+=timedelta_block_count*timedelta_sample_size;
+      }while((!status)&&(u8_idx!=timedelta_list_size));
+      status=(u8)(status|timedelta_pack_writer_finish(pack_writer_base));
+    }else{
+      transfer_size_actual=(u64)(fwrite(timedelta_u8_list_base, (size_t)(U8_SIZE), (size_t)(timedelta_list_size), handle));
+      status=(timedelta_list_size!=transfer_size_actual);
     }
-    status=!!fclose(handle);
     if(status){
-      printf("ERROR: File closure failed!\n");
+      printf("ERROR: File write failed!\n");
       break;
-    }else{
-      printf("\n");
     }
+    if(pack_writer_base){
+      printf("Packed %llu timedeltas into %llu bytes.\n", (unsigned long long)(pack_writer_base->timedelta_count), (unsigned long long)(pack_writer_base->file_offset+(pack_writer_base->block_count<<U64_SIZE_LOG2)+TIMEDELTA_PACK_TRAILER_SIZE));
+    }
+    printf("\n");
   }while(0);
+/*
+Close the file in any event, and fail if it doesn't flush.
+*/
+  if(handle){
+    if(fclose(handle)&&(status!=1)){
+      status=1;
+      printf("ERROR: File closure failed!\n");
+    }
+  }
+  timedelta_pack_writer_free(pack_writer_base);
   if(timedelta_u8_list_base){
     free(timedelta_u8_list_base);
   }